@@ -0,0 +1,64 @@
+/**
+ * @file AlignedAllocator.hpp
+ * @brief Minimal over-aligned allocator for cache-line / SIMD friendly containers.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace qga
+{
+
+    /// @brief Cache line size assumed for column storage (x86-64 / most ARM64 cores).
+    inline constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+    /**
+     * @class AlignedAllocator
+     * @brief Standard allocator returning storage aligned to @p Align bytes.
+     *
+     * Used for columnar containers so that every column starts on a cache line
+     * and can be consumed by aligned SIMD loads.
+     *
+     * @tparam T     Value type.
+     * @tparam Align Alignment in bytes (power of two, >= alignof(T)).
+     */
+    template <typename T, std::size_t Align = CACHE_LINE_SIZE> class AlignedAllocator
+    {
+      public:
+        static_assert((Align & (Align - 1)) == 0, "Align must be a power of two");
+        static_assert(Align >= alignof(T), "Align must not be weaker than alignof(T)");
+
+        using value_type = T;
+
+        template <typename U> struct rebind
+        {
+            using other = AlignedAllocator<U, Align>;
+        };
+
+        AlignedAllocator() noexcept = default;
+
+        template <typename U> AlignedAllocator(const AlignedAllocator<U, Align>&) noexcept {}
+
+        T* allocate(std::size_t n)
+        {
+            return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{Align}));
+        }
+
+        void deallocate(T* p, std::size_t) noexcept
+        {
+            ::operator delete(p, std::align_val_t{Align});
+        }
+
+        template <typename U> bool operator==(const AlignedAllocator<U, Align>&) const noexcept
+        {
+            return true;
+        }
+    };
+
+    /// @brief std::vector whose buffer starts on a cache line boundary.
+    template <typename T> using AlignedVector = std::vector<T, AlignedAllocator<T>>;
+
+} // namespace qga
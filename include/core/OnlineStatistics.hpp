@@ -0,0 +1,285 @@
+/**
+ * @file OnlineStatistics.hpp
+ * @brief Streaming accumulators for the metrics of @ref Statistics.
+ *
+ * Each accumulator takes one observation at a time in O(1) time and memory,
+ * so metrics can be produced in the same pass that generates the data (e.g.
+ * the backtest loop) without storing the series. Accumulators built over
+ * consecutive chunks (or on different threads) are combined with `merge()`
+ * and give the same result as one accumulator over the whole series, up to
+ * floating-point rounding.
+ *
+ * Example usage:
+ * @code
+ * RunningMoments moments;
+ * DownsideDeviation downside;
+ * for (double r : returns) { moments.push(r); downside.push(r); }
+ * double sharpe  = sharpeRatio(moments);
+ * double sortino = sortinoRatio(moments, downside);
+ * @endcode
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+
+namespace qga::core
+{
+
+    /**
+     * @class RunningMoments
+     * @brief Count, mean and variance (Welford's algorithm).
+     *
+     * Merging uses the pairwise update of Chan et al., so partial moments of
+     * independent chunks can be combined in any order.
+     */
+    class RunningMoments
+    {
+      public:
+        /// @brief Adds one observation.
+        void push(double x) noexcept
+        {
+            ++n_;
+            const double DELTA = x - mean_;
+            mean_ += DELTA / static_cast<double>(n_);
+            m2_ += DELTA * (x - mean_);
+        }
+
+        /// @brief Adds all observations of @p other.
+        void merge(const RunningMoments& other) noexcept
+        {
+            if (other.n_ == 0)
+                return;
+            if (n_ == 0)
+            {
+                *this = other;
+                return;
+            }
+            const double NA = static_cast<double>(n_);
+            const double NB = static_cast<double>(other.n_);
+            const double N = NA + NB;
+            const double DELTA = other.mean_ - mean_;
+            mean_ += DELTA * NB / N;
+            m2_ += other.m2_ + DELTA * DELTA * NA * NB / N;
+            n_ += other.n_;
+        }
+
+        /// @return Number of observations.
+        std::size_t count() const noexcept { return n_; }
+
+        /// @return Arithmetic mean (0 if empty).
+        double mean() const noexcept { return mean_; }
+
+        /// @return Sample variance (n - 1 denominator); 0 with fewer than two observations.
+        double variance() const noexcept
+        {
+            return n_ < 2 ? 0.0 : m2_ / static_cast<double>(n_ - 1);
+        }
+
+        /// @return Sample standard deviation.
+        double stddev() const noexcept { return std::sqrt(variance()); }
+
+      private:
+        std::size_t n_ = 0;
+        double mean_ = 0.0;
+        double m2_ = 0.0;  ///< Sum of squared deviations from the mean.
+    };
+
+    /**
+     * @class DownsideDeviation
+     * @brief Root mean square of the shortfalls below a threshold.
+     *
+     * Matches @ref Statistics::sortinoRatio: only observations below the
+     * threshold are counted, and the mean is taken over those observations.
+     */
+    class DownsideDeviation
+    {
+      public:
+        /// @param threshold Minimum acceptable return per observation.
+        explicit DownsideDeviation(double threshold = 0.0) noexcept : threshold_(threshold) {}
+
+        /// @brief Adds one observation.
+        void push(double x) noexcept
+        {
+            if (x < threshold_)
+            {
+                const double D = x - threshold_;
+                ++below_;
+                sumsq_ += D * D;
+            }
+        }
+
+        /**
+         * @brief Adds all observations of @p other.
+         * @throws std::invalid_argument if the thresholds differ.
+         */
+        void merge(const DownsideDeviation& other)
+        {
+            if (other.threshold_ != threshold_)
+                throw std::invalid_argument("DownsideDeviation: cannot merge different thresholds");
+            below_ += other.below_;
+            sumsq_ += other.sumsq_;
+        }
+
+        /// @return Threshold given at construction.
+        double threshold() const noexcept { return threshold_; }
+
+        /// @return Number of observations below the threshold.
+        std::size_t count() const noexcept { return below_; }
+
+        /// @return Downside deviation; 0 if no observation fell below the threshold.
+        double value() const noexcept
+        {
+            return below_ == 0 ? 0.0 : std::sqrt(sumsq_ / static_cast<double>(below_));
+        }
+
+      private:
+        double threshold_;
+        std::size_t below_ = 0;
+        double sumsq_ = 0.0;
+    };
+
+    /**
+     * @class DrawdownTracker
+     * @brief Running peak and maximum drawdown of a positive series (e.g. equity).
+     *
+     * The drawdown at an observation is `(peak - x) / peak`, where the peak
+     * is the running maximum including the first observation, as in
+     * @ref Statistics::maxDrawdown. Besides the peak the tracker keeps the
+     * minimum, which is all a merge needs: the worst drawdown spanning two
+     * chunks runs from the peak of the first to the trough of the second.
+     * Merging is therefore order-sensitive: `a.merge(b)` means that @p b
+     * follows @p a in time.
+     */
+    class DrawdownTracker
+    {
+      public:
+        /**
+         * @brief Adds one observation.
+         * @return Drawdown at this observation, in [0, 1] for positive values.
+         */
+        double push(double x) noexcept
+        {
+            if (n_++ == 0)
+            {
+                peak_ = x;
+                min_ = x;
+            }
+            peak_ = std::max(peak_, x);
+            min_ = std::min(min_, x);
+            const double DD = (peak_ - x) / peak_;
+            max_dd_ = std::max(max_dd_, DD);
+            return DD;
+        }
+
+        /// @brief Appends the observations of @p later, which must follow this series in time.
+        void merge(const DrawdownTracker& later) noexcept
+        {
+            if (later.n_ == 0)
+                return;
+            if (n_ == 0)
+            {
+                *this = later;
+                return;
+            }
+            max_dd_ = std::max({max_dd_, later.max_dd_, (peak_ - later.min_) / peak_});
+            peak_ = std::max(peak_, later.peak_);
+            min_ = std::min(min_, later.min_);
+            n_ += later.n_;
+        }
+
+        /// @return Number of observations.
+        std::size_t count() const noexcept { return n_; }
+
+        /// @return Running maximum (0 if empty).
+        double peak() const noexcept { return peak_; }
+
+        /// @return Largest drawdown so far (0 if empty).
+        double maxDrawdown() const noexcept { return max_dd_; }
+
+      private:
+        std::size_t n_ = 0;
+        double peak_ = 0.0;
+        double min_ = 0.0;
+        double max_dd_ = 0.0;
+    };
+
+    /**
+     * @class HitCounter
+     * @brief Wins (strictly positive results) out of all results, as in @ref Statistics::hitRatio.
+     */
+    class HitCounter
+    {
+      public:
+        /// @brief Adds one result (e.g. the PnL of a closed trade).
+        void push(double pnl) noexcept
+        {
+            ++total_;
+            if (pnl > 0.0)
+                ++wins_;
+        }
+
+        /// @brief Adds all results of @p other.
+        void merge(const HitCounter& other) noexcept
+        {
+            wins_ += other.wins_;
+            total_ += other.total_;
+        }
+
+        /// @return Number of winning results.
+        std::size_t wins() const noexcept { return wins_; }
+
+        /// @return Number of results.
+        std::size_t count() const noexcept { return total_; }
+
+        /// @return Win rate in [0, 1]; 0 if empty.
+        double ratio() const noexcept
+        {
+            return total_ == 0 ? 0.0 : static_cast<double>(wins_) / static_cast<double>(total_);
+        }
+
+      private:
+        std::size_t wins_ = 0;
+        std::size_t total_ = 0;
+    };
+
+    /**
+     * @brief Sharpe ratio from accumulated returns (same definition as @ref Statistics::sharpeRatio).
+     *
+     * @param returns          Moments of the periodic returns.
+     * @param risk_free_annual Annual risk-free rate.
+     * @param periods_per_year Sampling frequency.
+     * @return `(mean - rf) / stddev` with `rf = risk_free_annual / periods_per_year`;
+     *         0 with fewer than two returns, a zero deviation or an invalid frequency.
+     */
+    inline double sharpeRatio(const RunningMoments& returns, double risk_free_annual = 0.0,
+                              double periods_per_year = 1.0) noexcept
+    {
+        if (returns.count() < 2 || periods_per_year <= 0.0 || !std::isfinite(periods_per_year))
+            return 0.0;
+        const double SD = returns.stddev();
+        if (SD == 0.0)
+            return 0.0;
+        return (returns.mean() - risk_free_annual / periods_per_year) / SD;
+    }
+
+    /**
+     * @brief Sortino ratio from accumulated returns (same definition as @ref Statistics::sortinoRatio).
+     *
+     * @param returns  Moments of the periodic returns.
+     * @param downside Downside deviation of the same returns; its threshold is
+     *                 the per-period risk-free rate.
+     * @return `(mean - threshold) / downside`; 0 with fewer than two returns or no downside.
+     */
+    inline double sortinoRatio(const RunningMoments& returns, const DownsideDeviation& downside) noexcept
+    {
+        const double DEV = downside.value();
+        if (returns.count() < 2 || DEV == 0.0)
+            return 0.0;
+        return (returns.mean() - downside.threshold()) / DEV;
+    }
+
+} // namespace qga::core
@@ -3,25 +3,33 @@
  * @brief Utility class for statistical and financial performance calculations.
  *
  * This class is stateless and contains only static helper methods.
+ * Invalid inputs are logged; computed values are only logged when the
+ * library is built with the QGA_STATS_DIAGNOSTICS option, so the success
+ * paths neither allocate nor touch a log sink.
  *
  * TODO(v1.2.0–v1.9.9):
  *   - Split into two modules:
  *       StatisticsBasic (mean, stddev, median)
  *       StatisticsFinance (Sharpe, Sortino, CAGR, MDD, HitRatio)
- *
- * TODO(v1.2.0–v1.9.9):
- *   - Convert int-based metrics to double-based or templated versions
- *     for full type consistency.
  */
 
 #pragma once
 
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
 #include <optional>
+#include <span>
 #include <vector>
 
 namespace qga::core
 {
 
+/// Element types the basic statistics are instantiated for in Statistics.cpp.
+template <typename T>
+concept StatsElement = std::same_as<T, int> || std::same_as<T, std::int64_t> || std::same_as<T, float> ||
+                       std::same_as<T, double>;
+
 class Statistics
 {
   public:
@@ -33,48 +41,118 @@ class Statistics
     // =========================================
     // Basic statistics
     // =========================================
+    //
+    // Templated on the element type and implemented in Statistics.cpp with
+    // explicit instantiations for the StatsElement types (int, std::int64_t,
+    // float and double); other types are rejected at compile time.
+    // Reductions run over several independent accumulators, so the compiler
+    // can keep them in SIMD registers; results may therefore differ from a
+    // strictly sequential sum in the last bits.
+
+    /**
+     * @struct Summary
+     * @brief Count, mean, sample standard deviation, minimum and maximum of a sample.
+     */
+    struct Summary
+    {
+        std::size_t count = 0;
+        double mean = 0.0;
+        double stddev = 0.0;  ///< Sample standard deviation (n - 1); 0 for a single value.
+        double min = 0.0;
+        double max = 0.0;
+    };
 
     /**
-     * @brief Computes the arithmetic mean of integer values.
+     * @brief Computes the arithmetic mean.
      *
-     * @param values Vector of integers.
-     * @return Mean value, or std::nullopt if vector is empty.
+     * @param values Sample values.
+     * @return Mean value, or std::nullopt if @p values is empty.
+     */
+    template <StatsElement T>
+    static std::optional<double> calculateMean(std::span<const T> values);
+
+    /**
+     * @brief Returns the minimum element.
      *
-     * @note TODO: Convert to double-based or template version.
+     * @param values Sample values.
+     * @return Minimum value or std::nullopt if @p values is empty.
      */
-    static std::optional<double> calculateMean(const std::vector<int>& values);
+    template <StatsElement T>
+    static std::optional<T> calculateMin(std::span<const T> values);
 
     /**
-     * @brief Returns the minimum element in the vector.
+     * @brief Returns the maximum element.
      *
-     * @param values Vector of integers.
-     * @return Minimum value or std::nullopt if vector is empty.
+     * @param values Sample values.
+     * @return Maximum value or std::nullopt if @p values is empty.
      */
-    static std::optional<int> calculateMin(const std::vector<int>& values);
+    template <StatsElement T>
+    static std::optional<T> calculateMax(std::span<const T> values);
 
     /**
-     * @brief Returns the maximum element in the vector.
+     * @brief Computes the median by selection (`std::nth_element`, O(n)) on a copy.
      *
-     * @param values Vector of integers.
-     * @return Maximum value or std::nullopt if vector is empty.
+     * @param values Sample values.
+     * @return Median value (mean of the two middle values for even sizes),
+     *         or std::nullopt if @p values is empty.
      */
-    static std::optional<int> calculateMax(const std::vector<int>& values);
+    template <StatsElement T>
+    static std::optional<double> calculateMedian(std::span<const T> values);
 
     /**
-     * @brief Computes the median of integer values.
+     * @brief Computes the sample standard deviation (n - 1) in one pass.
      *
-     * @param values Vector of integers.
-     * @return Median value, or std::nullopt if vector is empty.
+     * @param values Sample values.
+     * @return Standard deviation or std::nullopt with fewer than two values.
      */
-    static std::optional<double> calculateMedian(const std::vector<int>& values);
+    template <StatsElement T>
+    static std::optional<double> calculateStdDev(std::span<const T> values);
 
     /**
-     * @brief Computes standard deviation of integer values.
+     * @brief Computes all of @ref Summary in a single pass over @p values.
+     *
+     * Sum and sum of squares are accumulated relative to the first value,
+     * which keeps the one-pass variance accurate for data far from zero.
      *
-     * @param values Vector of integers.
-     * @return Standard deviation or std::nullopt if vector is empty.
+     * @param values Sample values.
+     * @return Summary, or std::nullopt if @p values is empty.
      */
-    static std::optional<double> calculateStdDev(const std::vector<int>& values);
+    template <StatsElement T>
+    static std::optional<Summary> summarize(std::span<const T> values);
+
+    /// @brief Vector convenience overloads of the functions above.
+    template <StatsElement T>
+    static std::optional<double> calculateMean(const std::vector<T>& values)
+    {
+        return calculateMean(std::span<const T>(values));
+    }
+
+    template <StatsElement T> static std::optional<T> calculateMin(const std::vector<T>& values)
+    {
+        return calculateMin(std::span<const T>(values));
+    }
+
+    template <StatsElement T> static std::optional<T> calculateMax(const std::vector<T>& values)
+    {
+        return calculateMax(std::span<const T>(values));
+    }
+
+    template <StatsElement T>
+    static std::optional<double> calculateMedian(const std::vector<T>& values)
+    {
+        return calculateMedian(std::span<const T>(values));
+    }
+
+    template <StatsElement T>
+    static std::optional<double> calculateStdDev(const std::vector<T>& values)
+    {
+        return calculateStdDev(std::span<const T>(values));
+    }
+
+    template <StatsElement T> static std::optional<Summary> summarize(const std::vector<T>& values)
+    {
+        return summarize(std::span<const T>(values));
+    }
 
     // =========================================
     // Financial performance metrics
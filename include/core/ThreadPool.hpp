@@ -0,0 +1,99 @@
+/**
+ * @file ThreadPool.hpp
+ * @brief Work-stealing worker pool for fork/join style parallel work.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace qga::core
+{
+
+    /**
+     * @class ThreadPool
+     * @brief Runs submitted tasks on a fixed set of work-stealing worker threads.
+     *
+     * Every worker owns a task deque. Tasks submitted from outside the pool are
+     * spread round-robin over the deques; tasks submitted by a running task go
+     * to the current worker's own deque. A worker pops its own deque from the
+     * back (newest first, cache-warm) and, when it runs dry, steals the oldest
+     * task from another worker's front. Uneven task costs therefore balance
+     * out without a single contended queue.
+     *
+     * Results and exceptions are delivered through the `std::future` returned
+     * by @ref submit(). The destructor finishes all queued tasks before joining
+     * the workers.
+     *
+     * Example usage:
+     * @code
+     * ThreadPool pool(Config::getInstance().threads());
+     * auto f = pool.submit([] { return 42; });
+     * int v = f.get();
+     * @endcode
+     */
+    class ThreadPool
+    {
+      public:
+        /**
+         * @brief Starts the workers.
+         * @param threads Number of workers; 0 (or negative) means hardware concurrency.
+         */
+        explicit ThreadPool(int threads);
+
+        /// @brief Drains all queues and joins the workers.
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /// @return Number of worker threads.
+        std::size_t size() const noexcept { return workers_.size(); }
+
+        /**
+         * @brief Queues a callable for execution.
+         * @param fn Callable taking no arguments.
+         * @return Future holding the result (or the exception thrown by @p fn).
+         */
+        template <typename Fn> auto submit(Fn&& fn) -> std::future<std::invoke_result_t<Fn&>>
+        {
+            using R = std::invoke_result_t<Fn&>;
+            auto task = std::make_shared<std::packaged_task<R()>>(std::forward<Fn>(fn));
+            auto fut = task->get_future();
+            enqueue([task] { (*task)(); });
+            return fut;
+        }
+
+      private:
+        /// Per-worker task deque (owner pops the back, thieves take the front).
+        struct WorkQueue
+        {
+            std::mutex mtx_;
+            std::deque<std::function<void()>> jobs_;
+        };
+
+        void enqueue(std::function<void()> job);
+        bool popLocal(std::size_t self, std::function<void()>& job);
+        bool steal(std::size_t self, std::function<void()>& job);
+        void workerLoop(std::size_t self);
+
+        std::vector<std::unique_ptr<WorkQueue>> queues_; ///< One deque per worker.
+        std::vector<std::thread> workers_;               ///< Worker threads.
+        std::atomic<std::size_t> next_queue_{0};         ///< Round-robin target for external submits.
+        std::atomic<std::size_t> pending_{0};            ///< Queued, not yet started tasks.
+        std::mutex sleep_mtx_;                           ///< Guards sleeping and stop_.
+        std::condition_variable cv_;                     ///< Signals new jobs / shutdown.
+        bool stop_ = false;                              ///< Set by the destructor.
+    };
+
+} // namespace qga::core
@@ -0,0 +1,42 @@
+/**
+ * @file BarColumns.hpp
+ * @brief Read-only column views over a time series of OHLCV bars.
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace qga::domain {
+
+/**
+ * @struct BarColumns
+ * @brief Structure-of-arrays view of bars: one span per OHLCV field.
+ *
+ * All spans have the same length; element `i` of every span describes bar `i`.
+ * The view does not own memory — the producer (e.g. a BarSeries or a mapped
+ * file) must outlive it.
+ */
+struct BarColumns {
+    std::span<const std::int64_t> ts_;     ///< Epoch millis.
+    std::span<const double> open_;         ///< Open prices.
+    std::span<const double> high_;         ///< High prices.
+    std::span<const double> low_;          ///< Low prices.
+    std::span<const double> close_;        ///< Close prices.
+    std::span<const double> volume_;       ///< Bar volumes.
+
+    /// @return Number of bars described by the view.
+    std::size_t size() const noexcept { return ts_.size(); }
+
+    /**
+     * @brief Returns the bars `[offset, offset + count)` as a narrower view.
+     * @note Unchecked: the range must lie within size().
+     */
+    BarColumns slice(std::size_t offset, std::size_t count) const noexcept {
+        return {ts_.subspan(offset, count),    open_.subspan(offset, count),
+                high_.subspan(offset, count),  low_.subspan(offset, count),
+                close_.subspan(offset, count), volume_.subspan(offset, count)};
+    }
+};
+
+} // namespace qga::domain
@@ -0,0 +1,92 @@
+/**
+ * @file InstrumentRegistry.hpp
+ * @brief Interns instruments into dense integer IDs.
+ *
+ * Hot paths (portfolio accounting, multi-asset engines) index flat arrays by
+ * @ref InstrumentId instead of hashing strings built from symbol and venue.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include "domain/Instrument.hpp"
+
+namespace qga::domain {
+
+/// @brief Dense instrument identifier: `0 .. registry.size() - 1`, in interning order.
+using InstrumentId = std::uint32_t;
+
+/**
+ * @class InstrumentRegistry
+ * @brief Maps instruments (keyed by symbol and exchange MIC) to dense IDs.
+ *
+ * Lookups hash the symbol and MIC in place (heterogeneous lookup), so finding
+ * an already interned instrument never allocates. IDs are never reused, and
+ * references returned by @ref get() stay valid while the registry lives.
+ *
+ * Example usage:
+ * @code
+ * InstrumentRegistry reg;
+ * const InstrumentId AAPL = reg.intern(aapl);
+ * positions[AAPL] += 10;
+ * @endcode
+ */
+class InstrumentRegistry {
+public:
+    InstrumentRegistry() = default;
+    InstrumentRegistry(const InstrumentRegistry& other);
+    InstrumentRegistry& operator=(const InstrumentRegistry& other);
+    InstrumentRegistry(InstrumentRegistry&&) noexcept = default;
+    InstrumentRegistry& operator=(InstrumentRegistry&&) noexcept = default;
+
+    /**
+     * @brief Returns the ID of @p ins, assigning the next free one on first use.
+     * @param ins Instrument; identity is its symbol and exchange MIC.
+     * @return Dense ID.
+     */
+    InstrumentId intern(const Instrument& ins);
+
+    /**
+     * @brief Looks up an instrument without interning it.
+     * @return Its ID, or `std::nullopt` if it was never interned.
+     */
+    std::optional<InstrumentId> find(const Instrument& ins) const noexcept;
+
+    /**
+     * @brief Returns the instrument registered under @p id.
+     * @throws std::out_of_range if @p id is not a valid ID.
+     */
+    const Instrument& get(InstrumentId id) const;
+
+    /// @return Number of interned instruments (one past the largest ID).
+    std::size_t size() const noexcept { return instruments_.size(); }
+
+private:
+    /// (symbol, MIC) view; points into an entry of @ref instruments_ when stored as a key.
+    struct Key {
+        std::string_view symbol_;
+        std::string_view mic_;
+        bool operator==(const Key&) const noexcept = default;
+    };
+
+    struct KeyHash {
+        std::size_t operator()(const Key& k) const noexcept {
+            const std::size_t H = std::hash<std::string_view>{}(k.symbol_);
+            return H ^ (std::hash<std::string_view>{}(k.mic_) + 0x9e3779b97f4a7c15ULL + (H << 6) + (H >> 2));
+        }
+    };
+
+    void rebuildIndex();
+
+    std::deque<Instrument> instruments_;                  ///< By ID; deque keeps addresses stable.
+    std::unordered_map<Key, InstrumentId, KeyHash> ids_;  ///< Keys view into @ref instruments_.
+};
+
+} // namespace qga::domain
@@ -2,33 +2,111 @@
  * @file BarSeries.hpp
  * @brief Container of market bars used by the backtest engine.
  *
- * Defines a simple container for storing and accessing time-ordered
- * market quotes (OHLCV data). Used internally by the engine and strategies.
+ * Defines a columnar (structure-of-arrays) container for storing and accessing
+ * time-ordered market quotes (OHLCV data). Used internally by the engine and strategies.
  */
 
 #pragma once
 
-#include <vector>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include "common/AlignedAllocator.hpp"
+#include "domain/BarColumns.hpp"
 #include "domain/Quote.hpp"
 
 namespace qga::domain::backtest {
 
 /**
  * @class BarSeries
- * @brief Simple time-ordered container for @ref domain::Quote bars.
+ * @brief Time-ordered columnar container for @ref domain::Quote bars.
  *
- * Provides read-only accessors and append functionality for use in
- * backtests. Acts as the primary data source for strategy evaluation.
+ * Every OHLCV field lives in its own contiguous, 64-byte aligned array, so
+ * indicators that only need closes stream a single column through cache and
+ * can be vectorized. Row access (`at()`, `operator[]`, `front()`, `end()`)
+ * returns a materialized @ref domain::Quote row view, which keeps the engine
+ * and strategies working on whole bars unchanged.
+ *
+ * A series either owns its columns or is a read-only view over external
+ * memory (see @ref view()), e.g. a memory-mapped binary bar file. Views are
+ * cheap to copy and keep their backing storage alive.
  */
 class BarSeries {
 public:
     using Quote = domain::Quote;
+
+    BarSeries() = default;
+    BarSeries(const BarSeries& other);
+    BarSeries(BarSeries&& other) noexcept;
+    BarSeries& operator=(const BarSeries& other);
+    BarSeries& operator=(BarSeries&& other) noexcept;
+    ~BarSeries() = default;
+
+    /**
+     * @brief Creates a read-only series over externally owned columns (zero-copy).
+     *
+     * @param columns Column spans; all must have the same length.
+     * @param backing Owner of the column memory, released with the last copy of the view.
+     * @return Series that reads directly from @p columns.
+     * @throws std::invalid_argument if the column lengths differ.
+     */
+    static BarSeries view(BarColumns columns, std::shared_ptr<const void> backing);
+
+    /**
+     * @brief Tells whether the series is a read-only view over external memory.
+     */
+    bool isView() const noexcept { return backing_ != nullptr; }
+
     /**
     * @brief Appends a new market bar (quote) to the series.
     * @param q Market quote containing OHLCV data and timestamp.
+    * @throws std::logic_error if the series is a read-only view.
     */
     void add(const domain::Quote& q);
 
+    /**
+     * @brief Appends all bars of @p cols (bulk column copy).
+     * @param cols Columns to copy; must not alias this series.
+     * @throws std::logic_error if the series is a read-only view.
+     */
+    void append(const BarColumns& cols);
+
+    /**
+     * @brief Reserves capacity in every column.
+     * @param n Expected number of bars.
+     * @throws std::logic_error if the series is a read-only view.
+     */
+    void reserve(std::size_t n);
+
+    /**
+     * @brief Resizes every column to @p n bars (new bars are zero-filled).
+     *
+     * Used together with @ref set() to fill a pre-sized series in place, e.g.
+     * from several threads that each own a disjoint index range.
+     *
+     * @param n New number of bars.
+     * @throws std::logic_error if the series is a read-only view.
+     */
+    void resize(std::size_t n);
+
+    /**
+     * @brief Overwrites the bar at index @p i (unchecked).
+     *
+     * Never reallocates, so concurrent calls on distinct indices are safe.
+     *
+     * @param i Index into the series; must be less than size().
+     * @param q Bar values.
+     * @note Must not be called on a read-only view.
+     */
+    void set(std::size_t i, const domain::Quote& q) noexcept {
+        ts_[i] = q.ts_;
+        open_[i] = q.open_;
+        high_[i] = q.high_;
+        low_[i] = q.low_;
+        close_[i] = q.close_;
+        volume_[i] = q.volume_;
+    }
+
     /**
      * @brief Returns the number of bars in the series.
      * @return Total number of quotes stored.
@@ -36,37 +114,40 @@ public:
     std::size_t size() const noexcept;
 
     /**
-     * @brief Returns a const reference to the i-th bar.
+     * @brief Returns the i-th bar as a row view.
      * @param i Index into the series.
-     * @return Const reference to the requested quote.
+     * @return Quote assembled from the column values at @p i.
      * @throws std::out_of_range if index is invalid.
      */
-    const Quote& at(std::size_t i) const;
+    Quote at(std::size_t i) const;
 
     /**
-     * @brief Provides direct (unchecked) access to a quote by index.
+     * @brief Provides direct (unchecked) access to a bar by index.
      *
      * @param i Index into the series.
-     * @return Const reference to the quote at the specified index.
+     * @return Quote assembled from the column values at @p i.
      *
      * @note Unlike `at()`, this method does not perform bounds checking.
      *       Use only when index safety is guaranteed.
      */
-    const Quote& operator[](std::size_t i) const;
+    Quote operator[](std::size_t i) const noexcept {
+        return Quote{cols_.ts_[i], cols_.open_[i], cols_.high_[i],
+                     cols_.low_[i], cols_.close_[i], cols_.volume_[i]};
+    }
 
     /**
      * @brief Returns the most recent bar in the series.
-     * @return Const reference to the last quote.
-     * @pre `size() > 0`
+     * @return Last quote.
+     * @throws std::out_of_range if the series is empty.
      */
-    const Quote& end() const;
+    Quote end() const;
 
     /**
      * @brief Returns the first bar in the series.
-     * @return Const reference to the first quote.
-     * @pre `size() > 0`
+     * @return First quote.
+     * @throws std::out_of_range if the series is empty.
      */
-    const Quote& front() const;
+    Quote front() const;
 
     /**
      * @brief Checks if the BarSeries contains any quotes.
@@ -85,23 +166,38 @@ public:
      * @brief Clears all stored quotes from the series.
      *
      * Resets the container to an empty state. Useful when reloading
-     * or reusing the series instance.
+     * or reusing the series instance. A view releases its backing storage
+     * and becomes an empty owning series.
      */
     void clear() noexcept;
 
-    /**
-     * @brief Provides read-only access to the internal container of quotes.
-     *
-     * This method enables external components (e.g. exporters or visualizers)
-     * to iterate over the entire series without exposing mutation capabilities.
-     *
-     * @return Const reference to the internal std::vector of Quote objects.
-     *
-     * @note Usage of this method preserves encapsulation while enabling iteration.
-     */
-    const std::vector<Quote>& data() const noexcept;
+    /// @name Column accessors
+    /// Read-only views over a single field for all bars (64-byte aligned).
+    /// @{
+    std::span<const std::int64_t> timestamps() const noexcept { return cols_.ts_; }
+    std::span<const double> opens() const noexcept { return cols_.open_; }
+    std::span<const double> highs() const noexcept { return cols_.high_; }
+    std::span<const double> lows() const noexcept { return cols_.low_; }
+    std::span<const double> closes() const noexcept { return cols_.close_; }
+    std::span<const double> volumes() const noexcept { return cols_.volume_; }
+
+    /// @return All columns at once.
+    const BarColumns& columns() const noexcept { return cols_; }
+    /// @}
+
 private:
-    std::vector<Quote> data_;   ///< Internal container of quotes.
+    /// @brief Points @ref cols_ at the owned vectors (after they changed).
+    void rebind() noexcept;
+
+    BarColumns cols_;                       ///< Active columns (owned vectors or external view).
+    std::shared_ptr<const void> backing_;   ///< Keeps external column memory alive (views only).
+
+    AlignedVector<std::int64_t> ts_;    ///< Bar timestamps (epoch millis).
+    AlignedVector<double> open_;        ///< Open prices.
+    AlignedVector<double> high_;        ///< High prices.
+    AlignedVector<double> low_;         ///< Low prices.
+    AlignedVector<double> close_;       ///< Close prices.
+    AlignedVector<double> volume_;      ///< Bar volumes.
 };
 
 } // namespace qga::domain::backtest
@@ -0,0 +1,128 @@
+/**
+ * @file BarSource.hpp
+ * @brief Pull-based streams of bars for backtests that do not fit in memory.
+ *
+ * A source hands out the history in consecutive batches, so the engine only
+ * ever holds a bounded window of bars regardless of the total length.
+ * Concrete sources for files, databases and HTTP live in the ingest module
+ * (see ingest/BarSources.hpp).
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "domain/backtest/BarSeries.hpp"
+
+namespace qga::domain::backtest {
+
+/**
+ * @class IBarSource
+ * @brief Contract for a forward-only stream of time-ordered bars.
+ *
+ * Each call to @ref next() replaces the contents of a caller-owned batch
+ * with the following bars. The caller reuses the same batch object between
+ * calls, so steady-state streaming does not allocate.
+ */
+class IBarSource {
+public:
+    /**
+     * @brief Virtual destructor.
+     */
+    virtual ~IBarSource() = default;
+
+    /**
+     * @brief Fills @p batch with the next bars of the stream.
+     *
+     * @param batch    Owning series; cleared and refilled by the call.
+     * @param max_bars Target batch size. Sources that decode input in blocks
+     *                 (e.g. CSV) may exceed it by the rows of one block.
+     * @return False once the stream is exhausted (@p batch is then empty).
+     * @throws std::runtime_error on I/O or format errors of the underlying input.
+     */
+    virtual bool next(BarSeries& batch, std::size_t max_bars) = 0;
+};
+
+/**
+ * @class SeriesBarSource
+ * @brief Streams an in-memory (or memory-mapped) @ref BarSeries.
+ *
+ * Lets code written against @ref IBarSource run on already loaded data and
+ * serves as the reference source in tests.
+ */
+class SeriesBarSource : public IBarSource {
+public:
+    /**
+     * @param series Series to stream; copied (views share their backing, no bar copy).
+     */
+    explicit SeriesBarSource(BarSeries series) : series_(std::move(series)) {}
+
+    bool next(BarSeries& batch, std::size_t max_bars) override;
+
+private:
+    BarSeries series_;       ///< Streamed bars.
+    std::size_t pos_ = 0;    ///< Next bar to hand out.
+};
+
+/**
+ * @class ReadAheadBarSource
+ * @brief Decorator that pulls from another source on a background thread.
+ *
+ * Up to @p depth batches are decoded ahead of the consumer, so parsing or
+ * I/O overlaps with the backtest loop. Memory is bounded by
+ * `(depth + 1) * batch_bars` bars. Batches are recycled between the two
+ * threads, and an exception raised by the inner source is rethrown from
+ * @ref next() in the consuming thread.
+ *
+ * Example usage:
+ * @code
+ * ReadAheadBarSource src(std::make_unique<ingest::CsvFileBarSource>("big.csv"));
+ * auto result = engine.run(src, strategy);
+ * @endcode
+ */
+class ReadAheadBarSource : public IBarSource {
+public:
+    /**
+     * @param inner      Source to read from (owned; only touched by the worker thread).
+     * @param batch_bars Batch size requested from @p inner.
+     * @param depth      Maximum number of decoded batches waiting for the consumer (>= 1).
+     */
+    explicit ReadAheadBarSource(std::unique_ptr<IBarSource> inner,
+                                std::size_t batch_bars = 4096, std::size_t depth = 4);
+
+    /// @brief Stops the worker thread (pending batches are discarded).
+    ~ReadAheadBarSource() override;
+
+    ReadAheadBarSource(const ReadAheadBarSource&) = delete;
+    ReadAheadBarSource& operator=(const ReadAheadBarSource&) = delete;
+
+    /**
+     * @brief Hands over the next decoded batch.
+     * @param max_bars Ignored; batches have the size given at construction.
+     */
+    bool next(BarSeries& batch, std::size_t max_bars) override;
+
+private:
+    void produce();
+
+    std::unique_ptr<IBarSource> inner_;
+    std::size_t batch_bars_;
+    std::size_t depth_;
+
+    std::mutex mtx_;
+    std::condition_variable cv_;
+    std::deque<BarSeries> ready_;       ///< Decoded batches, in stream order.
+    std::vector<BarSeries> spare_;      ///< Consumed batches returned for reuse.
+    std::exception_ptr error_;          ///< Failure raised by the inner source.
+    bool done_ = false;                 ///< Inner source exhausted (or failed).
+    bool stop_ = false;                 ///< Consumer is shutting down.
+    std::thread worker_;
+};
+
+} // namespace qga::domain::backtest
@@ -8,9 +8,19 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
+#include <vector>
 #include "domain/backtest/BarSeries.hpp"
+#include "domain/backtest/BarSource.hpp"
+#include "domain/backtest/EngineLoop.hpp"
 #include "domain/backtest/Result.hpp"
+#include "strategy/IGraphStrategy.hpp"
 #include "strategy/IStrategy.hpp"
+#include "strategy/IVectorStrategy.hpp"
+#include "strategy/StaticStrategy.hpp"
 #include "domain/backtest/Execution.hpp"
 
 namespace qga::domain::backtest {
@@ -31,22 +41,152 @@ class Engine {
          * @brief Constructs the backtest engine.
          * @param initial_equity Starting capital used in the simulation.
          * @param exec Execution parameters (slippage, commission).
+         * @param record Detail recorded in the result; @ref RecordLevel::Summary keeps
+         *               runs allocation-free.
          */
         explicit Engine(double initial_equity = 10000.0,
-                ExecParams exec = {})
-        : initial_equity_(initial_equity), exec_(exec) {}
+                ExecParams exec = {},
+                RecordLevel record = RecordLevel::Summary)
+        : initial_equity_(initial_equity), exec_(exec), record_(record) {}
+
+        /// @return Starting capital of every run.
+        double initialEquity() const noexcept { return initial_equity_; }
+
+        /// @return Execution parameters (slippage, commission).
+        const ExecParams& execParams() const noexcept { return exec_; }
+
+        /// @return Detail recorded by every run of this engine.
+        RecordLevel recordLevel() const noexcept { return record_; }
 
         /**
          * @brief Execute the backtest over the given series with the provided strategy.
+         *
+         * Bars are handed to @ref strategy::IStrategy::onBars in blocks of 1024,
+         * then the signals of the block are executed bar by bar. The engine holds
+         * no per-run state, so one instance may run concurrently on several
+         * threads (each with its own strategy object).
+         * From @ref RecordLevel::Metrics on, the return, drawdown and hit
+         * accumulators of the result are updated in the same pass; with
+         * @ref RecordLevel::Full the equity and drawdown series are allocated
+         * once for the whole series before the loop.
+         *
+         * @param series Input time series of bars (OHLCV).
+         * @param strat  Strategy to be executed.
+         * @return BacktestResult (summary plus the records selected by the record level).
+         */
+        BacktestResult run(BarSeries const& series, strategy::IStrategy& strat) const;
+
+        /**
+         * @brief Execute the backtest with a strategy whose type is known at compile time.
+         *
+         * Statically dispatched counterpart of the overload above: the strategy's
+         * `signalAt()` (see @ref strategy::StaticStrategy) is called directly and
+         * inlined into the per-block signal loop, with no virtual call at all.
+         * Composite rules built with strategy/Combinators.hpp compile into that
+         * same loop. Fills and equity use the same operations in the same order
+         * as the virtual path, so results are bit-identical.
+         *
+         * Chosen by overload resolution whenever the static type of @p strat
+         * models @ref strategy::StaticStrategy (e.g. @ref strategy::MACrossover);
+         * pass an `IStrategy&` to force the virtual path.
+         *
          * @param series Input time series of bars (OHLCV).
          * @param strat  Strategy to be executed.
+         * @return BacktestResult (summary plus the records selected by the record level).
+         */
+        template <strategy::StaticStrategy S>
+        BacktestResult run(BarSeries const& series, S& strat) const;
+
+        /**
+         * @brief Execute the backtest over a stream of bars in bounded memory.
+         *
+         * Pulls consecutive batches from @p source and feeds them to the strategy
+         * in blocks (as above), so only one batch is resident at a time. Produces the same result as the
+         * @ref run(BarSeries const&, strategy::IStrategy&) overload on the same bars.
+         * Wrap the source in a @ref ReadAheadBarSource to decode on a background thread.
+         *
+         * @param source     Bar stream (consumed).
+         * @param strat      Strategy to be executed.
+         * @param batch_bars Number of bars requested per pull.
          * @return BacktestResult summary (equity, trades).
          */
-        BacktestResult run(BarSeries const& series, strategy::IStrategy& strat);
+        BacktestResult run(IBarSource& source, strategy::IStrategy& strat,
+                           std::size_t batch_bars = 4096) const;
+
+        /**
+         * @brief Execute several strategies over the same series in one pass, sharing their indicators.
+         *
+         * All strategies subscribe to one @ref strategy::IndicatorGraph, so an
+         * indicator requested by several of them (e.g. the same SMA period across
+         * a sweep) is computed once per bar. Each block of 1024 bars advances the
+         * graph once, then every strategy turns the shared columns into signals
+         * that are executed on its own account. Result `k` equals what
+         * @ref run(BarSeries const&, strategy::IStrategy&) returns for the
+         * equivalent stand-alone strategy.
+         *
+         * @param series Input time series of bars (OHLCV).
+         * @param strats Strategies to run (non-null, distinct objects).
+         * @return One result per strategy, in the order of @p strats.
+         */
+        std::vector<BacktestResult> runMany(BarSeries const& series,
+                                            std::span<strategy::IGraphStrategy* const> strats) const;
+
+        /**
+         * @brief Execute the backtest with a whole-series signal array.
+         *
+         * The strategy fills one signal per bar in a single call; the engine then
+         * jumps from fill to fill over that array and marks the equity curve in
+         * branch-free loops, instead of a virtual call and branchy position logic
+         * per bar. Fills, fees and equity use the same operations in the same order
+         * as @ref run(BarSeries const&, strategy::IStrategy&), so for a strategy
+         * whose signals match its `onBar()` decisions the result is bit-identical.
+         *
+         * @param series Input time series of bars (OHLCV).
+         * @param strat  Vectorized strategy.
+         * @return BacktestResult (summary plus the records selected by the record level).
+         */
+        BacktestResult runVectorized(BarSeries const& series, strategy::IVectorStrategy& strat) const;
 
     private:
         double initial_equity_;  ///< Initial equity for the backtest.
         ExecParams exec_;          ///< Execution model (commissions, slippage).
+        RecordLevel record_;       ///< Detail recorded in results.
 };
 
+template <strategy::StaticStrategy S>
+BacktestResult Engine::run(BarSeries const& series, S& strat) const {
+    BacktestResult r;
+    r.initial_equity_ = initial_equity_;
+    r.final_equity_   = initial_equity_;
+
+    detail::Account acc;
+    acc.cash = initial_equity_;
+    detail::CurveRecorder curve(initial_equity_);
+
+    // Blocks as in the virtual path: the inlined signal loop runs alone (its
+    // state stays in registers), then the fills of the block are applied.
+    using detail::BLOCK_BARS;
+    std::array<strategy::Signal, BLOCK_BARS> sig;
+    const BarColumns COLS = series.columns();
+    const bool FULL       = record_ == RecordLevel::Full;
+    if (FULL) {
+        r.equity_curve_.reserve(COLS.size());
+        r.drawdown_.reserve(COLS.size());
+    }
+
+    strat.onStart();
+    for (std::size_t b = 0; b < COLS.size(); b += BLOCK_BARS) {
+        const std::size_t LEN = std::min(BLOCK_BARS, COLS.size() - b);
+        for (std::size_t i = 0; i < LEN; ++i) sig[i] = strat.signalAt(COLS, b + i);
+        for (std::size_t i = 0; i < LEN; ++i) {
+            detail::step(acc, COLS.ts_[b + i], COLS.close_[b + i], sig[i], exec_, record_, r);
+            curve.update(r.final_equity_, record_, r);
+        }
+    }
+    strategy::finish(strat);
+
+    if (acc.has_pos) detail::liquidate(acc, series.end(), exec_, record_, r);
+    return r;
+}
+
 } // namespace qga::domain::backtest
@@ -0,0 +1,138 @@
+/**
+ * @file EngineLoop.hpp
+ * @brief Internal: per-bar account bookkeeping shared by the Engine run paths.
+ *
+ * Inline so the templated @ref Engine::run over a concrete strategy type
+ * compiles into one loop with the strategy; the virtual and vectorized paths
+ * in Engine.cpp use the same functions, which keeps all paths bit-identical.
+ * Not part of the public API.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "core/OnlineStatistics.hpp"
+#include "domain/Quote.hpp"
+#include "domain/backtest/Execution.hpp"
+#include "domain/backtest/Result.hpp"
+#include "strategy/IStrategy.hpp"
+
+namespace qga::domain::backtest::detail {
+
+/// Bars per signal block: the signal block and the hot columns stay in L1.
+inline constexpr std::size_t BLOCK_BARS = 1024;
+
+/// Simple account state: all-in 1 item; without leverage.
+struct Account {
+    bool has_pos = false;
+    double cash  = 0.0;
+    double qty   = 0.0;
+
+    // Open trade (for the ledger)
+    std::int64_t entry_ts = 0;
+    double entry_px       = 0.0;
+    double entry_fee      = 0.0;
+};
+
+/// Books the round trip closed at @p ts / @p px: hit count (Metrics) and ledger (Trades).
+inline void closeTrade(const Account& acc, std::int64_t ts, double px, double fee, RecordLevel level,
+                       BacktestResult& r) {
+    if (level == RecordLevel::Summary) return;
+    const double FEES = acc.entry_fee + fee;
+    const double PNL  = (px - acc.entry_px) * acc.qty - FEES;
+    r.hits_.push(PNL);
+    if (level >= RecordLevel::Trades) {
+        r.trades_.push_back(TradeRecord{acc.entry_ts, ts, acc.entry_px, px, acc.qty, FEES, PNL});
+    }
+}
+
+/// Executes the strategy signal for one bar and marks equity to the bar close.
+inline void step(Account& acc, std::int64_t ts, double close, strategy::Signal sig, const ExecParams& exec,
+                 RecordLevel level, BacktestResult& r) {
+    if (sig == strategy::Signal::Buy && !acc.has_pos) {
+        // Execution with delay
+        const double PX_EXEC  = applySlippage(close, exec.slippage_bps_, /*is_buy=*/true);
+        const double FEE      = commissionCost(PX_EXEC, 1.0, exec.commission_fixed_, exec.commission_bps_);
+
+        if(PX_EXEC > 0.0 && acc.cash >= (PX_EXEC + FEE)) {
+            acc.has_pos   = true;
+            acc.qty       = 1.0;
+            acc.cash      -= (PX_EXEC + FEE);
+            acc.entry_ts  = ts;
+            acc.entry_px  = PX_EXEC;
+            acc.entry_fee = FEE;
+            r.trades_executed_ += 1;
+        }
+
+    } else if (sig == strategy::Signal::Sell && acc.has_pos) {
+        const double PX_EXEC  = applySlippage(close, exec.slippage_bps_, /*is_buy=*/false);
+        const double FEE      = commissionCost(PX_EXEC, acc.qty, exec.commission_fixed_, exec.commission_bps_);
+
+        closeTrade(acc, ts, PX_EXEC, FEE, level, r);
+        acc.has_pos = false;
+        acc.cash    += PX_EXEC * acc.qty;   // income from sell
+        acc.cash    -= FEE;                 // minus commission
+        acc.qty     = 0.0;
+    }
+
+    r.final_equity_ = acc.cash + (acc.has_pos ? close * acc.qty : 0.0);
+}
+
+/// Closes an open position at the last bar once the stream has ended.
+inline void liquidate(Account& acc, const Quote& last, const ExecParams& exec, RecordLevel level,
+                      BacktestResult& r) {
+    if (!acc.has_pos) return;
+    const double PX_EXEC  = applySlippage(last.close_, exec.slippage_bps_, /*is_buy=*/false);
+    const double FEE      = commissionCost(PX_EXEC, acc.qty, exec.commission_fixed_, exec.commission_bps_);
+    closeTrade(acc, last.ts_, PX_EXEC, FEE, level, r);
+    acc.cash              += PX_EXEC * acc.qty;
+    acc.cash              -= FEE;
+    r.final_equity_ = acc.cash;
+}
+
+/**
+ * Streaming metrics of the marked equity: per-bar returns and running
+ * drawdown, starting from the initial equity.
+ */
+class CurveRecorder {
+public:
+    explicit CurveRecorder(double initial_equity) : prev_(initial_equity) { dd_.push(initial_equity); }
+
+    /// Folds one bar into the streaming metrics (RecordLevel::Metrics); returns its drawdown.
+    double mark(double equity, BacktestResult& r) {
+        // No return is defined on a non-positive base (zero initial equity, a
+        // wiped-out account); skipping it keeps inf/NaN out of the moments.
+        if (prev_ > 0.0) {
+            const double RET = equity / prev_ - 1.0;
+            r.returns_.push(RET);
+            r.downside_.push(RET);
+        }
+        prev_ = equity;
+        const double DD = dd_.push(equity);
+        r.max_drawdown_ = dd_.maxDrawdown();
+        return DD;
+    }
+
+    /// Like @ref mark(), and appends the bar to the equity and drawdown series (RecordLevel::Full).
+    void record(double equity, BacktestResult& r) {
+        const double DD = mark(equity, r);
+        r.equity_curve_.push_back(equity);
+        r.drawdown_.push_back(DD);
+    }
+
+    /// Records one bar as selected by @p level.
+    void update(double equity, RecordLevel level, BacktestResult& r) {
+        if (level == RecordLevel::Full) {
+            record(equity, r);
+        } else if (level >= RecordLevel::Metrics) {
+            mark(equity, r);
+        }
+    }
+
+private:
+    double prev_;                 ///< Equity of the previous mark.
+    core::DrawdownTracker dd_;    ///< Running peak, seeded with the initial equity.
+};
+
+} // namespace qga::domain::backtest::detail
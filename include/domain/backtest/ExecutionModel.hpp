@@ -0,0 +1,62 @@
+/**
+ * @file ExecutionModel.hpp
+ * @brief Turns orders into fills (trades) for the portfolio engine.
+ */
+
+#pragma once
+
+#include <optional>
+#include "domain/Quote.hpp"
+#include "domain/backtest/Execution.hpp"
+#include "domain/backtest/Order.hpp"
+#include "domain/backtest/Trade.hpp"
+
+namespace qga::domain::backtest {
+
+/**
+ * @class IExecutionModel
+ * @brief Contract for simulating how an @ref Order is filled against a bar.
+ */
+class IExecutionModel {
+public:
+    /**
+     * @brief Virtual destructor.
+     */
+    virtual ~IExecutionModel() = default;
+
+    /**
+     * @brief Simulates the execution of an order.
+     *
+     * @param order    Order to fill.
+     * @param bar      Bar of the order's instrument at which it is executed.
+     * @param cash     Cash available to the portfolio.
+     * @param held_qty Quantity of the instrument currently held.
+     * @return The resulting fill, or `std::nullopt` if the order cannot be executed.
+     */
+    virtual std::optional<Trade> execute(const Order& order, const domain::Quote& bar,
+                                         double cash, double held_qty) const = 0;
+};
+
+/**
+ * @class CloseExecution
+ * @brief Fills market orders at the bar close, adjusted by @ref ExecParams.
+ *
+ * Uses @ref applySlippage and @ref commissionCost like @ref Engine. Long-only:
+ * buys are rejected unless price plus fee is covered by cash, and sells are
+ * capped at the held quantity.
+ */
+class CloseExecution : public IExecutionModel {
+public:
+    /**
+     * @param exec Slippage and commission parameters.
+     */
+    explicit CloseExecution(ExecParams exec = {}) : exec_(exec) {}
+
+    std::optional<Trade> execute(const Order& order, const domain::Quote& bar,
+                                 double cash, double held_qty) const override;
+
+private:
+    ExecParams exec_;  ///< Execution costs.
+};
+
+} // namespace qga::domain::backtest
@@ -7,8 +7,8 @@
 
 #pragma once
 
-#include <unordered_map>
-#include <string>
+#include <vector>
+#include "domain/InstrumentRegistry.hpp"
 #include "domain/backtest/Position.hpp"
 #include "domain/backtest/Trade.hpp"
 
@@ -20,7 +20,10 @@ namespace qga::domain::backtest {
  * @brief Tracks position and cash state during a backtest.
  *
  * Stores and updates open positions per instrument, applies trades, and computes
- * realized PnL and cash flow. Supports multiple instruments through internal mapping.
+ * realized PnL and cash flow. Instruments are interned into dense IDs (see
+ * @ref domain::InstrumentRegistry) and positions live in a flat vector indexed
+ * by ID. Realized PnL and total value are updated incrementally, so applying a
+ * trade to a known instrument is O(1) and does not allocate.
  */
 class Portfolio {
 public:
@@ -43,16 +46,39 @@ public:
     /**
      * @brief Access or create a position for the given instrument.
      * @param ins Financial instrument.
-     * @return Reference to modifiable position.
+     * @return Read-only position (valid until the next new instrument); positions
+     *         change only through @ref applyTrade, which keeps the cached totals in sync.
      */
-    Position& getOrCreate(const domain::Instrument& ins);
+    const Position& getOrCreate(const domain::Instrument& ins);
+
+    /**
+     * @brief Returns the dense ID of an instrument, creating its (flat) position if needed.
+     * @param ins Financial instrument.
+     * @return ID usable with @ref position() and @ref applyTrade(domain::InstrumentId, const Trade&).
+     */
+    domain::InstrumentId idFor(const domain::Instrument& ins);
+
+    /**
+     * @brief Access a position by ID.
+     * @throws std::out_of_range if @p id is unknown to this portfolio.
+     */
+    const Position& position(domain::InstrumentId id) const { return positions_.at(id); }
 
     /**
      * @brief Applies a trade to the portfolio.
-     * @param t Trade to be executed (affects position, cash, PnL).
+     * @param t Trade to be executed (affects position, cash, PnL); its fee is
+     *          deducted from cash.
      */
     void applyTrade(const Trade& t);
 
+    /**
+     * @brief Applies a trade whose instrument ID is already known (O(1), no allocation).
+     * @param id ID of `t.order().instrument()`, as returned by @ref idFor().
+     * @param t  Trade to be executed.
+     * @throws std::out_of_range if @p id is unknown to this portfolio.
+     */
+    void applyTrade(domain::InstrumentId id, const Trade& t);
+
     /**
      * @brief Computes the mark-to-market value for an instrument.
      * @param ins Instrument to evaluate.
@@ -61,37 +87,25 @@ public:
      */
     double navFor(const domain::Instrument& ins, double mark_price) const;
 
-     /**
-     * @brief Returns the current total portfolio value (placeholder).
+    /**
+     * @brief Returns cash plus the cost basis of all open positions.
      *
      * @details
-     * For now, returns 0.0 until full accounting logic is implemented.
-     * In the future, should sum: cash + Σ(position.value()).
+     * Sums `cash + Σ(qty * avgPrice)`; the sum is kept up to date by
+     * @ref applyTrade, so the call is O(1). Use @ref navFor for a
+     * mark-to-market value.
      */
-    double totalValue() const noexcept{
-        double total = cash_;
-        for (const auto& kv : positions_) {
-            total += kv.second.qty() * kv.second.avgPrice();
-        }
-        return total;
-    }
+    double totalValue() const noexcept { return cash_ + cost_basis_; }
 
-private:
-    /**
-     * @brief Generates a unique key string for a given instrument.
-     * Used internally for position mapping.
-     */
-    static std::string keyFor(const domain::Instrument& ins);
+    /// @return Instruments known to the portfolio (IDs index its positions).
+    const domain::InstrumentRegistry& registry() const noexcept { return registry_; }
 
-    /**
-     * @brief Aggregates total realized PnL across all closed positions.
-     * @return Total realized profit/loss.
-     */
-    double aggregateRealized() const;
-
-    std::unordered_map<std::string, Position> positions_;   ///< Active positions by instrument.
-    double cash_{0.0};                                       ///< Available cash.
-    double realized_pnl_{0.0};                                  ///< Accumulated realized PnL.
+private:
+    domain::InstrumentRegistry registry_;   ///< Instrument -> dense ID.
+    std::vector<Position> positions_;       ///< Positions indexed by instrument ID.
+    double cash_{0.0};                      ///< Available cash.
+    double realized_pnl_{0.0};              ///< Accumulated realized PnL (sum over positions).
+    double cost_basis_{0.0};                ///< Σ(qty * avgPrice) over positions.
 };
 
 
@@ -0,0 +1,171 @@
+/**
+ * @file PortfolioEngine.hpp
+ * @brief Event-driven backtest of many instruments sharing one @ref Portfolio.
+ *
+ * The bar series of all instruments are merged by timestamp, strategies emit
+ * orders per bar, an @ref IExecutionModel turns them into @ref Trade fills and
+ * the fills are booked with @ref Portfolio::applyTrade.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <vector>
+#include "domain/Instrument.hpp"
+#include "domain/backtest/BarSeries.hpp"
+#include "domain/backtest/ExecutionModel.hpp"
+#include "domain/backtest/Order.hpp"
+#include "domain/backtest/Portfolio.hpp"
+#include "domain/backtest/Result.hpp"
+#include "domain/backtest/Trade.hpp"
+#include "strategy/IStrategy.hpp"
+
+namespace qga::domain::backtest {
+
+/**
+ * @struct InstrumentFeed
+ * @brief One instrument of the universe together with its bars.
+ */
+struct InstrumentFeed {
+    domain::Instrument instrument_;       ///< Traded instrument.
+    const BarSeries* bars_ = nullptr;     ///< Time-ordered bars (not owned; must outlive the run).
+};
+
+/**
+ * @struct OrderRequest
+ * @brief Market order emitted by a portfolio strategy.
+ */
+struct OrderRequest {
+    std::size_t instrument_ = 0;  ///< Index into the feeds passed to @ref PortfolioEngine::run.
+    Side side_ = Side::Buy;       ///< Direction.
+    double qty_ = 0.0;            ///< Quantity (> 0).
+};
+
+/**
+ * @class IPortfolioStrategy
+ * @brief Contract for strategies trading a whole universe of instruments.
+ */
+class IPortfolioStrategy {
+public:
+    /**
+     * @brief Virtual destructor.
+     */
+    virtual ~IPortfolioStrategy() = default;
+
+    /**
+     * @brief Prepare internal state. Called once before the first event.
+     * @param instruments Number of instruments in the universe.
+     */
+    virtual void onStart(std::size_t instruments) { (void)instruments; }
+
+    /**
+     * @brief Consume one bar of one instrument.
+     *
+     * @param instrument Index of the instrument (feed order).
+     * @param q          The bar.
+     * @param orders     Output: orders to execute now. Orders for the current
+     *                   instrument fill at @p q; orders for other instruments fill
+     *                   at their latest bar (and are dropped if they have none yet).
+     *                   The vector is cleared by the engine and keeps its capacity.
+     */
+    virtual void onBar(std::size_t instrument, const domain::Quote& q,
+                       std::vector<OrderRequest>& orders) = 0;
+
+    /**
+     * @brief Notification that one of the strategy's orders was filled.
+     * @param instrument Index of the instrument.
+     * @param t          The fill.
+     */
+    virtual void onFill(std::size_t instrument, const Trade& t) { (void)instrument; (void)t; }
+
+    /**
+     * @brief Cleanup or finalize strategy state. Called after the last event.
+     */
+    virtual void onFinish() {}
+};
+
+/**
+ * @class PerInstrumentStrategy
+ * @brief Runs one single-asset @ref strategy::IStrategy per instrument.
+ *
+ * `Buy` opens a position of a fixed size when flat; `Sell` closes it.
+ */
+class PerInstrumentStrategy : public IPortfolioStrategy {
+public:
+    /**
+     * @param strategies One strategy per instrument, in feed order.
+     * @param qty        Position size opened on `Buy`.
+     */
+    PerInstrumentStrategy(std::vector<std::unique_ptr<strategy::IStrategy>> strategies, double qty = 1.0)
+        : strategies_(std::move(strategies)), qty_(qty) {}
+
+    void onStart(std::size_t instruments) override;
+    void onBar(std::size_t instrument, const domain::Quote& q,
+               std::vector<OrderRequest>& orders) override;
+    void onFill(std::size_t instrument, const Trade& t) override;
+    void onFinish() override;
+
+private:
+    std::vector<std::unique_ptr<strategy::IStrategy>> strategies_;
+    std::vector<double> held_;   ///< Filled quantity per instrument.
+    double qty_;
+};
+
+/**
+ * @class PortfolioEngine
+ * @brief Backtests a universe of instruments in a single pass over merged bars.
+ *
+ * Bars are merged with a k-way heap merge on `(timestamp, feed index)`, so
+ * events are processed in time order and ties follow the feed order. The run
+ * allocates only its per-instrument state up front and books fills by dense
+ * instrument ID; processing a bar event does not touch the heap allocator
+ * (order and fill objects copy the instrument, whose short symbols stay within
+ * the small-string buffer).
+ *
+ * Positions left open after the last event are liquidated at each
+ * instrument's last bar.
+ *
+ * Example usage:
+ * @code
+ * CloseExecution exec(ExecParams{1.0, 0.0, 2.0});
+ * PortfolioEngine engine(1'000'000.0, exec);
+ * auto r = engine.run(feeds, strategy);
+ * @endcode
+ */
+class PortfolioEngine {
+public:
+    /**
+     * @param initial_equity Starting cash of the portfolio.
+     * @param exec           Execution model (referenced; must outlive the engine).
+     * @param record         Detail recorded in the result: @ref RecordLevel::Metrics
+     *                       adds the return and drawdown accumulators per distinct
+     *                       timestamp, @ref RecordLevel::Full also the equity and
+     *                       drawdown series (the trade ledger and hit counts are
+     *                       not recorded by this engine).
+     */
+    PortfolioEngine(double initial_equity, const IExecutionModel& exec,
+                    RecordLevel record = RecordLevel::Summary)
+        : initial_equity_(initial_equity), exec_(exec), record_(record) {}
+
+    /**
+     * @brief Runs the strategy over all feeds.
+     *
+     * @param feeds Universe; each feed's bars must be sorted by timestamp.
+     * @param strat Strategy receiving every bar event.
+     * @param portfolio Optional: receives the final portfolio state (after liquidation).
+     * @return Final equity and number of executed buys (as counted by @ref Engine).
+     * @throws std::invalid_argument if a feed has no bars pointer.
+     * @throws std::out_of_range if an order names an instrument outside @p feeds.
+     */
+    BacktestResult run(std::span<const InstrumentFeed> feeds, IPortfolioStrategy& strat,
+                       Portfolio* portfolio = nullptr) const;
+
+private:
+    double initial_equity_;
+    const IExecutionModel& exec_;
+    RecordLevel record_;
+};
+
+} // namespace qga::domain::backtest
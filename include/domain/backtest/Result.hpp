@@ -1,21 +1,80 @@
 /**
  * @file Result.hpp
- * @brief Backtest outcome (summary metrics).
+ * @brief Backtest outcome: summary metrics plus optional equity, drawdown and trade records.
  */
 #pragma once
 
+#include <cstdint>
+#include <vector>
+#include "core/OnlineStatistics.hpp"
+
 namespace qga::domain::backtest {
 
+/**
+ * @enum RecordLevel
+ * @brief How much detail the engine records while running.
+ *
+ * - Summary: only final equity and trade count (no per-bar work beyond the fills).
+ * - Metrics: adds the streaming metrics (return moments, downside deviation,
+ *            hit counts, max drawdown), updated in the backtest pass without
+ *            storing any series.
+ * - Trades:  adds the per-trade ledger (@ref BacktestResult::trades_).
+ * - Full:    adds the per-bar equity and drawdown series.
+ *
+ * Each level includes everything recorded by the levels before it.
+ */
+enum class RecordLevel : std::uint8_t { Summary, Metrics, Trades, Full };
+
+/**
+ * @struct TradeRecord
+ * @brief One round trip (entry and exit) of the backtest position.
+ */
+struct TradeRecord {
+    std::int64_t entry_ts_ = 0;   ///< Bar timestamp of the entry fill (epoch millis).
+    std::int64_t exit_ts_ = 0;    ///< Bar timestamp of the exit fill (last bar if liquidated).
+    double entry_price_ = 0.0;    ///< Entry fill price (after slippage).
+    double exit_price_ = 0.0;     ///< Exit fill price (after slippage).
+    double qty_ = 0.0;            ///< Position size.
+    double fee_ = 0.0;            ///< Entry plus exit commissions.
+    double pnl_ = 0.0;            ///< Net PnL: `(exit - entry) * qty - fee`.
+};
+
 /**
  * @struct BacktestResult
- * @brief Minimal backtest summary returned by the engine.
+ * @brief Backtest summary returned by the engine.
  *
- * Extend with PnL series, drawdown, Sharpe, etc. in future versions.
+ * Records are only filled at the matching @ref RecordLevel. From
+ * RecordLevel::Metrics on, Sharpe and Sortino ratios follow directly from the
+ * accumulators, e.g. `core::sortinoRatio(r.returns_, r.downside_)`.
  */
 struct BacktestResult {
     double initial_equity_ = 10000.0;    ///< Initial equity for the backtest.
     double final_equity_ = 0.0;          ///< Final equity after the backtest
     int trades_executed_ = 0;            ///< Number of trades executed during the backtest.
+
+    /// Per-bar returns of the marked equity, `equity / previous - 1`, starting
+    /// from the initial equity; bars whose previous equity is not positive are
+    /// skipped (RecordLevel::Metrics and above).
+    core::RunningMoments returns_;
+
+    /// Downside deviation of the same returns below 0 (RecordLevel::Metrics and above).
+    core::DownsideDeviation downside_;
+
+    /// Net PnL of the closed round trips, liquidation included (RecordLevel::Metrics and above).
+    core::HitCounter hits_;
+
+    /// Closed round trips, in order (RecordLevel::Trades and above).
+    std::vector<TradeRecord> trades_;
+
+    /// Mark-to-market equity after each bar, before the final liquidation (RecordLevel::Full).
+    std::vector<double> equity_curve_;
+
+    /// Drawdown after each bar: `(peak - equity) / peak` in [0, 1], where the peak
+    /// includes the initial equity (RecordLevel::Full).
+    std::vector<double> drawdown_;
+
+    /// Largest drawdown of the marked equity, i.e. of @ref drawdown_ (RecordLevel::Metrics and above).
+    double max_drawdown_ = 0.0;
 };
 
 } // namespace qga::domain::backtest
@@ -0,0 +1,167 @@
+/**
+ * @file SweepRunner.hpp
+ * @brief Parallel parameter sweeps: one strategy family over a grid of parameters.
+ *
+ * Every grid point gets its own strategy instance; all runs read the same
+ * `BarSeries` (no per-run copies) and execute on a work-stealing
+ * @ref core::ThreadPool.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include "domain/backtest/BarSeries.hpp"
+#include "domain/backtest/Engine.hpp"
+#include "domain/backtest/Result.hpp"
+#include "strategy/IGraphStrategy.hpp"
+#include "strategy/IStrategy.hpp"
+
+namespace qga::domain::backtest {
+
+/**
+ * @struct ParamRange
+ * @brief Inclusive integer range of one strategy parameter.
+ */
+struct ParamRange {
+    std::string name_;   ///< Parameter name (used in reports).
+    int first_ = 0;      ///< First value.
+    int last_ = 0;       ///< Last value (inclusive).
+    int step_ = 1;       ///< Increment (> 0).
+};
+
+/// @brief One grid point: a value for every range, in the order the ranges were added.
+using ParamPoint = std::vector<int>;
+
+/**
+ * @class ParamGrid
+ * @brief Cartesian product of @ref ParamRange objects, enumerated lazily.
+ *
+ * Example usage:
+ * @code
+ * ParamGrid grid;
+ * grid.add({"fast", 5, 50}).add({"slow", 20, 200, 5});
+ * @endcode
+ */
+class ParamGrid {
+public:
+    /**
+     * @brief Appends a dimension to the grid.
+     * @throws std::invalid_argument if the step is not positive or last < first.
+     */
+    ParamGrid& add(ParamRange range);
+
+    /// @return Number of grid points (product of the range lengths; 0 if no range).
+    std::size_t size() const noexcept;
+
+    /// @return The ranges, in insertion order.
+    const std::vector<ParamRange>& ranges() const noexcept { return ranges_; }
+
+    /**
+     * @brief Returns the @p i-th grid point (last range varies fastest).
+     * @throws std::out_of_range if @p i >= size().
+     */
+    ParamPoint point(std::size_t i) const;
+
+private:
+    std::vector<ParamRange> ranges_;
+};
+
+/**
+ * @struct SweepRow
+ * @brief Result of one grid point.
+ */
+struct SweepRow {
+    ParamPoint params_;         ///< Parameter values of the run.
+    BacktestResult result_;     ///< Engine output.
+};
+
+/**
+ * @brief Builds a fresh strategy for a grid point.
+ *
+ * Returning `nullptr` skips the point (e.g. fast >= slow for a crossover).
+ * Called concurrently from worker threads.
+ */
+using StrategyFactory = std::function<std::unique_ptr<strategy::IStrategy>(const ParamPoint&)>;
+
+/**
+ * @brief Factory for @ref strategy::MACrossover over a `(fast, slow)` grid.
+ *
+ * Expects two-dimensional points and skips combinations with fast >= slow.
+ */
+StrategyFactory maCrossoverFactory();
+
+/**
+ * @brief Builds a fresh graph-based strategy for a grid point (same contract as @ref StrategyFactory).
+ */
+using GraphStrategyFactory = std::function<std::unique_ptr<strategy::IGraphStrategy>(const ParamPoint&)>;
+
+/**
+ * @brief Graph-based factory for @ref strategy::MACrossover over a `(fast, slow)` grid.
+ *
+ * Same points and skips as @ref maCrossoverFactory(), for @ref SweepRunner::runShared.
+ */
+GraphStrategyFactory maCrossoverGraphFactory();
+
+/**
+ * @class SweepRunner
+ * @brief Runs a strategy family over every point of a @ref ParamGrid in parallel.
+ *
+ * Example usage:
+ * @code
+ * SweepRunner runner(Engine(10000.0));
+ * ParamGrid grid;
+ * grid.add({"fast", 5, 50}).add({"slow", 20, 200});
+ * auto table = runner.run(series, grid, maCrossoverFactory());
+ * // table.front() is the best combination by final equity
+ * @endcode
+ */
+class SweepRunner {
+public:
+    /**
+     * @param engine  Engine configuration shared by all runs.
+     * @param threads Worker count; 0 uses `core::Config::threads()`.
+     */
+    explicit SweepRunner(Engine engine, int threads = 0)
+        : engine_(engine), threads_(threads) {}
+
+    /**
+     * @brief Runs every grid point and ranks the results.
+     *
+     * @param series  Bars shared read-only by all runs (must not change during the call).
+     * @param grid    Parameter grid.
+     * @param factory Strategy factory (see @ref StrategyFactory).
+     * @return Rows sorted by final equity (best first); ties keep grid order.
+     *         Skipped points are not included.
+     * @throws Rethrows the first exception raised by the factory or a run.
+     */
+    std::vector<SweepRow> run(const BarSeries& series, const ParamGrid& grid,
+                              const StrategyFactory& factory) const;
+
+    /**
+     * @brief Like @ref run(), but grid points share their indicators.
+     *
+     * The grid is split into one contiguous group per worker, and each group
+     * runs through @ref Engine::runMany, so an indicator used by several points
+     * of a group (e.g. the fast SMA while the slow period varies) is computed
+     * once per bar for all of them. Produces the same rows as @ref run() with
+     * the equivalent stand-alone strategies.
+     *
+     * @param series  Bars shared read-only by all runs.
+     * @param grid    Parameter grid.
+     * @param factory Graph strategy factory (see @ref GraphStrategyFactory).
+     * @return Rows sorted by final equity (best first); ties keep grid order.
+     * @throws Rethrows the first exception raised by the factory or a run.
+     */
+    std::vector<SweepRow> runShared(const BarSeries& series, const ParamGrid& grid,
+                                    const GraphStrategyFactory& factory) const;
+
+private:
+    Engine engine_;   ///< Shared, stateless engine.
+    int threads_;     ///< Requested worker count (0 = config).
+};
+
+} // namespace qga::domain::backtest
@@ -31,6 +31,7 @@ public:
    *                          - For buy trades: `pnl = (executed_price - entry_price) * quantity`
    *                          - For sell trades: `pnl = (entry_price - executed_price) * quantity`
    *                          - If omitted or zero, `pnl()` will return 0.0.
+   * @param fee               Commission paid for the fill (currency units, >= 0).
    *
    * @throws std::invalid_argument if `executed_price` or `executed_quantity` ≤ 0.
    *
@@ -43,11 +44,13 @@ public:
         double executed_price,
         double executed_quantity,
         std::chrono::system_clock::time_point ts = std::chrono::system_clock::now(),
-        double entry_price = 0.0)
+        double entry_price = 0.0,
+        double fee = 0.0)
       : order_(order),
         price_(executed_price),
         quantity_(executed_quantity),
         entry_price_(entry_price),
+        fee_(fee),
         ts_(ts)
   {
       if (price_ <= 0.0)
@@ -81,6 +84,11 @@ public:
    */
   Side           side()     const noexcept { return order_.side(); }
 
+  /**
+   * @brief Commission paid for the fill.
+   */
+  double         fee()      const noexcept { return fee_; }
+
   /**
    * @brief Timestamp of execution.
    */
@@ -112,6 +120,7 @@ private:
   double  price_{0.0};     ///< Execution price.
   double  quantity_{0.0};  ///< Executed quantity.
   double entry_price_{0.0}; ///< Entry price from the original order.
+  double  fee_{0.0};       ///< Commission paid for the fill.
   std::chrono::system_clock::time_point ts_{}; ///< Execution timestamp.
 };
 
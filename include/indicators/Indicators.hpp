@@ -0,0 +1,123 @@
+/**
+ * @file Indicators.hpp
+ * @brief Whole-series technical indicator kernels (SMA, EMA, RSI, ATR, Bollinger, rolling min/max).
+ *
+ * Every kernel reads input columns as `std::span<const double>` (e.g.
+ * `BarSeries::closes()`) and writes one output value per input bar. Bars before
+ * an indicator is defined (the warm-up) are set to NaN.
+ *
+ * The data-parallel parts (window differences, prefix sums, true range,
+ * gain/loss split, band math) run on AVX2 or AVX-512 when the CPU supports it,
+ * selected once at runtime, with a portable scalar fallback. Pure recurrences
+ * (EMA and the Wilder smoothing of RSI/ATR) are latency-bound and stay scalar.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+
+namespace qga::indicators
+{
+
+    /**
+     * @enum SimdLevel
+     * @brief Instruction set used by the kernels.
+     */
+    enum class SimdLevel
+    {
+        Scalar, ///< Portable C++ loops.
+        AVX2,   ///< 256-bit AVX2 + FMA.
+        AVX512  ///< 512-bit AVX-512F.
+    };
+
+    /// @return The widest level supported by both the build and the running CPU.
+    SimdLevel detectSimdLevel() noexcept;
+
+    /// @return The level currently used by the kernels (initially @ref detectSimdLevel()).
+    SimdLevel simdLevel() noexcept;
+
+    /**
+     * @brief Selects the instruction set used by subsequent calls (tests, benchmarks).
+     * @param level Requested level; capped at @ref detectSimdLevel().
+     * @return The level actually selected.
+     */
+    SimdLevel setSimdLevel(SimdLevel level) noexcept;
+
+    /// @return Printable name of @p level ("scalar", "avx2", "avx512").
+    const char* toString(SimdLevel level) noexcept;
+
+    /**
+     * @brief Simple moving average.
+     *
+     * Rolls the window sum forward and re-sums the window exactly every few
+     * thousand bars, so rounding drift stays bounded on arbitrarily long series.
+     * Results of the SIMD levels may differ from the scalar one in the last bits.
+     *
+     * @param in     Input values.
+     * @param period Window length (> 0); `out[i]` is defined from `i = period - 1`.
+     * @param out    Output; same size as @p in.
+     * @throws std::invalid_argument if @p period is 0 or the sizes differ.
+     */
+    void sma(std::span<const double> in, std::size_t period, std::span<double> out);
+
+    /**
+     * @brief Exponential moving average with `alpha = 2 / (period + 1)`.
+     *
+     * Seeded with the SMA of the first @p period values at index `period - 1`.
+     *
+     * @throws std::invalid_argument if @p period is 0 or the sizes differ.
+     */
+    void ema(std::span<const double> in, std::size_t period, std::span<double> out);
+
+    /**
+     * @brief Relative Strength Index with Wilder smoothing, in [0, 100].
+     *
+     * Defined from index @p period (it needs @p period price changes). A window
+     * without losses yields 100, one without any change yields 50.
+     *
+     * @throws std::invalid_argument if @p period is 0 or the sizes differ.
+     */
+    void rsi(std::span<const double> close, std::size_t period, std::span<double> out);
+
+    /**
+     * @brief Average True Range with Wilder smoothing.
+     *
+     * True range is `max(high - low, |high - prev_close|, |low - prev_close|)`
+     * (`high - low` on the first bar). Defined from index `period - 1`.
+     *
+     * @throws std::invalid_argument if @p period is 0 or the sizes differ.
+     */
+    void atr(std::span<const double> high, std::span<const double> low, std::span<const double> close,
+             std::size_t period, std::span<double> out);
+
+    /**
+     * @brief Bollinger bands: SMA ± @p k population standard deviations.
+     *
+     * The variance is accumulated on values shifted by a per-block reference,
+     * which avoids the cancellation of `E[x²] - E[x]²` at price-like levels.
+     *
+     * @param in     Input values.
+     * @param period Window length (> 0).
+     * @param k      Band width in standard deviations.
+     * @param mid    Output: SMA.
+     * @param upper  Output: `mid + k * sd`.
+     * @param lower  Output: `mid - k * sd`.
+     * @throws std::invalid_argument if @p period is 0 or the sizes differ.
+     */
+    void bollinger(std::span<const double> in, std::size_t period, double k, std::span<double> mid,
+                   std::span<double> upper, std::span<double> lower);
+
+    /**
+     * @brief Minimum over the last @p period values (O(n) monotonic deque).
+     * @throws std::invalid_argument if @p period is 0 or the sizes differ.
+     */
+    void rollingMin(std::span<const double> in, std::size_t period, std::span<double> out);
+
+    /**
+     * @brief Maximum over the last @p period values (O(n) monotonic deque).
+     * @throws std::invalid_argument if @p period is 0 or the sizes differ.
+     */
+    void rollingMax(std::span<const double> in, std::size_t period, std::span<double> out);
+
+} // namespace qga::indicators
@@ -0,0 +1,149 @@
+/**
+ * @file BarSources.hpp
+ * @brief Streaming bar sources over CSV files, binary bar files, SQLite and HTTP.
+ *
+ * Each source implements @ref domain::backtest::IBarSource and keeps only one
+ * batch of decoded bars in memory, so histories larger than RAM can be fed to
+ * @ref domain::backtest::Engine::run(IBarSource&, strategy::IStrategy&, std::size_t).
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include "domain/backtest/BarSource.hpp"
+#include "ingest/CurlHandlePool.hpp"
+#include "io/BarFile.hpp"
+#include "io/CsvBarParser.hpp"
+
+struct sqlite3;
+
+namespace qga::persistence {
+class Statement;
+}
+
+namespace qga::ingest {
+
+/**
+ * @class CsvFileBarSource
+ * @brief Streams a CSV file through @ref io::CsvBarParser in fixed-size blocks.
+ *
+ * Rejected rows are skipped and counted in @ref stats().
+ */
+class CsvFileBarSource : public domain::backtest::IBarSource {
+public:
+    /**
+     * @param path Path to the CSV file.
+     * @throws std::runtime_error if the file cannot be opened.
+     */
+    explicit CsvFileBarSource(const std::string& path);
+
+    bool next(domain::backtest::BarSeries& batch, std::size_t max_bars) override;
+
+    /// @return Parser statistics for the rows read so far.
+    const io::CsvParseStats& stats() const noexcept { return parser_.stats(); }
+
+private:
+    std::unique_ptr<std::FILE, int (*)(std::FILE*)> file_;
+    domain::backtest::BarSeries sink_;   ///< Parser target between calls (always empty).
+    io::CsvBarParser parser_;
+    std::unique_ptr<char[]> buffer_;     ///< Read block.
+    bool eof_ = false;
+};
+
+/**
+ * @class BarFileBarSource
+ * @brief Streams a binary bar file (see io/BarFile.hpp) with batched reads.
+ */
+class BarFileBarSource : public domain::backtest::IBarSource {
+public:
+    /**
+     * @param path File written by @ref io::writeBarFile.
+     * @throws std::runtime_error if the file is missing or invalid.
+     */
+    explicit BarFileBarSource(const std::string& path) : reader_(path) {}
+
+    bool next(domain::backtest::BarSeries& batch, std::size_t max_bars) override;
+
+    /// @return Symbol stored in the file header.
+    const std::string& symbol() const noexcept { return reader_.symbol(); }
+
+private:
+    io::BarFileReader reader_;
+};
+
+/**
+ * @class SqliteBarSource
+ * @brief Streams the `quotes` table of a SQLite database for one symbol, ordered by time.
+ *
+ * Uses its own read-only connection and a single open cursor, so rows are
+ * stepped lazily instead of being loaded up front.
+ */
+class SqliteBarSource : public domain::backtest::IBarSource {
+public:
+    /**
+     * @param db_path Database file created by @ref persistence::SQLiteStore.
+     * @param symbol  Symbol to stream.
+     * @throws std::runtime_error if the database cannot be opened or queried.
+     */
+    SqliteBarSource(const std::string& db_path, const std::string& symbol);
+    ~SqliteBarSource() override;
+
+    SqliteBarSource(const SqliteBarSource&) = delete;
+    SqliteBarSource& operator=(const SqliteBarSource&) = delete;
+
+    bool next(domain::backtest::BarSeries& batch, std::size_t max_bars) override;
+
+private:
+    sqlite3* db_ = nullptr;
+    std::unique_ptr<persistence::Statement> cursor_;
+    bool done_ = false;
+};
+
+/**
+ * @class HttpBarSource
+ * @brief Streams a CSV body over HTTP, parsing it as it arrives.
+ *
+ * The transfer is driven from @ref next() through the libcurl multi interface
+ * and paused once a batch is full, so the body is never buffered as a whole.
+ * The handle is taken from @ref CurlHandlePool::shared(), so gzip/deflate
+ * bodies are decoded transparently.
+ */
+class HttpBarSource : public domain::backtest::IBarSource {
+public:
+    /**
+     * @param url Remote URL returning CSV content.
+     * @throws std::runtime_error if the transfer cannot be set up.
+     */
+    explicit HttpBarSource(const std::string& url);
+    ~HttpBarSource() override;
+
+    HttpBarSource(const HttpBarSource&) = delete;
+    HttpBarSource& operator=(const HttpBarSource&) = delete;
+
+    /**
+     * @throws std::runtime_error on transport errors or HTTP status >= 400.
+     */
+    bool next(domain::backtest::BarSeries& batch, std::size_t max_bars) override;
+
+    /// @return Parser statistics for the rows received so far.
+    const io::CsvParseStats& stats() const noexcept { return parser_.stats(); }
+
+private:
+    static std::size_t onData(char* data, std::size_t size, std::size_t nmemb, void* self);
+
+    std::string url_;
+    CurlHandlePool::Lease easy_;                    ///< Transfer handle from the shared pool.
+    CURLM* multi_ = nullptr;                        ///< Drives the transfer without blocking.
+    domain::backtest::BarSeries sink_;              ///< Parser target between calls.
+    io::CsvBarParser parser_;
+    domain::backtest::BarSeries* batch_ = nullptr;  ///< Batch being filled by onData().
+    std::size_t max_bars_ = 0;
+    long status_ = 0;                               ///< HTTP status once headers arrived.
+    bool paused_ = false;
+    bool done_ = false;
+};
+
+} // namespace qga::ingest
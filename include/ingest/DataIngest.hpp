@@ -8,17 +8,59 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstddef>
+#include <functional>
 #include <string>
 #include <optional>
 #include <memory>
+#include <vector>
 #include "utils/ILogger.hpp"
 #include "domain/backtest/BarSeries.hpp"
 #include "domain/Quote.hpp"
+#include "io/CsvBarParser.hpp"
 
 
 namespace qga::ingest {
 
 
+/**
+ * @struct HttpSymbolRequest
+ * @brief One symbol of a batch HTTP ingest and the URL serving its CSV.
+ */
+struct HttpSymbolRequest {
+    std::string symbol_;   ///< Symbol identifier (e.g. "AAPL").
+    std::string url_;      ///< URL returning the symbol's CSV.
+};
+
+/**
+ * @struct HttpSymbolResult
+ * @brief Outcome of one symbol of a batch HTTP ingest.
+ */
+struct HttpSymbolResult {
+    std::string symbol_;                                      ///< Requested symbol.
+    std::optional<qga::domain::backtest::BarSeries> series_;  ///< Parsed bars, empty on failure.
+    std::string error_;                                       ///< Failure reason (empty on success).
+    int attempts_ = 0;                                        ///< Transfers made (1 + retries).
+};
+
+/**
+ * @struct HttpBatchParams
+ * @brief Concurrency and retry settings for @ref DataIngest::fromHttpUrls().
+ *
+ * Transport errors, HTTP 429 and HTTP 5xx are retried after
+ * `initial_backoff_ * 2^(attempt - 1)`; other HTTP errors fail immediately.
+ */
+struct HttpBatchParams {
+    std::size_t max_concurrent_ = 16;                           ///< Transfers in flight at once.
+    int max_retries_ = 3;                                       ///< Retries per symbol after the first attempt.
+    std::chrono::milliseconds initial_backoff_{250};            ///< Delay before the first retry.
+    std::chrono::milliseconds timeout_{30'000};                 ///< Per-transfer timeout (0 = none).
+};
+
+/// @brief Receives each symbol's result as soon as its transfer finishes.
+using HttpSymbolCallback = std::function<void(HttpSymbolResult&&)>;
+
 /**
  * @class DataIngest
  * @brief High-level interface for ingesting market data from various sources.
@@ -34,7 +76,7 @@ namespace qga::ingest {
  * }
  * @endcode
  *
- * Future extensionts include: fromHttpUrl, fromBinaryFile, streaming ingest.
+ * Future extensionts include: streaming ingest.
  */
 class DataIngest {
 public:
@@ -48,23 +90,79 @@ public:
     /**
      * @brief Load and validate market data from a local CSV file.
      *
-     * CSV format: timestamp_ms,open,high,low,close,volume
+     * CSV format: timestamp_ms,open,high,low,close,volume (optional header).
+     * Uses the block-reading @ref io::CsvBarParser; rejected rows are logged
+     * and skipped.
      *
      * @param path Path to the CSV file on disk.
      * @return Optional BarSeries if loading and parsing succeed.
      */
     std::optional<qga::domain::backtest::BarSeries> fromCsv(const std::string& path);
 
+    /**
+     * @brief Load market data from a local CSV file using several threads.
+     *
+     * Same format and result as @ref fromCsv(), but the file is memory-mapped
+     * and parsed in newline-aligned chunks on a @ref core::ThreadPool
+     * (see @ref io::parseCsvFileParallel). Worth it for large files on a warm
+     * page cache; small files gain nothing over @ref fromCsv().
+     *
+     * @param path    Path to the CSV file on disk.
+     * @param threads Worker count; 0 uses `core::Config::threads()`.
+     * @return Optional BarSeries if loading and parsing succeed.
+     */
+    std::optional<qga::domain::backtest::BarSeries> fromCsvParallel(const std::string& path,
+                                                                    int threads = 0);
+
     /**
      * @brief Load market data from a remote CSV over HTTP.
      *
-     * Currently not fully implemented. Will be supported in v0.7.1+.
+     * Rows are parsed incrementally from the libcurl write callback, so the
+     * body is never held in memory as a whole and parsing overlaps the
+     * download. Handles come from @ref CurlHandlePool::shared() (kept-alive
+     * connections are reused) and gzip/deflate responses are decoded
+     * transparently. HTTP status codes >= 400 are treated as failures.
      *
      * @param url Remote URL returning CSV content.
      * @return Optional BarSeries if request and parsing succeed.
      */
     std::optional<qga::domain::backtest::BarSeries> fromHttpUrl(const std::string& url);
 
+    /**
+     * @brief Load many symbols over HTTP with concurrent transfers.
+     *
+     * Runs up to `params.max_concurrent_` downloads at once on one libcurl
+     * multi handle, which shares kept-alive connections (and HTTP/2
+     * multiplexing where available) across symbols. Bodies are parsed while
+     * they download, as in @ref fromHttpUrl(). Failed transfers are retried
+     * with exponential backoff (see @ref HttpBatchParams).
+     *
+     * @p on_result is called on the calling thread once per request, in
+     * completion order, so callers can start working on early symbols while
+     * the rest are still downloading.
+     *
+     * @param requests  Symbols and their URLs.
+     * @param on_result Receives every symbol's result (success or failure).
+     * @param params    Concurrency, retry and timeout settings.
+     * @return Number of symbols loaded successfully.
+     */
+    std::size_t fromHttpUrls(const std::vector<HttpSymbolRequest>& requests,
+                             const HttpSymbolCallback& on_result,
+                             const HttpBatchParams& params = {});
+
+    /**
+     * @brief Load market data from a binary bar file (see io/BarFile.hpp).
+     *
+     * The file is memory-mapped and the returned series is a zero-copy,
+     * read-only view over it; no parsing takes place.
+     *
+     * @param path Path to a file written by io::writeBarFile.
+     * @param verify_checksum Validate the column checksum (touches every page).
+     * @return Optional BarSeries view if the file is valid and non-empty.
+     */
+    std::optional<qga::domain::backtest::BarSeries> fromBinaryFile(const std::string& path,
+                                                                   bool verify_checksum = false);
+
 private:
 
     #ifdef UNIT_TEST
@@ -84,26 +182,15 @@ private:
     /**
      * @brief Parses a single CSV row into a Quote object.
      *
-     * This function converts a vector of string fields (representing one CSV line)
-     * into a `domain::Quote` instance. It validates the number of columns and
-     * attempts to parse numeric fields (OHLCV) and timestamp values.
-     *
-     * The timestamp parser supports two formats:
-     * - **Epoch milliseconds** (e.g. `1727773200000`)
-     * - **ISO 8601** date-time strings (e.g. `2024-10-01T09:00:00`)
-     *
-     * In case of invalid or malformed input (wrong number of columns,
-     * non-numeric values, parse errors), the function logs the problem and
-     * returns `std::nullopt` to indicate failure.
+     * Converts a vector of string fields (one CSV line) into a `domain::Quote`
+     * using the same field decoders as @ref io::CsvBarParser. The timestamp
+     * may be epoch milliseconds (e.g. `1727773200000`) or an ISO 8601 UTC
+     * date-time (e.g. `2024-10-01T09:00:00`).
      *
      * @param fields A vector of string fields from a single CSV line.
      * Expected order: `[timestamp, open, high, low, close, volume]`.
-     * @return `std::optional<domain::Quote>`
-     *         - A fully parsed `Quote` if successful.
-     *         - `std::nullopt` if parsing failed.
+     * @return Parsed `Quote`, or `std::nullopt` (logged) on malformed input.
      *
-     * @note This method is resilient to format variations — it automatically
-     *       detects ISO timestamps by checking for the presence of `'T'`.
      * @warning The function assumes decimal point ('.') as the float separator.
      *          Locale-specific commas (',') will cause parsing errors.
      *
@@ -111,6 +198,13 @@ private:
      */
     std::optional<domain::Quote> parseRow(const std::vector<std::string>& fields);
 
+    /**
+     * @brief Logs the rows rejected by a parse run.
+     * @param stats  Parser statistics.
+     * @param source File path or URL, used in messages.
+     */
+    void reportParseIssues(const io::CsvParseStats& stats, const std::string& source);
+
      /**
      * @brief Logger instance used for validation, error reporting and tracing.
      *
@@ -0,0 +1,130 @@
+/**
+ * @file BarFile.hpp
+ * @brief Versioned binary on-disk format for a single symbol's bar series.
+ *
+ * Layout (little-endian):
+ * @code
+ * offset 0            : BarFileHeader (64 bytes)
+ * offset 64           : ts     column, int64[count]  (padded to 64 bytes)
+ * offset 64 + 1*stride: open   column, double[count] (padded to 64 bytes)
+ * ...                   high, low, close, volume
+ * @endcode
+ *
+ * Every column starts on a 64-byte boundary, so a memory-mapped file can be
+ * consumed in place as a columnar @ref domain::backtest::BarSeries.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include "common/AlignedAllocator.hpp"
+#include "domain/backtest/BarSeries.hpp"
+
+namespace qga::io {
+
+/// @brief Magic bytes identifying a bar file ("QGABARS" + NUL).
+inline constexpr char BAR_FILE_MAGIC[8] = {'Q', 'G', 'A', 'B', 'A', 'R', 'S', '\0'};
+
+/// @brief Current on-disk format version.
+inline constexpr std::uint32_t BAR_FILE_VERSION = 1;
+
+/**
+ * @struct BarFileHeader
+ * @brief Fixed 64-byte header at the start of every bar file.
+ */
+struct BarFileHeader {
+    char magic_[8];                 ///< Must equal @ref BAR_FILE_MAGIC.
+    std::uint32_t version_;         ///< Format version (@ref BAR_FILE_VERSION).
+    std::uint32_t header_size_;     ///< sizeof(BarFileHeader); first column offset.
+    std::uint64_t bar_count_;       ///< Number of bars per column.
+    std::uint64_t column_stride_;   ///< Bytes between column starts (multiple of 64).
+    char symbol_[24];               ///< NUL-padded symbol (max 23 chars).
+    std::uint64_t checksum_;        ///< Checksum of all column bytes (incl. padding).
+};
+static_assert(sizeof(BarFileHeader) == 64, "BarFileHeader must stay 64 bytes");
+
+/**
+ * @struct BarFileContents
+ * @brief Result of mapping a bar file.
+ */
+struct BarFileContents {
+    std::string symbol_;                        ///< Symbol stored in the header.
+    domain::backtest::BarSeries series_;        ///< Zero-copy view over the mapped columns.
+};
+
+/**
+ * @brief Writes @p series for @p symbol to @p path in the binary bar format.
+ *
+ * @param path   Destination file (overwritten).
+ * @param symbol Symbol identifier (at most 23 characters).
+ * @param series Bars to store.
+ * @throws std::invalid_argument if the symbol is too long.
+ * @throws std::runtime_error on I/O errors or on big-endian hosts.
+ */
+void writeBarFile(const std::string& path, const std::string& symbol,
+                  const domain::backtest::BarSeries& series);
+
+/**
+ * @brief Memory-maps a bar file and returns a read-only series over it.
+ *
+ * No bar data is copied or parsed; the returned series keeps the mapping
+ * alive for as long as any copy of it exists.
+ *
+ * @param path            File written by @ref writeBarFile.
+ * @param verify_checksum Reads every page to validate the checksum (off by default,
+ *                        since it defeats the lazy paging of the mapping).
+ * @return Symbol and series view.
+ * @throws std::runtime_error if the file is missing, truncated, corrupt or of an
+ *         unsupported version.
+ */
+BarFileContents mapBarFile(const std::string& path, bool verify_checksum = false);
+
+/**
+ * @class BarFileReader
+ * @brief Reads a bar file sequentially in batches with plain file I/O.
+ *
+ * Unlike @ref mapBarFile(), resident memory is limited to one batch no
+ * matter how large the file is, which suits streaming backtests over
+ * histories that exceed RAM. The checksum is not verified.
+ */
+class BarFileReader {
+public:
+    /**
+     * @brief Opens @p path and validates its header.
+     * @throws std::runtime_error if the file is missing, truncated, corrupt or of an
+     *         unsupported version.
+     */
+    explicit BarFileReader(const std::string& path);
+
+    /// @return Symbol stored in the header.
+    const std::string& symbol() const noexcept { return symbol_; }
+
+    /// @return Total number of bars in the file.
+    std::size_t size() const noexcept { return static_cast<std::size_t>(header_.bar_count_); }
+
+    /// @return Bars not read yet.
+    std::size_t remaining() const noexcept { return size() - pos_; }
+
+    /**
+     * @brief Appends up to @p max_bars following bars to @p out.
+     * @return Number of bars appended (0 at end of file).
+     * @throws std::runtime_error on read errors.
+     */
+    std::size_t read(domain::backtest::BarSeries& out, std::size_t max_bars);
+
+private:
+    std::unique_ptr<std::FILE, int (*)(std::FILE*)> file_;
+    std::string path_;
+    BarFileHeader header_{};
+    std::string symbol_;
+    std::size_t pos_ = 0;                           ///< Next bar index.
+    AlignedVector<std::int64_t> ts_buf_;            ///< Scratch timestamp column.
+    std::array<AlignedVector<double>, 5> col_buf_;  ///< Scratch OHLCV columns.
+};
+
+} // namespace qga::io
@@ -0,0 +1,174 @@
+/**
+ * @file CsvBarParser.hpp
+ * @brief High-throughput OHLCV CSV parser (block reads, in-place tokenizing, no exceptions).
+ *
+ * Expected row format: `timestamp,open,high,low,close,volume`, where the timestamp
+ * is either epoch milliseconds or a fixed-format ISO-8601 UTC date-time
+ * (`YYYY-MM-DDTHH:MM:SS[.fff][Z]`). An optional header line is detected and skipped.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "domain/Quote.hpp"
+#include "domain/backtest/BarSeries.hpp"
+
+namespace qga::core {
+class ThreadPool;
+}
+
+namespace qga::io {
+
+/**
+ * @enum CsvRowError
+ * @brief Reason a CSV row was rejected.
+ */
+enum class CsvRowError {
+    None,           ///< Row parsed successfully.
+    FieldCount,     ///< Row does not have exactly six fields.
+    BadTimestamp,   ///< Timestamp is neither epoch millis nor valid ISO-8601.
+    BadNumber       ///< One of the OHLCV fields is not a valid number.
+};
+
+/// @brief Human-readable name of a @ref CsvRowError.
+const char* toString(CsvRowError err) noexcept;
+
+/**
+ * @struct CsvRowIssue
+ * @brief A rejected row: 1-based line number and the reason.
+ */
+struct CsvRowIssue {
+    std::size_t line_ = 0;                   ///< 1-based line number in the input.
+    CsvRowError error_ = CsvRowError::None;  ///< Rejection reason.
+};
+
+/**
+ * @struct CsvParseStats
+ * @brief Summary of a parse run.
+ *
+ * Only the first @ref CsvBarParser::MAX_RECORDED_ISSUES rejected rows are kept in
+ * `issues_`; `rows_bad_` counts all of them.
+ */
+struct CsvParseStats {
+    std::size_t rows_ok_ = 0;          ///< Rows appended to the output series.
+    std::size_t rows_bad_ = 0;         ///< Rows rejected.
+    bool header_skipped_ = false;      ///< True if the first line was a header.
+    std::vector<CsvRowIssue> issues_;  ///< First rejected rows (bounded).
+};
+
+/**
+ * @class CsvBarParser
+ * @brief Incremental CSV → BarSeries parser.
+ *
+ * Input is pushed in arbitrary chunks via @ref feed(); rows split across chunk
+ * boundaries are stitched internally, so the same parser serves block-wise file
+ * reads and network streams. Rows are tokenized in place with `std::string_view`
+ * and numbers are decoded with `std::from_chars`; nothing throws on bad input.
+ *
+ * Example usage:
+ * @code
+ * BarSeries series;
+ * CsvBarParser parser(series);
+ * parser.feed(chunk1);
+ * parser.feed(chunk2);
+ * parser.finish();
+ * @endcode
+ */
+class CsvBarParser {
+public:
+    /// @brief Maximum number of rejected rows recorded in @ref CsvParseStats::issues_.
+    static constexpr std::size_t MAX_RECORDED_ISSUES = 32;
+
+    /**
+     * @brief Creates a parser appending parsed rows to @p out.
+     * @param out Destination series (must outlive the parser).
+     */
+    explicit CsvBarParser(domain::backtest::BarSeries& out);
+
+    /**
+     * @brief Redirects subsequent rows to @p out.
+     *
+     * Lets a streaming reader hand out one batch at a time while the parser
+     * keeps its partial-row and header state.
+     *
+     * @param out New destination series (must outlive its use by the parser).
+     */
+    void setOutput(domain::backtest::BarSeries& out) noexcept { out_ = &out; }
+
+    /**
+     * @brief Consumes the next chunk of input.
+     * @param chunk Raw bytes; may start or end in the middle of a row.
+     */
+    void feed(std::string_view chunk);
+
+    /**
+     * @brief Flushes a trailing row that was not terminated by a newline.
+     */
+    void finish();
+
+    /// @return Statistics collected so far.
+    const CsvParseStats& stats() const noexcept { return stats_; }
+
+    /**
+     * @brief Parses a single row (without line terminator) into @p q.
+     * @return CsvRowError::None on success, otherwise the rejection reason.
+     */
+    static CsvRowError parseLine(std::string_view line, domain::Quote& q) noexcept;
+
+    /**
+     * @brief Decodes a timestamp field: epoch millis or ISO-8601 (UTC).
+     * @return True on success.
+     */
+    static bool parseTimestamp(std::string_view field, std::int64_t& epoch_ms) noexcept;
+
+    /**
+     * @brief Decodes a decimal number field (surrounding spaces allowed).
+     * @return True if the whole field is a valid number.
+     */
+    static bool parseNumber(std::string_view field, double& value) noexcept;
+
+private:
+    void processLine(std::string_view line);
+
+    domain::backtest::BarSeries* out_;  ///< Destination series.
+    CsvParseStats stats_;               ///< Running statistics.
+    std::string carry_;                 ///< Partial row carried over between chunks.
+    std::size_t line_no_ = 0;           ///< Lines seen so far.
+    bool first_line_ = true;            ///< Header detection pending.
+};
+
+/**
+ * @brief Parses a CSV file into @p out using large block reads.
+ *
+ * @param path  Path to the CSV file.
+ * @param out   Destination series (rows are appended).
+ * @param stats Optional output for parse statistics.
+ * @return False if the file cannot be opened or read, true otherwise.
+ */
+bool parseCsvFile(const std::string& path, domain::backtest::BarSeries& out,
+                  CsvParseStats* stats = nullptr);
+
+/**
+ * @brief Parses a CSV file into @p out on several threads.
+ *
+ * The file is memory-mapped and split at newline boundaries into roughly
+ * equal chunks. A first pass counts the lines of every chunk so that @p out
+ * is resized exactly once; the second pass parses each chunk straight into
+ * its own index range of the columns. Rejected rows leave gaps that are
+ * closed afterwards by shifting the following rows down, so row order always
+ * matches the file. Results are identical to @ref parseCsvFile().
+ *
+ * @param path  Path to the CSV file.
+ * @param out   Destination owning series (rows are appended).
+ * @param pool  Pool running the chunk tasks.
+ * @param stats Optional output for parse statistics.
+ * @return False if the file cannot be opened or mapped, true otherwise.
+ */
+bool parseCsvFileParallel(const std::string& path, domain::backtest::BarSeries& out,
+                          core::ThreadPool& pool, CsvParseStats* stats = nullptr);
+
+} // namespace qga::io
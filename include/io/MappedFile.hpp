@@ -0,0 +1,61 @@
+/**
+ * @file MappedFile.hpp
+ * @brief RAII read-only memory mapping of a file.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace qga::io {
+
+/**
+ * @class MappedFile
+ * @brief Maps a whole file read-only into the address space (mmap / MapViewOfFile).
+ *
+ * The mapping starts on a page boundary and stays valid until the object is
+ * destroyed. Pages are faulted in lazily by the OS, so opening a large file
+ * costs a single system call regardless of its size.
+ */
+class MappedFile {
+public:
+    /**
+     * @brief Maps @p path read-only.
+     * @param path File to map.
+     * @throws std::runtime_error if the file cannot be opened or mapped.
+     */
+    explicit MappedFile(const std::string& path);
+
+    /// @brief Unmaps the file.
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /// @return Pointer to the first byte of the mapping (nullptr for empty files).
+    const std::byte* data() const noexcept { return data_; }
+
+    /// @return Size of the mapping in bytes.
+    std::size_t size() const noexcept { return size_; }
+
+    /**
+     * @brief Hints the OS that the mapping will be read sequentially.
+     *
+     * No-op on platforms without madvise().
+     */
+    void adviseSequential() const noexcept;
+
+private:
+    void unmap() noexcept;
+
+    const std::byte* data_ = nullptr;  ///< Start of the mapping.
+    std::size_t size_ = 0;             ///< Mapping length in bytes.
+#ifdef _WIN32
+    void* mapping_ = nullptr;          ///< File mapping object handle.
+#endif
+};
+
+} // namespace qga::io
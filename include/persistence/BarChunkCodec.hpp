@@ -0,0 +1,57 @@
+/**
+ * @file BarChunkCodec.hpp
+ * @brief Compressed columnar encoding of a run of bars, stored as one BLOB per chunk.
+ *
+ * Timestamps are encoded as delta-of-deltas, so regular bar spacing costs one
+ * bit per bar. A price or volume column whose values are all short decimals
+ * (n / 10^k, k <= 8) is stored as the deltas of the scaled integers n; any
+ * other column uses the XOR scheme of Facebook's Gorilla time-series store.
+ * Both are lossless to the bit. Each column is a separate bit stream, so a
+ * reader can skip the columns it does not need.
+ *
+ * Layout (version 1):
+ * - byte 0: format version
+ * - varint: number of bars
+ * - 6 varints: byte length of the ts, open, high, low, close and volume streams
+ * - the six streams, each padded to a whole byte; a value stream starts with
+ *   its mode byte (0 = XOR, 1 = decimal, followed by the number of decimals)
+ */
+
+#pragma once
+
+#include "domain/BarColumns.hpp"
+#include "domain/backtest/BarSeries.hpp"
+#include "persistence/IDataStore.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace qga::persistence {
+
+    /**
+     * @brief Encodes @p bars into a version-1 chunk.
+     * @param bars Bars in any order (ascending order compresses best).
+     * @return Encoded bytes.
+     */
+    std::vector<std::uint8_t> encodeBarChunk(const domain::BarColumns& bars);
+
+    /**
+     * @brief Appends the bars of @p chunk with `from_ts <= ts < to_ts` to @p out.
+     *
+     * @param chunk   Bytes produced by @ref encodeBarChunk.
+     * @param out     Owning series the bars are appended to.
+     * @param fields  Columns to decode; the others are appended as 0.
+     * @param from_ts First timestamp kept.
+     * @param to_ts   First timestamp dropped.
+     * @return Number of bars appended.
+     * @throws std::runtime_error if @p chunk is truncated or of an unknown version
+     *         (@p out is left unchanged).
+     */
+    std::size_t decodeBarChunk(std::span<const std::uint8_t> chunk, domain::backtest::BarSeries& out,
+                               QuoteField fields = QuoteField::All,
+                               std::int64_t from_ts = std::numeric_limits<std::int64_t>::min(),
+                               std::int64_t to_ts = std::numeric_limits<std::int64_t>::max());
+
+} // namespace qga::persistence
@@ -7,40 +7,132 @@
 
 #include "persistence/IDataStore.hpp"
 #include "utils/ILogger.hpp"
-#include <queue>
-#include <mutex>
 #include <condition_variable>
-#include <thread>
+#include <cstddef>
+#include <deque>
 #include <functional>
-#include <atomic>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
 
 namespace qga::persistence {
 
+    /// @brief What enqueue()/submit() do when the queue is full.
+    enum class OverflowPolicy {
+        Block, ///< Wait until the worker has made room.
+        Drop   ///< Reject the new task at once.
+    };
+
+    /**
+     * @struct DatabaseWorkerOptions
+     * @brief Settings for @ref DatabaseWorker.
+     */
+    struct DatabaseWorkerOptions {
+        std::size_t capacity_ = 1024;              ///< Maximum number of queued tasks.
+        OverflowPolicy overflow_ = OverflowPolicy::Block;
+        std::size_t max_batch_ = 256;              ///< Most writes coalesced into one transaction.
+    };
+
+    /**
+     * @class DatabaseWorker
+     * @brief Runs database tasks on one background thread, in submission order.
+     *
+     * Writes (@ref enqueue) are fire-and-forget. Consecutive writes that are
+     * queued when the worker picks up work are coalesced into one write
+     * batch (IDataStore::beginWriteBatch()), so a burst costs one commit
+     * instead of one per task; a failing write only undoes its own rows.
+     * Reads (@ref submit) run on their own, after every write queued before
+     * them has been committed, and return their result through a future.
+     *
+     * The queue is bounded; @ref OverflowPolicy decides whether producers
+     * wait or the task is rejected. @ref stop() runs every accepted task
+     * before it returns.
+     *
+     * Example usage:
+     * @code
+     * DatabaseWorker worker(std::make_unique<SQLiteStore>("qga.db"), logger);
+     * worker.enqueue([quotes](IDataStore& s) { s.saveQuotes("AAPL", quotes); });
+     * auto bars = worker.submit([](IDataStore& s) { return s.loadQuotes("AAPL"); });
+     * use(bars.get());
+     * @endcode
+     */
     class DatabaseWorker {
     public:
         using Task = std::function<void(IDataStore&)>;
 
+        /// @brief Starts the worker thread, which owns @p store from now on.
+        /// @throws std::invalid_argument if capacity_ or max_batch_ is 0.
         DatabaseWorker(std::unique_ptr<IDataStore> store,
-                       std::shared_ptr<utils::ILogger> logger);
+                       std::shared_ptr<utils::ILogger> logger,
+                       const DatabaseWorkerOptions& options = {});
+
+        /// @brief Runs the remaining tasks and joins the worker thread.
         ~DatabaseWorker();
 
-        /// @brief Enqueue a database task (executed in background).
-        void enqueue(Task task);
+        DatabaseWorker(const DatabaseWorker&) = delete;
+        DatabaseWorker& operator=(const DatabaseWorker&) = delete;
+
+        /**
+         * @brief Enqueue a write task (executed in background, possibly batched).
+         *
+         * Exceptions thrown by @p task are logged.
+         * @return False if the task was rejected (queue full under
+         *         OverflowPolicy::Drop, or the worker is stopped).
+         */
+        bool enqueue(Task task);
 
-        /// @brief Gracefully stop worker thread.
+        /**
+         * @brief Enqueue a read task and get its result.
+         * @param fn Callable taking `IDataStore&`.
+         * @return Future holding the result, the exception thrown by @p fn, or
+         *         std::runtime_error if the task was rejected.
+         */
+        template <typename Fn>
+        auto submit(Fn&& fn) -> std::future<std::invoke_result_t<Fn&, IDataStore&>> {
+            using R = std::invoke_result_t<Fn&, IDataStore&>;
+            auto task = std::make_shared<std::packaged_task<R(IDataStore&)>>(std::forward<Fn>(fn));
+            auto fut = task->get_future();
+            if (!push([task](IDataStore& store) { (*task)(store); }, false)) {
+                std::promise<R> rejected;
+                rejected.set_exception(std::make_exception_ptr(
+                    std::runtime_error("DatabaseWorker: task rejected (queue full or stopped)")));
+                return rejected.get_future();
+            }
+            return fut;
+        }
+
+        /// @brief Stop accepting tasks, run every queued task and join the worker thread.
         void stop();
 
+        /// @return Number of tasks rejected so far.
+        std::size_t rejected() const;
+
     private:
+        struct Job {
+            Task task_;
+            bool write_ = true;
+        };
+
+        bool push(Task task, bool write);
         void run();
+        void runBatch(std::vector<Job>& batch);
 
         std::unique_ptr<IDataStore> store_;
         std::shared_ptr<utils::ILogger> logger_;
+        DatabaseWorkerOptions options_;
 
-        std::queue<Task> tasks_;
-        std::mutex mutex_;
-        std::condition_variable cv_;
+        std::deque<Job> jobs_;
+        mutable std::mutex mutex_;
+        std::condition_variable cv_;    ///< Signals new jobs / shutdown to the worker.
+        std::condition_variable space_; ///< Signals free queue slots to blocked producers.
         std::thread worker_;
-        std::atomic<bool> running_{true};
+        std::mutex join_mutex_;         ///< Lets concurrent stop() calls all wait for the drain.
+        bool stopping_ = false;         ///< Set by stop(); guarded by mutex_.
+        std::size_t rejected_ = 0;
     };
 
 } // namespace qga::persistence
@@ -9,13 +9,69 @@
 
 #include "domain/Quote.hpp"
 #include "domain/backtest/BarSeries.hpp"
+#include "domain/backtest/BarSource.hpp"
 #include "domain/backtest/Portfolio.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <memory>
 #include <string>
 #include <vector>
 
 namespace qga::persistence {
 
+    /**
+     * @enum QuoteField
+     * @brief Price/volume columns of a quote, combinable with `|` to project a query.
+     *
+     * The timestamp is always read.
+     */
+    enum class QuoteField : unsigned {
+        Open   = 1u << 0,
+        High   = 1u << 1,
+        Low    = 1u << 2,
+        Close  = 1u << 3,
+        Volume = 1u << 4,
+        All    = Open | High | Low | Close | Volume,
+    };
+
+    constexpr QuoteField operator|(QuoteField a, QuoteField b) noexcept {
+        return static_cast<QuoteField>(static_cast<unsigned>(a) | static_cast<unsigned>(b));
+    }
+
+    /// @return True if @p field is part of @p fields.
+    constexpr bool hasField(QuoteField fields, QuoteField field) noexcept {
+        return (static_cast<unsigned>(fields) & static_cast<unsigned>(field)) != 0;
+    }
+
+    /**
+     * @struct QuoteQuery
+     * @brief Window and columns of a quote query.
+     *
+     * Rows are always returned in ascending time order. Fields left out of
+     * @ref fields_ are zero in the results.
+     *
+     * Example usage:
+     * @code
+     * QuoteQuery q;
+     * q.from_ts_ = day_start;            // [day_start, day_end)
+     * q.to_ts_   = day_end;
+     * q.fields_  = QuoteField::Close;    // close-only
+     * auto quotes = store.loadQuotes("AAPL", q);
+     *
+     * QuoteQuery last;                   // the latest 100 bars
+     * last.limit_ = 100;
+     * last.last_  = true;
+     * @endcode
+     */
+    struct QuoteQuery {
+        std::int64_t from_ts_ = std::numeric_limits<std::int64_t>::min(); ///< First timestamp included.
+        std::int64_t to_ts_   = std::numeric_limits<std::int64_t>::max(); ///< First timestamp excluded.
+        std::size_t limit_    = 0;     ///< Maximum number of rows (0 = no limit).
+        bool last_            = false; ///< With limit_: the latest rows of the window instead of the earliest.
+        QuoteField fields_    = QuoteField::All; ///< Columns to read.
+    };
+
     /**
      * @class IDataStore
      * @brief Abstract interface for data storage operations.
@@ -38,14 +94,41 @@ namespace qga::persistence {
         /// @return Vector of Quote objects loaded from the store.
         virtual std::vector<domain::Quote> loadQuotes(const std::string& symbol) = 0;
 
+        /// @brief Load the quotes of @p symbol selected by @p query.
+        /// @param symbol Symbol identifier (e.g. "AAPL").
+        /// @param query Time window, row limit and columns to read.
+        /// @return Matching quotes in ascending time order.
+        virtual std::vector<domain::Quote> loadQuotes(const std::string& symbol, const QuoteQuery& query) = 0;
+
+        /// @brief Open a cursor over the quotes of @p symbol selected by @p query.
+        ///
+        /// The cursor fills caller-owned @ref domain::backtest::BarSeries batches
+        /// directly, so a window is never materialized as a whole and can be fed
+        /// to @ref domain::backtest::Engine::run(IBarSource&, strategy::IStrategy&, std::size_t).
+        /// @param symbol Symbol identifier (e.g. "AAPL").
+        /// @param query Time window, row limit and columns to read.
+        /// @return Cursor that must not outlive the store.
+        virtual std::unique_ptr<domain::backtest::IBarSource> openQuotes(const std::string& symbol,
+                                                                        const QuoteQuery& query = {}) = 0;
+
         /// @brief Save a BarSeries to the data store.
-        /// @param series BarSeries object to save.
-        virtual void saveBarSeries(const qga::domain::backtest::BarSeries& series) = 0;
+        ///
+        /// Bars replace stored bars of the same symbol, timeframe and timestamp;
+        /// other stored bars are kept.
+        /// @param symbol Symbol identifier (e.g. "AAPL").
+        /// @param timeframe Bar length, e.g. "1m", "1h", "1d".
+        /// @param series Bars with strictly increasing timestamps.
+        virtual void saveBarSeries(const std::string& symbol, const std::string& timeframe,
+                                   const qga::domain::backtest::BarSeries& series) = 0;
 
-        /// @brief Load a BarSeries for a given symbol from the data store.
+        /// @brief Load a BarSeries for a given symbol and timeframe from the data store.
         /// @param symbol Symbol identifier (e.g. "AAPL").
-        /// @return BarSeries object loaded from the store.
-        virtual qga::domain::backtest::BarSeries loadBarSeries(const std::string& symbol) = 0;
+        /// @param timeframe Bar length, as passed to saveBarSeries().
+        /// @param query Time window, row limit and columns to read.
+        /// @return BarSeries object loaded from the store (empty if none).
+        virtual qga::domain::backtest::BarSeries loadBarSeries(const std::string& symbol,
+                                                               const std::string& timeframe,
+                                                               const QuoteQuery& query = {}) = 0;
 
         /// @brief Save a Portfolio to the data store.
         /// @param portfolio Portfolio object to save.
@@ -56,6 +139,19 @@ namespace qga::persistence {
         /// @return Portfolio object loaded from the store.
         virtual qga::domain::backtest::Portfolio loadPortfolio(int portfolio_id) = 0;
 
+        /// @brief Open a write batch: the following save calls share one transaction.
+        ///
+        /// A save call that fails inside the batch undoes only its own writes.
+        /// Nothing of the batch is visible to other connections until
+        /// commitWriteBatch(). Stores without transactions keep the no-op default.
+        virtual void beginWriteBatch() {}
+
+        /// @brief Commit the open write batch.
+        virtual void commitWriteBatch() {}
+
+        /// @brief Discard the open write batch (no-op if none is open).
+        virtual void rollbackWriteBatch() noexcept {}
+
         // Additional methods for trades, transactions, etc. can be added here
     };
 
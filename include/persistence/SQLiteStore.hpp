@@ -4,26 +4,60 @@
  *
  * Provides persistence using a local SQLite database file.
  * Manages connection lifecycle and executes SQL queries for quotes, bar series, portfolios.
+ *
+ * Quotes are keyed by `(symbol_id, ts)` in a WITHOUT ROWID table, with the
+ * symbol names in a `symbols` dimension table (see
+ * sql/migrations/004_quote_symbols.sql); databases with the older TEXT-keyed
+ * `quotes` table are migrated when opened. The view `quotes_by_symbol`
+ * exposes the old column layout for ad-hoc queries. Bar series are stored
+ * as compressed columnar chunks in `bar_chunks` (005_bar_chunks.sql).
+ *
+ * Writes go through one connection, serialized by a mutex. Reads use a
+ * read-only connection per calling thread, so concurrent loads of
+ * different symbols do not queue behind each other (WAL readers work on
+ * their own snapshot). In-memory databases cannot be shared between
+ * connections; there reads fall back to the write connection.
  */
 
 #pragma once
 
 #include "persistence/IDataStore.hpp"
+#include "persistence/StatementCache.hpp"
 #include "utils/ILogger.hpp"
 #include <sqlite3.h>
+#include <atomic>
+#include <cstdint>
 #include <string>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <unordered_map>
 
 struct sqlite3; // forward declaration
 
 namespace qga::persistence {
 
+    /**
+     * @struct BulkLoadOptions
+     * @brief Settings for @ref SQLiteStore::beginBulkLoad.
+     */
+    struct BulkLoadOptions {
+        int cache_mib_ = 256;        ///< Page cache of the connection while loading (MiB).
+
+        /// Stage rows in an unindexed temporary table and merge them into
+        /// `quotes` in key order at @ref SQLiteStore::endBulkLoad. Pays off for
+        /// input that is not already sorted by (symbol, ts).
+        bool defer_index_ = false;
+    };
+
     /**
      * @class SQLiteStore
      * @brief SQLite-based implementation of IDataStore.
      *
      * Uses SQLite C API to store and retrieve financial data.
-     * Ensures thread safety and efficient connection management.
+     * All methods may be called from any thread. Each connection keeps its
+     * prepared statements in a @ref StatementCache.
      */
     class SQLiteStore : public IDataStore {
     public:
@@ -32,26 +66,148 @@ namespace qga::persistence {
         explicit SQLiteStore(const std::string& db_path,
                                 std::shared_ptr<utils::ILogger> logger = nullptr); //DI
 
-        /// @brief Destructor closes the database connection.
+        /// @brief Destructor closes the write connection and every read connection.
         ~SQLiteStore() override;
 
         // --- IDataStore interface implementation ---
 
+        /// @brief Upserts @p quotes (a later quote replaces an earlier one with the same ts).
+        ///
+        /// Rows are written with multi-row INSERT statements, in one
+        /// transaction per call, in the open write batch or in the open bulk load.
         void saveQuotes(const std::string& symbol, const std::vector<domain::Quote>& quotes) override;
+
+        /// @brief Quotes of @p symbol in time order, read on the calling thread's connection.
+        ///
+        /// Sees committed data only: rows of an open bulk load become visible
+        /// at @ref endBulkLoad() (except for in-memory databases).
         std::vector<domain::Quote> loadQuotes(const std::string& symbol) override;
-        void saveBarSeries(const qga::domain::backtest::BarSeries& series) override;
-        qga::domain::backtest::BarSeries loadBarSeries(const std::string& symbol) override;
+
+        /// @brief Quotes of @p symbol selected by @p query (same visibility as above).
+        ///
+        /// The window, limit and column list are evaluated by SQLite on the
+        /// (symbol_id, ts) key, so only the selected rows are read.
+        std::vector<domain::Quote> loadQuotes(const std::string& symbol, const QuoteQuery& query) override;
+
+        /// @brief Cursor over the quotes of @p symbol selected by @p query.
+        ///
+        /// Each batch is one keyset query on the calling thread's read
+        /// connection (`ts` greater than the last bar handed out), so no
+        /// statement or read snapshot stays open between batches and the
+        /// cursor may move between threads. Rows committed in the unread part
+        /// of the window while the cursor is open are included.
+        std::unique_ptr<domain::backtest::IBarSource> openQuotes(const std::string& symbol,
+                                                                const QuoteQuery& query = {}) override;
+
+        /// @brief Stores @p series as compressed chunks (see BarChunkCodec.hpp), one per time partition.
+        ///
+        /// A partition spans a UTC day for bars shorter than an hour, 64 days
+        /// for hourly bars and 2048 days for daily and longer bars. Partitions
+        /// that already hold bars are decoded, merged and rewritten. Runs in
+        /// one transaction, in the open write batch or in the open bulk load.
+        /// @throws std::invalid_argument for an unknown timeframe or unsorted timestamps.
+        void saveBarSeries(const std::string& symbol, const std::string& timeframe,
+                           const qga::domain::backtest::BarSeries& series) override;
+
+        /// @brief Fetches the chunks overlapping the window of @p query in order and decodes them.
+        /// @throws std::invalid_argument for an unknown timeframe.
+        qga::domain::backtest::BarSeries loadBarSeries(const std::string& symbol, const std::string& timeframe,
+                                                       const QuoteQuery& query = {}) override;
         void savePortfolio(const qga::domain::backtest::Portfolio& portfolio) override;
         qga::domain::backtest::Portfolio loadPortfolio(int portfolio_id) override;
 
+        // --- Bulk ingest ---
+
+        /**
+         * @brief Enters bulk-load mode for a series of @ref saveQuotes calls.
+         *
+         * Opens one transaction for all following writes, switches the
+         * connection to `synchronous=NORMAL` (safe with the WAL journal: a
+         * crash can only lose the last commit) and enlarges the page cache.
+         * Everything loaded is committed by @ref endBulkLoad(); if a write
+         * fails, the whole load is rolled back and bulk mode ends.
+         *
+         * Example usage:
+         * @code
+         * store.beginBulkLoad({.cache_mib_ = 512, .defer_index_ = true});
+         * for (const auto& [symbol, quotes] : batches) store.saveQuotes(symbol, quotes);
+         * store.endBulkLoad();
+         * @endcode
+         *
+         * @throws std::logic_error if a bulk load or write batch is already open.
+         * @throws std::runtime_error on SQLite errors.
+         */
+        void beginBulkLoad(const BulkLoadOptions& options = {});
+
+        /**
+         * @brief Merges staged rows (if any), commits and restores the connection settings.
+         * @throws std::logic_error if no bulk load is open.
+         * @throws std::runtime_error on SQLite errors (the load is rolled back).
+         */
+        void endBulkLoad();
+
+        /// @return True between @ref beginBulkLoad() and @ref endBulkLoad().
+        bool inBulkLoad() const noexcept { return bulk_.load(); }
+
+        // --- Write batches ---
+
+        /// @brief Opens one transaction for the following save calls; each call
+        ///        runs in a SAVEPOINT, so a failed call undoes only its own rows.
+        /// @throws std::logic_error if a write batch or bulk load is already open.
+        void beginWriteBatch() override;
+
+        /// @brief Commits the write batch.
+        /// @throws std::logic_error if no write batch is open.
+        /// @throws std::runtime_error on SQLite errors (the batch is rolled back).
+        void commitWriteBatch() override;
+
+        void rollbackWriteBatch() noexcept override;
+
     private:
-        sqlite3* db_ = nullptr; ///< raw pointer managed internally (RAII in ctor/dtor)
+        struct ReadConnection; ///< Read-only connection and its statements, one per thread
+        class QuoteCursor;     ///< Implementation of openQuotes()
+
         std::string db_path_; ///< Path to SQLite database file
         std::shared_ptr<utils::ILogger> logger_; ///< Optional logger for diagnostics, DI
+        sqlite3* db_ = nullptr; ///< Write connection; raw pointer managed internally (RAII in ctor/dtor)
+        StatementCache statements_; ///< Prepared statements of db_
+        bool shared_reads_ = false; ///< In-memory database: reads use db_
+
+        std::mutex write_mtx_; ///< Serializes use of db_ (transactions span several statements)
+        std::shared_mutex readers_mtx_; ///< Guards the map below, not the connections
+        std::unordered_map<std::thread::id, std::unique_ptr<ReadConnection>> readers_;
+        std::unordered_map<std::string, std::int64_t> symbol_ids_; ///< Cache of symbols.id by name
+        std::atomic<bool> bulk_ = false; ///< Bulk load open (set under write_mtx_, read lock-free by inBulkLoad())
+        bool staged_ = false; ///< Bulk rows go to temp.bulk_quotes
+        bool batch_ = false;  ///< Write batch open
+        int saved_synchronous_ = 2; ///< Settings restored by endBulkLoad()
+        int saved_cache_size_ = -2000;
+
+        void initSchema(); ///< Create tables if they do not exist, migrate older layouts
+        std::int64_t symbolId(const std::string& symbol); ///< Id of @p symbol, inserted on first use
+        ReadConnection& readConnection(); ///< Connection of the calling thread, opened on first use
+
+        /// Calls @p fn with the statement cache of the connection reads should use.
+        template <typename Fn> decltype(auto) withReader(Fn&& fn);
+
+        /// Passes up to @p limit (0 = all) quotes of @p symbol in `[from, to)` to @p emit.
+        /// @return Number of quotes read.
+        template <typename Emit>
+        std::size_t readRange(const std::string& symbol, std::int64_t from, std::int64_t to,
+                              std::size_t limit, QuoteField fields, Emit&& emit);
+
+        /// First timestamp of the last @p count quotes in `[from, to)`, or @p from if there are fewer.
+        std::int64_t lastRangeStart(const std::string& symbol, std::int64_t from, std::int64_t to,
+                                    std::size_t count);
+        void writeBars(std::int64_t symbol_id, const std::string& timeframe,
+                       const qga::domain::backtest::BarSeries& series);
+        void writeQuotes(std::int64_t symbol_id, const std::vector<domain::Quote>& quotes, bool staged);
+        void abortBulkLoad() noexcept; ///< Roll back and leave bulk mode after a failure
 
-        void initSchema(); ///< Create tables if they do not exist
-        void open(const std::string& db_file); ///< Open DB connection
-        void close(); ///< Close DB connection
+        // Transaction of one save call: BEGIN/COMMIT, or a SAVEPOINT inside a write batch.
+        void beginWrite();
+        void commitWrite();
+        void rollbackWrite() noexcept;
     };
 
 } // namespace qga::persistence
@@ -10,6 +10,7 @@
 #include <sqlite3.h>
 #include <string>
 #include <cstdint>
+#include <span>
 
 namespace qga::persistence {
 
@@ -43,6 +44,8 @@ namespace qga::persistence {
         void bindInt64(int index, int64_t value);
         void bindDouble(int index, double value);
         void bindText(int index, const std::string& value);
+        /// @note The bytes are not copied: @p value must stay valid until the statement is reset.
+        void bindBlob(int index, std::span<const std::uint8_t> value);
         void bindNull(int index);
 
         // ==== Stepping ====
@@ -59,10 +62,15 @@ namespace qga::persistence {
         sqlite3_int64 getColumnInt64(int col) const;
         double getColumnDouble(int col) const;
         const char* getColumnText(int col) const;
+        /// @note Valid until the next step or reset.
+        std::span<const std::uint8_t> getColumnBlob(int col) const;
 
         /// @brief Reset statement so it can be re-executed.
         void reset();
 
+        /// @brief Like reset(), but ignores the error of a failed last step (for cleanup paths).
+        void release() noexcept;
+
         /// @brief Execute a raw DDL (CREATE, DROP, ALTER...).
         static void execDdl(sqlite3* database, const char* sql);
 
@@ -0,0 +1,85 @@
+/**
+ * @file StatementCache.hpp
+ * @brief Prepared statements of one SQLite connection, keyed by SQL text.
+ *
+ * Preparing a statement parses and plans its SQL, which can cost more than
+ * running it on a small table. The cache prepares each distinct SQL text
+ * once per connection and hands it out again on later calls.
+ */
+
+#pragma once
+
+#include "persistence/Statement.hpp"
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace qga::persistence {
+
+    /**
+     * @class StatementCache
+     * @brief Lazily prepared, reusable statements for one connection.
+     *
+     * Not thread-safe: like the connection it belongs to, a cache is used by
+     * one thread at a time. SQL texts should come from a fixed set (no
+     * values spliced into the text), since entries are only dropped by
+     * erase() and clear().
+     *
+     * Example usage:
+     * @code
+     * StatementCache cache(db);
+     * auto sel = cache.acquire("SELECT id FROM symbols WHERE name = ?;");
+     * sel->bindText(1, "AAPL");
+     * if (sel->stepRow()) id = sel->getColumnInt64(0);
+     * // the lease resets the statement when it goes out of scope
+     * @endcode
+     */
+    class StatementCache {
+    public:
+        /**
+         * @class Lease
+         * @brief Access to a cached statement; resets it and clears its bindings on destruction.
+         *
+         * Resetting matters for SELECTs: a statement left mid-result keeps its
+         * read transaction (and WAL snapshot) open.
+         */
+        class Lease {
+        public:
+            explicit Lease(Statement& statement) noexcept : statement_(&statement) {}
+            ~Lease() { if (statement_) statement_->release(); }
+
+            Lease(const Lease&) = delete;
+            Lease& operator=(const Lease&) = delete;
+            Lease(Lease&& other) noexcept : statement_(other.statement_) { other.statement_ = nullptr; }
+            Lease& operator=(Lease&&) = delete;
+
+            Statement* operator->() const noexcept { return statement_; }
+            Statement& operator*() const noexcept { return *statement_; }
+
+        private:
+            Statement* statement_;
+        };
+
+        /// @param db Connection the statements are prepared on; must outlive the cache.
+        explicit StatementCache(sqlite3* db) noexcept : db_(db) {}
+
+        /// @brief Statement for @p sql, prepared on first use.
+        /// @throws std::runtime_error if preparing fails (nothing is cached then).
+        Lease acquire(const std::string& sql);
+
+        /// @brief Finalizes the statement for @p sql, if cached (e.g. before dropping a table it uses).
+        void erase(const std::string& sql) noexcept { statements_.erase(sql); }
+
+        /// @brief Finalizes every statement (required before closing the connection).
+        void clear() noexcept { statements_.clear(); }
+
+        /// @return Number of cached statements.
+        std::size_t size() const noexcept { return statements_.size(); }
+
+    private:
+        sqlite3* db_;
+        std::unordered_map<std::string, std::unique_ptr<Statement>> statements_;
+    };
+
+} // namespace qga::persistence
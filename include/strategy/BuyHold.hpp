@@ -3,7 +3,9 @@
  * @brief Baseline strategy: buy once at the beginning and hold.
  */
 #pragma once
+#include <cstddef>
 #include "strategy/IStrategy.hpp"
+#include "strategy/IVectorStrategy.hpp"
 
 namespace qga::strategy {
 
@@ -14,9 +16,10 @@ namespace qga::strategy {
  * A simple benchmark strategy that performs a single buy on the first
  * available quote and then holds the position until the end.
  *
- * Implements the @ref IStrategy interface.
+ * Implements the @ref IStrategy and @ref IVectorStrategy interfaces, and is a
+ * @ref StaticStrategy through @ref signalAt.
  */
-class BuyHold final: public IStrategy {
+class BuyHold final: public IStrategy, public IVectorStrategy {
 public:
     /**
      * @brief Called once before the backtest begins.
@@ -33,11 +36,30 @@ public:
      */
     Signal onBar(const domain::Quote& q) override;
 
+    /**
+     * @brief Batched @ref onBar(): Buy at the very first bar of the stream only.
+     */
+    void onBars(const domain::BarColumns& bars, std::span<Signal> out) override;
+
     /**
      * @brief Called once after the backtest ends.
      */
     void onFinish() override;
 
+    /**
+     * @brief Buy on the first bar, None elsewhere (see @ref IVectorStrategy).
+     */
+    void signals(const domain::BarColumns& cols, std::span<Signal> out) override;
+
+    /**
+     * @brief Buy on the first bar of the run, None afterwards (see @ref StaticStrategy).
+     */
+    Signal signalAt(const domain::BarColumns&, std::size_t) {
+        if (has_bought_) return Signal::None;
+        has_bought_ = true;
+        return Signal::Buy;
+    }
+
     private:
         bool has_bought_ = false;  ///< Flag to track if a buy has been made.
 };
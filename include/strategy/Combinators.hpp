@@ -0,0 +1,155 @@
+/**
+ * @file Combinators.hpp
+ * @brief Compile-time composition of @ref StaticStrategy rules and @ref BarFilter predicates.
+ *
+ * Every combinator is itself a static strategy, so nested rules such as
+ * `Filtered(And(MACrossover(10, 50), other), VolumeFilter(1e5))` collapse into
+ * a single inlined loop inside the templated `Engine::run`.
+ *
+ * All operands are evaluated on every bar (no short-circuit), so stateful
+ * operands such as moving averages never skip a bar.
+ */
+#pragma once
+#include <cstddef>
+#include <utility>
+#include "domain/BarColumns.hpp"
+#include "strategy/StaticStrategy.hpp"
+
+namespace qga::strategy {
+
+/**
+ * @class And
+ * @brief Emits a signal only when both operands emit that same signal at the bar.
+ */
+template <StaticStrategy A, StaticStrategy B>
+class And {
+public:
+    And(A a, B b) : a_(std::move(a)), b_(std::move(b)) {}
+
+    void onStart() {
+        a_.onStart();
+        b_.onStart();
+    }
+
+    Signal signalAt(const domain::BarColumns& bars, std::size_t i) {
+        const Signal X = a_.signalAt(bars, i);
+        const Signal Y = b_.signalAt(bars, i);
+        return X == Y ? X : Signal::None;
+    }
+
+    void onFinish() {
+        finish(a_);
+        finish(b_);
+    }
+
+private:
+    A a_;
+    B b_;
+};
+
+/**
+ * @class Or
+ * @brief Emits the signal of either operand; conflicting Buy/Sell at the same bar cancel out.
+ */
+template <StaticStrategy A, StaticStrategy B>
+class Or {
+public:
+    Or(A a, B b) : a_(std::move(a)), b_(std::move(b)) {}
+
+    void onStart() {
+        a_.onStart();
+        b_.onStart();
+    }
+
+    Signal signalAt(const domain::BarColumns& bars, std::size_t i) {
+        const Signal X = a_.signalAt(bars, i);
+        const Signal Y = b_.signalAt(bars, i);
+        if (X == Signal::None) return Y;
+        if (Y == Signal::None || Y == X) return X;
+        return Signal::None;
+    }
+
+    void onFinish() {
+        finish(a_);
+        finish(b_);
+    }
+
+private:
+    A a_;
+    B b_;
+};
+
+/**
+ * @class Not
+ * @brief Inverts the operand: Buy becomes Sell and Sell becomes Buy.
+ */
+template <StaticStrategy A>
+class Not {
+public:
+    explicit Not(A a) : a_(std::move(a)) {}
+
+    void onStart() { a_.onStart(); }
+
+    Signal signalAt(const domain::BarColumns& bars, std::size_t i) {
+        switch (a_.signalAt(bars, i)) {
+            case Signal::Buy:  return Signal::Sell;
+            case Signal::Sell: return Signal::Buy;
+            case Signal::None: break;
+        }
+        return Signal::None;
+    }
+
+    void onFinish() { finish(a_); }
+
+private:
+    A a_;
+};
+
+/**
+ * @class Filtered
+ * @brief Drops the operand's Buy signals on bars the filter rejects.
+ *
+ * Only entries are gated: a Sell always goes through, so a filter can never
+ * trap an open position.
+ */
+template <StaticStrategy S, BarFilter F>
+class Filtered {
+public:
+    Filtered(S s, F f) : s_(std::move(s)), f_(std::move(f)) {}
+
+    void onStart() {
+        s_.onStart();
+        f_.onStart();
+    }
+
+    Signal signalAt(const domain::BarColumns& bars, std::size_t i) {
+        const Signal X  = s_.signalAt(bars, i);
+        const bool PASS = f_.passAt(bars, i);
+        return (X == Signal::Buy && !PASS) ? Signal::None : X;
+    }
+
+    void onFinish() { finish(s_); }
+
+private:
+    S s_;
+    F f_;
+};
+
+/**
+ * @class VolumeFilter
+ * @brief Passes bars whose volume is at least a threshold.
+ */
+class VolumeFilter {
+public:
+    /// @param min_volume Minimum bar volume.
+    explicit VolumeFilter(double min_volume) : min_volume_(min_volume) {}
+
+    void onStart() {}
+
+    bool passAt(const domain::BarColumns& bars, std::size_t i) const { return bars.volume_[i] >= min_volume_; }
+
+private:
+    double min_volume_;
+};
+
+} // namespace qga::strategy
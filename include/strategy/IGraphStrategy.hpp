@@ -0,0 +1,59 @@
+/**
+ * @file IGraphStrategy.hpp
+ * @brief Strategy interface reading its indicators from a shared @ref IndicatorGraph.
+ */
+#pragma once
+#include <span>
+#include "domain/BarColumns.hpp"
+#include "strategy/IStrategy.hpp"
+#include "strategy/IndicatorGraph.hpp"
+
+namespace qga::strategy {
+
+/**
+ * @class IGraphStrategy
+ * @brief Contract for strategies whose indicators are computed once per series and shared.
+ *
+ * Used by @ref domain::backtest::Engine::runMany: every strategy of the run
+ * registers its indicators in one graph (@ref subscribe), the engine advances
+ * the graph once per block of bars, and each strategy turns the shared
+ * indicator columns into signals (@ref onBars). Implementations must emit the
+ * signals the equivalent @ref IStrategy would emit, so both engine paths
+ * produce the same result.
+ */
+class IGraphStrategy {
+public:
+    /**
+     * @brief Virtual destructor.
+     */
+    virtual ~IGraphStrategy() = default;
+
+    /**
+     * @brief Registers the indicators the strategy reads and keeps their node ids.
+     *
+     * Called once per run, before @ref onStart(), on a fresh graph.
+     */
+    virtual void subscribe(IndicatorGraph& graph) = 0;
+
+    /**
+     * @brief Prepare internal state. Called once before streaming bars.
+     */
+    virtual void onStart() {}
+
+    /**
+     * @brief Emits one decision per bar of the block.
+     *
+     * @param graph Graph already advanced over @p bars; read with @ref IndicatorGraph::column.
+     * @param bars  Next bars of the stream.
+     * @param out   Output; `out.size() == bars.size()`.
+     */
+    virtual void onBars(const IndicatorGraph& graph, const domain::BarColumns& bars,
+                        std::span<Signal> out) = 0;
+
+    /**
+     * @brief Cleanup or finalize strategy state. Called after the last bar.
+     */
+    virtual void onFinish() {}
+};
+
+} // namespace qga::strategy
@@ -3,6 +3,9 @@
  * @brief Strategy interface returning trading signals per bar.
  */
 #pragma once
+#include <cstdint>
+#include <span>
+#include "domain/BarColumns.hpp"
 #include "domain/Quote.hpp"
 
 namespace qga::strategy {
@@ -14,8 +17,10 @@ namespace qga::strategy {
  * - None: No action taken.
  * - Buy: Enter or increase a long position.
  * - Sell: Exit or reduce a long position.
+ *
+ * One byte wide, so per-bar signal arrays stay compact.
  */
-enum class Signal { None, Buy, Sell };
+enum class Signal : std::uint8_t { None, Buy, Sell };
 
 /**
  * @class IStrategy
@@ -26,6 +31,8 @@ enum class Signal { None, Buy, Sell };
  *
  * - @ref onStart()   → called once before the first bar.
  * - @ref onBar(q)    → called for each bar, returns @ref Signal.
+ * - @ref onBars()    → called for consecutive blocks of bars instead of onBar()
+ *                      by engines that dispatch in blocks.
  * - @ref onFinish()  → called once after the final bar.
  *
  * Strategies must be stateless across multiple backtests or reset properly.
@@ -50,6 +57,24 @@ public:
      */
     virtual Signal onBar(const domain::Quote& q) = 0;
 
+    /**
+     * @brief Consume a block of consecutive bars and emit one decision per bar.
+     *
+     * Equivalent to calling @ref onBar() for every bar of the block in order;
+     * the default does exactly that. Strategies override it to update their
+     * state in a tight loop over the columns they need, without a virtual call
+     * or a @ref domain::Quote row per bar.
+     *
+     * @param bars Next bars of the stream (continues the state of earlier calls).
+     * @param out  Output; `out.size() == bars.size()`.
+     */
+    virtual void onBars(const domain::BarColumns& bars, std::span<Signal> out) {
+        for (std::size_t i = 0; i < bars.size(); ++i) {
+            out[i] = onBar(domain::Quote{bars.ts_[i], bars.open_[i], bars.high_[i],
+                                         bars.low_[i], bars.close_[i], bars.volume_[i]});
+        }
+    }
+
     /**
      * @brief Cleanup or finalize strategy state. Called after the last bar.
      */
@@ -0,0 +1,40 @@
+/**
+ * @file IVectorStrategy.hpp
+ * @brief Strategy interface producing the signals of a whole series at once.
+ */
+#pragma once
+#include <span>
+#include "domain/BarColumns.hpp"
+#include "strategy/IStrategy.hpp"
+
+namespace qga::strategy {
+
+/**
+ * @class IVectorStrategy
+ * @brief Contract for strategies that compute their signals from column spans.
+ *
+ * Used by @ref domain::backtest::Engine::runVectorized: instead of one virtual
+ * `onBar()` call per bar, the engine asks for all signals in a single call and
+ * then executes them in tight loops. Implementations must emit exactly the
+ * signals the equivalent @ref IStrategy would emit bar by bar, so both engine
+ * paths produce the same result.
+ */
+class IVectorStrategy {
+public:
+    /**
+     * @brief Virtual destructor.
+     */
+    virtual ~IVectorStrategy() = default;
+
+    /**
+     * @brief Computes the signal of every bar.
+     *
+     * Must not depend on state left by earlier calls.
+     *
+     * @param cols Input bars (OHLCV columns).
+     * @param out  Output; `out.size() == cols.size()`, `out[i]` is the decision at bar `i`.
+     */
+    virtual void signals(const domain::BarColumns& cols, std::span<Signal> out) = 0;
+};
+
+} // namespace qga::strategy
@@ -0,0 +1,125 @@
+/**
+ * @file IndicatorGraph.hpp
+ * @brief Per-series graph of streaming indicators shared by several strategies.
+ *
+ * Strategies register the indicators they read; identical requests (same kind,
+ * period and input) resolve to the same node, so an SMA(20) used by fifty
+ * strategies of a sweep is computed once per bar instead of fifty times.
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <span>
+#include <tuple>
+#include <variant>
+#include <vector>
+#include "domain/BarColumns.hpp"
+#include "strategy/StreamingIndicators.hpp"
+
+namespace qga::strategy {
+
+/**
+ * @enum BarField
+ * @brief Bar column an indicator can read.
+ */
+enum class BarField : std::uint8_t { Open, High, Low, Close, Volume };
+
+/**
+ * @class IndicatorGraph
+ * @brief Deduplicated dependency graph of streaming indicators over one bar stream.
+ *
+ * Nodes are bar columns or indicators whose input is another node, so chains
+ * such as an EMA of an RSI are shared as well. A node's input is always
+ * registered before the node, so evaluating nodes in registration order is a
+ * topological order.
+ *
+ * The graph advances one block of bars at a time (@ref update): each node runs
+ * over the whole block before the next node, and exposes its values for the
+ * block as a column (@ref column). Bar-column nodes are views of the block,
+ * not copies.
+ *
+ * Example usage:
+ * @code
+ * IndicatorGraph g;
+ * auto fast = g.sma(10);
+ * auto slow = g.sma(30);
+ * auto same = g.sma(10);     // == fast
+ * g.update(block);
+ * double last = g.column(fast).back();
+ * @endcode
+ */
+class IndicatorGraph {
+public:
+    /// @brief Handle of a node (valid for the graph that returned it).
+    using NodeId = std::uint32_t;
+
+    /// @return Node reading bar column @p field.
+    NodeId field(BarField field);
+
+    /// @return SMA(@p period) of node @p input.
+    NodeId sma(std::size_t period, NodeId input);
+    /// @return SMA(@p period) of the close.
+    NodeId sma(std::size_t period) { return sma(period, field(BarField::Close)); }
+
+    /// @return EMA(@p period) of node @p input.
+    NodeId ema(std::size_t period, NodeId input);
+    /// @return EMA(@p period) of the close.
+    NodeId ema(std::size_t period) { return ema(period, field(BarField::Close)); }
+
+    /// @return RSI(@p period) of node @p input.
+    NodeId rsi(std::size_t period, NodeId input);
+    /// @return RSI(@p period) of the close.
+    NodeId rsi(std::size_t period) { return rsi(period, field(BarField::Close)); }
+
+    /// @return ATR(@p period) of the bars (reads high, low and close).
+    NodeId atr(std::size_t period);
+
+    /// @return Number of distinct nodes (bar columns included).
+    std::size_t size() const noexcept { return nodes_.size(); }
+
+    /// @return Number of registration calls, deduplicated or not.
+    std::size_t requests() const noexcept { return requests_; }
+
+    /// @brief Resets every indicator to its initial (warming-up) state.
+    void reset() noexcept;
+
+    /**
+     * @brief Advances every node over the next block of bars.
+     *
+     * Continues the state of earlier calls. Must not be interleaved with
+     * registrations: register everything, then stream.
+     *
+     * @param bars Next bars of the stream.
+     */
+    void update(const domain::BarColumns& bars);
+
+    /**
+     * @brief Values of node @p id for the block passed to the last @ref update().
+     * @return One value per bar of that block (NaN during warm-up); valid until the next update().
+     */
+    std::span<const double> column(NodeId id) const noexcept { return columns_[id]; }
+
+private:
+    enum class Kind : std::uint8_t { Field, Sma, Ema, Rsi, Atr };
+
+    struct Node {
+        Kind kind_;
+        NodeId input_;                                   ///< Input node (unused for Field/Atr).
+        std::variant<BarField, Sma, Ema, Rsi, Atr> state_;
+    };
+
+    /// Returns the node with this key, creating it from @p state if new.
+    template <typename State>
+    NodeId intern(Kind kind, std::size_t param, NodeId input, State state);
+
+    std::vector<Node> nodes_;
+    std::map<std::tuple<Kind, std::size_t, NodeId>, NodeId> index_;  ///< Dedup key -> node.
+    std::size_t requests_ = 0;
+
+    std::vector<double> values_;                  ///< Block values, node-major (`node * capacity_`).
+    std::size_t capacity_ = 0;                    ///< Bars per node in @ref values_.
+    std::vector<std::span<const double>> columns_;  ///< Per-node view of the current block.
+};
+
+} // namespace qga::strategy
@@ -3,8 +3,12 @@
  * @brief Simple SMA fast/slow crossover strategy.
  */
 #pragma once
-#include <deque>
+#include <cmath>
+#include <cstddef>
+#include "strategy/IGraphStrategy.hpp"
 #include "strategy/IStrategy.hpp"
+#include "strategy/IVectorStrategy.hpp"
+#include "strategy/RollingWindow.hpp"
 
 namespace qga::strategy {
 
@@ -16,12 +20,21 @@ namespace qga::strategy {
  * - `Signal::Buy` when the fast SMA crosses above the slow SMA.
  * - `Signal::Sell` when the fast SMA crosses below the slow SMA.
  *
- * Internally maintains two rolling windows of close prices to compute the averages.
+ * Internally maintains two compensated rolling sums (@ref RollingSum) of close
+ * prices; the windows are allocated once at construction. Also implements
+ * @ref IVectorStrategy with a loop over the close column that reads the value
+ * leaving each window back from the column and applies the same compensated
+ * update, so `Engine::runVectorized` reproduces `Engine::run` exactly. As an
+ * @ref IGraphStrategy it reads both SMAs from a shared @ref IndicatorGraph
+ * instead, so `Engine::runMany` computes each distinct period once per bar for
+ * all crossovers of a sweep. @ref signalAt makes it a @ref StaticStrategy
+ * (the per-bar logic is inline), so `Engine::run<MACrossover>` and the
+ * combinators of Combinators.hpp compile it into the engine loop.
  *
  * Common use cases:
  * - `fast_period = 10`, `slow_period = 20` (default)
  */
-class MACrossover final: public IStrategy {
+class MACrossover final: public IStrategy, public IVectorStrategy, public IGraphStrategy {
 public:
     /**
      * @brief Construct a new MACrossover strategy.
@@ -44,25 +57,100 @@ public:
      */
     Signal onBar(const domain::Quote& q) override;
 
+    /**
+     * @brief Batched @ref onBar(): reads only the close column of the block.
+     * @param bars Next bars of the stream.
+     * @param out  One signal per bar.
+     */
+    void onBars(const domain::BarColumns& bars, std::span<Signal> out) override;
+
     /**
      * @brief Cleanup or finalize internal state after last bar.
      */
     void onFinish() override;
 
+    /**
+     * @brief Computes the crossover signals of a whole series (see @ref IVectorStrategy).
+     *
+     * Uses local state only: the streaming state of this instance is left
+     * untouched, so it may be called during a running backtest.
+     *
+     * @param cols Input bars; only closes are read.
+     * @param out  One signal per bar.
+     */
+    void signals(const domain::BarColumns& cols, std::span<Signal> out) override;
+
+    /**
+     * @brief Registers SMA(fast) and SMA(slow) of the close (see @ref IGraphStrategy).
+     */
+    void subscribe(IndicatorGraph& graph) override;
+
+    /**
+     * @brief Crossover decisions from the shared SMA columns of the block.
+     * @param graph Graph advanced over @p bars.
+     * @param bars  Next bars of the stream.
+     * @param out   One signal per bar.
+     */
+    void onBars(const IndicatorGraph& graph, const domain::BarColumns& bars, std::span<Signal> out) override;
+
+    /**
+     * @brief Consumes bar @p i and returns its decision (see @ref StaticStrategy).
+     * @param bars Bars of the run; only closes are read.
+     * @param i    Index of the next bar.
+     */
+    Signal signalAt(const domain::BarColumns& bars, std::size_t i) { return step(bars.close_[i]); }
+
 private:
-        int fast_period_;   ///< Number of bars for the fast SMA.
-    int slow_period_;   ///< Number of bars for the slow SMA.
+    /// @brief Crossover state machine on the SMA values of successive bars.
+    struct CrossState {
+        double prev_fast_ = 0.0;     ///< Fast SMA value from previous bar.
+        double prev_slow_ = 0.0;     ///< Slow SMA value from previous bar.
+        bool ready_ = false;         ///< A finite pair of SMAs has been seen.
+
+        /// @brief Decision for the SMA values of the next bar (NaN: not ready).
+        Signal update(double sma_fast, double sma_slow);
+    };
 
-    std::deque<double> w_fast_;  ///< Rolling window of closing prices for fast SMA.
-    std::deque<double> w_slow_;  ///< Rolling window of closing prices for slow SMA.
+    /// @brief Advances both windows by one close and returns the decision for that bar.
+    Signal step(double close);
 
-    double sum_fast_ = 0.0;      ///< Running sum for fast SMA calculation.
-    double sum_slow_ = 0.0;      ///< Running sum for slow SMA calculation.
+    RollingSum<double> fast_;    ///< Rolling window of closing prices for fast SMA.
+    RollingSum<double> slow_;    ///< Rolling window of closing prices for slow SMA.
 
-    double prev_fast_ = 0.0;     ///< Fast SMA value from previous bar.
-    double prev_slow_ = 0.0;     ///< Slow SMA value from previous bar.
+    CrossState state_;           ///< Crossover state of the streaming paths.
 
-    bool ready_ = false;         ///< Indicates if enough data is available to compute both SMAs.
+    IndicatorGraph::NodeId fast_id_ = 0;   ///< SMA(fast) node of the subscribed graph.
+    IndicatorGraph::NodeId slow_id_ = 0;   ///< SMA(slow) node of the subscribed graph.
 };
 
+// Inline: shared by every dispatch path and inlined by the static one.
+
+inline Signal MACrossover::step(double close) {
+    fast_.push(close);
+    slow_.push(close);
+    if (!fast_.full() || !slow_.full()) return Signal::None;
+    return state_.update(fast_.mean(), slow_.mean());
+}
+
+inline Signal MACrossover::CrossState::update(double sma_f, double sma_s) {
+    if (!std::isfinite(sma_f) || !std::isfinite(sma_s)) return Signal::None;
+
+    if (!ready_) {
+        ready_ = true;
+        prev_fast_ = sma_f;
+        prev_slow_ = sma_s;
+        return Signal::None;
+    }
+
+    const bool CROSS_UP   = (prev_fast_ <= prev_slow_) && (sma_f >  sma_s);
+    const bool CROSS_DOWN = (prev_fast_ >= prev_slow_) && (sma_f <  sma_s);
+
+    prev_fast_ = sma_f;
+    prev_slow_ = sma_s;
+
+    if (CROSS_UP)   return Signal::Buy;
+    if (CROSS_DOWN) return Signal::Sell;
+    return Signal::None;
+}
+
 } // namespace qga::strategy
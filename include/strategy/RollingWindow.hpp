@@ -0,0 +1,240 @@
+/**
+ * @file RollingWindow.hpp
+ * @brief Fixed-capacity ring buffer and compensated rolling sum for indicator state.
+ *
+ * Both allocate once (at construction or @ref RingBuffer::reset) and then run
+ * without touching the allocator, keeping a window's values contiguous so the
+ * state of an indicator stays cache-resident.
+ */
+#pragma once
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace qga::strategy {
+
+/**
+ * @class RingBuffer
+ * @brief Fixed-capacity FIFO that overwrites its oldest element when full.
+ *
+ * Indexing is oldest-first: `(*this)[0]` is the oldest value, `(*this)[size() - 1]`
+ * the newest.
+ *
+ * @tparam T Element type (cheap to copy).
+ */
+template <typename T>
+class RingBuffer {
+public:
+    /**
+     * @param capacity Maximum number of elements kept (0 keeps nothing).
+     */
+    explicit RingBuffer(std::size_t capacity = 0) : data_(capacity) {}
+
+    /**
+     * @brief Empties the buffer and changes its capacity (the only call that may allocate).
+     */
+    void reset(std::size_t capacity) {
+        data_.assign(capacity, T{});
+        clear();
+    }
+
+    /// @brief Empties the buffer, keeping its capacity.
+    void clear() noexcept {
+        head_ = 0;
+        size_ = 0;
+    }
+
+    /// @return Maximum number of elements.
+    std::size_t capacity() const noexcept { return data_.size(); }
+
+    /// @return Number of elements currently held.
+    std::size_t size() const noexcept { return size_; }
+
+    /// @return True if no element is held.
+    bool empty() const noexcept { return size_ == 0; }
+
+    /// @return True once @ref capacity() elements are held.
+    bool full() const noexcept { return size_ == data_.size(); }
+
+    /**
+     * @brief Appends @p value, evicting the oldest element if the buffer is full.
+     *
+     * @param value   Value to append.
+     * @param evicted Set to the removed element when one was evicted.
+     * @return True if an element was evicted.
+     * @note With capacity 0 the value is dropped and reported as evicted.
+     */
+    bool push(const T& value, T& evicted) noexcept {
+        if (data_.empty()) {
+            evicted = value;
+            return true;
+        }
+        const bool WAS_FULL = full();
+        if (WAS_FULL) evicted = data_[head_];  // head_ is the oldest slot when full
+        data_[head_] = value;
+        head_ = (head_ + 1 == data_.size()) ? 0 : head_ + 1;
+        if (!WAS_FULL) ++size_;
+        return WAS_FULL;
+    }
+
+    /// @brief Appends @p value, discarding the oldest element if the buffer is full.
+    void push(const T& value) noexcept {
+        T evicted{};
+        push(value, evicted);
+    }
+
+    /// @return The @p i-th oldest element (unchecked: `i < size()`).
+    const T& operator[](std::size_t i) const noexcept {
+        std::size_t idx = head_ + data_.size() - size_ + i;  // oldest slot + i
+        if (idx >= data_.size()) idx -= data_.size();
+        if (idx >= data_.size()) idx -= data_.size();
+        return data_[idx];
+    }
+
+    /// @return Oldest element (unchecked: buffer must not be empty).
+    const T& front() const noexcept { return (*this)[0]; }
+
+    /// @return Newest element (unchecked: buffer must not be empty).
+    const T& back() const noexcept { return data_[head_ == 0 ? data_.size() - 1 : head_ - 1]; }
+
+private:
+    std::vector<T> data_;       ///< Storage (size == capacity).
+    std::size_t head_ = 0;      ///< Next slot to write.
+    std::size_t size_ = 0;      ///< Number of valid elements.
+};
+
+/**
+ * @class CompensatedSum
+ * @brief Running sum with a Kahan-style compensation term (the arithmetic of @ref RollingSum).
+ *
+ * Code that keeps the window values elsewhere (e.g. reads the evicted value
+ * back from a column) uses it to produce sums bit-identical to a
+ * @ref RollingSum fed the same values.
+ *
+ * @tparam T Floating-point type.
+ */
+template <typename T = double>
+class CompensatedSum {
+    static_assert(std::is_floating_point_v<T>, "CompensatedSum requires a floating-point type");
+
+public:
+    /// @brief Resets the sum to zero.
+    void clear() noexcept { sum_ = comp_ = T{0}; }
+
+    /// @brief Kahan-compensated `sum += x`.
+    void add(T x) noexcept {
+        T t, err;
+        twoSum(sum_, x, t, err);
+        sum_ = t;
+        comp_ += err;
+    }
+
+    /**
+     * @brief Adds @p x and removes @p evicted.
+     *
+     * The net change is formed first, so the running sum sees one addition
+     * per update (half the dependency chain); both roundings are compensated.
+     */
+    void replace(T x, T evicted) noexcept {
+        T delta, err;
+        twoSum(x, -evicted, delta, err);
+        comp_ += err;
+        add(delta);
+    }
+
+    /// @return Compensated sum.
+    T sum() const noexcept { return sum_ + comp_; }
+
+private:
+    /// Knuth's branch-free TwoSum: `s + e == a + b` exactly.
+    static void twoSum(T a, T b, T& s, T& e) noexcept {
+        s = a + b;
+        const T BB = s - a;
+        e = (a - (s - BB)) + (b - BB);
+    }
+
+    T sum_  = T{0};     ///< Running sum.
+    T comp_ = T{0};     ///< Accumulated rounding error of @ref sum_.
+};
+
+/**
+ * @class RollingSum
+ * @brief Sum and mean over the last @p window values, with Kahan-style compensation.
+ *
+ * Each push adds the new value and subtracts the evicted one. A plain running
+ * sum accumulates rounding error over millions of updates; the compensation
+ * term keeps the error bounded independently of the stream length.
+ *
+ * Example usage:
+ * @code
+ * RollingSum<double> sma(20);
+ * for (double px : closes) {
+ *     sma.push(px);
+ *     if (sma.full()) use(sma.mean());
+ * }
+ * @endcode
+ *
+ * @tparam T Floating-point type.
+ */
+template <typename T = double>
+class RollingSum {
+    static_assert(std::is_floating_point_v<T>, "RollingSum requires a floating-point type");
+
+public:
+    /**
+     * @param window Number of values summed (0: never full, mean is NaN).
+     */
+    explicit RollingSum(std::size_t window = 0) : values_(window) {}
+
+    /// @brief Empties the window and changes its length (may allocate).
+    void reset(std::size_t window) {
+        values_.reset(window);
+        clear();
+    }
+
+    /// @brief Empties the window, keeping its length.
+    void clear() noexcept {
+        values_.clear();
+        sum_.clear();
+    }
+
+    /**
+     * @brief Adds @p x and drops the oldest value once the window is full.
+     */
+    void push(T x) noexcept {
+        T evicted{};
+        if (!values_.push(x, evicted)) {
+            sum_.add(x);
+        } else if (values_.capacity() > 0) {
+            sum_.replace(x, evicted);
+        }
+    }
+
+    /// @return Window length.
+    std::size_t window() const noexcept { return values_.capacity(); }
+
+    /// @return Number of values currently in the window.
+    std::size_t size() const noexcept { return values_.size(); }
+
+    /// @return True once the window holds @ref window() values.
+    bool full() const noexcept { return values_.full() && values_.capacity() > 0; }
+
+    /// @return Compensated sum of the values in the window.
+    T sum() const noexcept { return sum_.sum(); }
+
+    /// @return `sum() / window()` once full, NaN before.
+    T mean() const noexcept {
+        return full() ? sum() / static_cast<T>(values_.capacity())
+                      : std::numeric_limits<T>::quiet_NaN();
+    }
+
+    /// @return The values in the window, oldest first.
+    const RingBuffer<T>& values() const noexcept { return values_; }
+
+private:
+    RingBuffer<T> values_;
+    CompensatedSum<T> sum_;
+};
+
+} // namespace qga::strategy
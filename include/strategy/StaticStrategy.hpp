@@ -0,0 +1,91 @@
+/**
+ * @file StaticStrategy.hpp
+ * @brief Compile-time strategy contract for the templated engine path.
+ *
+ * A static strategy is any type with `onStart()` and a per-bar
+ * `signalAt(bars, i)`; no base class and no virtual call. Handed to the
+ * templated `Engine::run`, its logic is inlined into the engine loop.
+ * @ref VirtualStrategy wraps one back into an @ref IStrategy for code that
+ * needs the runtime interface (sweeps, plugins).
+ */
+#pragma once
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <utility>
+#include "domain/BarColumns.hpp"
+#include "domain/Quote.hpp"
+#include "strategy/IStrategy.hpp"
+
+namespace qga::strategy {
+
+/**
+ * @brief Strategy usable without virtual dispatch.
+ *
+ * - `s.onStart()` resets the state before a run.
+ * - `s.signalAt(bars, i)` consumes bar `i` and returns the decision for it;
+ *   called once per bar, in order.
+ * - `s.onFinish()` is optional.
+ */
+template <typename S>
+concept StaticStrategy = requires(S& s, const domain::BarColumns& bars, std::size_t i) {
+    s.onStart();
+    { s.signalAt(bars, i) } -> std::same_as<Signal>;
+};
+
+/**
+ * @brief Per-bar predicate usable as a filter (see `Filtered` in Combinators.hpp).
+ *
+ * - `f.onStart()` resets the state before a run.
+ * - `f.passAt(bars, i)` consumes bar `i` and returns whether it passes.
+ */
+template <typename F>
+concept BarFilter = requires(F& f, const domain::BarColumns& bars, std::size_t i) {
+    f.onStart();
+    { f.passAt(bars, i) } -> std::same_as<bool>;
+};
+
+/// @brief Calls `s.onFinish()` if the type has one.
+template <typename S>
+void finish(S& s) {
+    if constexpr (requires { s.onFinish(); }) s.onFinish();
+}
+
+/**
+ * @class VirtualStrategy
+ * @brief Adapts a @ref StaticStrategy to the runtime @ref IStrategy interface.
+ *
+ * Produces the same signals as the static type, so a rule composed at
+ * compile time can also run through factories, sweeps and the virtual
+ * engine paths.
+ *
+ * @tparam S Wrapped static strategy (held by value).
+ */
+template <StaticStrategy S>
+class VirtualStrategy final : public IStrategy {
+public:
+    /// @param rule Strategy to wrap.
+    explicit VirtualStrategy(S rule) : rule_(std::move(rule)) {}
+
+    void onStart() override { rule_.onStart(); }
+
+    Signal onBar(const domain::Quote& q) override {
+        const domain::BarColumns ONE{{&q.ts_, 1},  {&q.open_, 1},  {&q.high_, 1},
+                                     {&q.low_, 1}, {&q.close_, 1}, {&q.volume_, 1}};
+        return rule_.signalAt(ONE, 0);
+    }
+
+    void onBars(const domain::BarColumns& bars, std::span<Signal> out) override {
+        for (std::size_t i = 0; i < bars.size(); ++i) out[i] = rule_.signalAt(bars, i);
+    }
+
+    void onFinish() override { finish(rule_); }
+
+    /// @return The wrapped strategy.
+    S& rule() noexcept { return rule_; }
+
+private:
+    S rule_;
+};
+
+} // namespace qga::strategy
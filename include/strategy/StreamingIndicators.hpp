@@ -0,0 +1,208 @@
+/**
+ * @file StreamingIndicators.hpp
+ * @brief Incremental indicators: one `update()` per bar returns the current value.
+ *
+ * The streaming counterparts of the whole-series kernels in
+ * indicators/Indicators.hpp, for strategies that consume bars one at a time.
+ * Definitions (seeding, warm-up, Wilder smoothing) are the same; values are
+ * NaN until an indicator is warmed up. State is allocated at construction only.
+ */
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include "strategy/RollingWindow.hpp"
+
+namespace qga::strategy {
+
+/**
+ * @class Sma
+ * @brief Simple moving average over the last @p period values (compensated @ref RollingSum).
+ */
+class Sma {
+public:
+    /// @param period Window length (0: never warmed up).
+    explicit Sma(std::size_t period = 0) : sum_(period) {}
+
+    /// @brief Forgets all values (start of a new run).
+    void reset() noexcept { sum_.clear(); }
+
+    /// @return Mean of the last @ref period() values, NaN until the window is full.
+    double update(double x) noexcept {
+        sum_.push(x);
+        return sum_.mean();
+    }
+
+    /// @return Last value returned by @ref update().
+    double value() const noexcept { return sum_.mean(); }
+
+    /// @return Window length.
+    std::size_t period() const noexcept { return sum_.window(); }
+
+private:
+    RollingSum<double> sum_;
+};
+
+/**
+ * @class Ema
+ * @brief Exponential moving average, `alpha = 2 / (period + 1)`, seeded with the SMA of the first @p period values.
+ */
+class Ema {
+public:
+    /// @param period Smoothing period (0: never warmed up).
+    explicit Ema(std::size_t period = 0)
+        : period_(period), alpha_(2.0 / (static_cast<double>(period) + 1.0)) {}
+
+    /// @brief Forgets all values (start of a new run).
+    void reset() noexcept {
+        count_ = 0;
+        seed_  = 0.0;
+        value_ = std::numeric_limits<double>::quiet_NaN();
+    }
+
+    /// @return Updated average, NaN for the first `period - 1` values.
+    double update(double x) noexcept {
+        if (count_ < period_) {
+            seed_ += x;
+            if (++count_ == period_) value_ = seed_ / static_cast<double>(period_);
+            return value_;
+        }
+        if (period_ > 0) value_ += alpha_ * (x - value_);
+        return value_;
+    }
+
+    /// @return Last value returned by @ref update().
+    double value() const noexcept { return value_; }
+
+    /// @return Smoothing period.
+    std::size_t period() const noexcept { return period_; }
+
+private:
+    std::size_t period_;
+    double alpha_;
+    std::size_t count_ = 0;   ///< Values seen while seeding.
+    double seed_       = 0.0; ///< Sum of the seeding values.
+    double value_      = std::numeric_limits<double>::quiet_NaN();
+};
+
+/**
+ * @class Rsi
+ * @brief Relative Strength Index with Wilder smoothing, in [0, 100].
+ *
+ * Needs @p period price changes, so the first value comes with the
+ * `(period + 1)`-th close. No losses in the window gives 100, no change at all 50.
+ */
+class Rsi {
+public:
+    /// @param period Smoothing period (0: never warmed up).
+    explicit Rsi(std::size_t period = 0)
+        : period_(period), inv_p_(1.0 / static_cast<double>(period)) {}
+
+    /// @brief Forgets all values (start of a new run).
+    void reset() noexcept {
+        changes_  = 0;
+        has_prev_ = false;
+        gain_ = loss_ = 0.0;
+        value_ = std::numeric_limits<double>::quiet_NaN();
+    }
+
+    /// @return Updated RSI for close @p x, NaN during warm-up.
+    double update(double x) noexcept {
+        if (!has_prev_) {
+            has_prev_ = true;
+            prev_     = x;
+            return value_;
+        }
+        const double D    = x - prev_;
+        const double GAIN = std::max(D, 0.0);
+        const double LOSS = std::max(-D, 0.0);
+        prev_ = x;
+
+        if (period_ == 0) return value_;
+        if (++changes_ < period_) {
+            gain_ += GAIN;
+            loss_ += LOSS;
+            return value_;
+        }
+        if (changes_ == period_) {
+            gain_ = (gain_ + GAIN) / static_cast<double>(period_);
+            loss_ = (loss_ + LOSS) / static_cast<double>(period_);
+        } else {
+            gain_ += (GAIN - gain_) * inv_p_;
+            loss_ += (LOSS - loss_) * inv_p_;
+        }
+        if (loss_ == 0.0) value_ = gain_ == 0.0 ? 50.0 : 100.0;
+        else              value_ = 100.0 - 100.0 / (1.0 + gain_ / loss_);
+        return value_;
+    }
+
+    /// @return Last value returned by @ref update().
+    double value() const noexcept { return value_; }
+
+    /// @return Smoothing period.
+    std::size_t period() const noexcept { return period_; }
+
+private:
+    std::size_t period_;
+    double inv_p_;
+    std::size_t changes_ = 0;   ///< Price changes seen.
+    bool has_prev_       = false;
+    double prev_         = 0.0; ///< Previous close.
+    double gain_         = 0.0; ///< Sum during warm-up, then the smoothed average gain.
+    double loss_         = 0.0; ///< Sum during warm-up, then the smoothed average loss.
+    double value_        = std::numeric_limits<double>::quiet_NaN();
+};
+
+/**
+ * @class Atr
+ * @brief Average True Range with Wilder smoothing, seeded with the mean of the first @p period true ranges.
+ */
+class Atr {
+public:
+    /// @param period Smoothing period (0: never warmed up).
+    explicit Atr(std::size_t period = 0)
+        : period_(period), inv_p_(1.0 / static_cast<double>(period)) {}
+
+    /// @brief Forgets all values (start of a new run).
+    void reset() noexcept {
+        count_    = 0;
+        has_prev_ = false;
+        sum_      = 0.0;
+        value_    = std::numeric_limits<double>::quiet_NaN();
+    }
+
+    /// @return Updated ATR for one bar, NaN for the first `period - 1` bars.
+    double update(double high, double low, double close) noexcept {
+        const double TR = has_prev_ ? std::max({high - low, std::abs(high - prev_), std::abs(low - prev_)})
+                                    : high - low;
+        has_prev_ = true;
+        prev_     = close;
+
+        if (period_ == 0) return value_;
+        if (count_ < period_) {
+            sum_ += TR;
+            if (++count_ == period_) value_ = sum_ / static_cast<double>(period_);
+            return value_;
+        }
+        value_ += (TR - value_) * inv_p_;
+        return value_;
+    }
+
+    /// @return Last value returned by @ref update().
+    double value() const noexcept { return value_; }
+
+    /// @return Smoothing period.
+    std::size_t period() const noexcept { return period_; }
+
+private:
+    std::size_t period_;
+    double inv_p_;
+    std::size_t count_ = 0;     ///< Bars seen while seeding.
+    bool has_prev_     = false;
+    double prev_       = 0.0;   ///< Previous close.
+    double sum_        = 0.0;   ///< Sum of the seeding true ranges.
+    double value_      = std::numeric_limits<double>::quiet_NaN();
+};
+
+} // namespace qga::strategy
@@ -0,0 +1,38 @@
+-- ======================================================
+-- 004: symbol dimension table for quotes (user_version 1)
+-- ======================================================
+-- Replaces the TEXT symbol repeated in every quote row with an integer id
+-- and clusters quotes on (symbol_id, ts). Applied by SQLiteStore when it
+-- opens a database with user_version < 1; a TEXT-keyed quotes table is
+-- renamed to quotes_legacy first and copied over below.
+
+CREATE TABLE IF NOT EXISTS symbols (
+    id          INTEGER PRIMARY KEY,
+    name        TEXT NOT NULL UNIQUE
+);
+
+CREATE TABLE IF NOT EXISTS quotes (
+    symbol_id   INTEGER NOT NULL REFERENCES symbols(id),
+    ts          INTEGER NOT NULL,    -- Epoch ms
+    open        REAL NOT NULL,
+    high        REAL NOT NULL,
+    low         REAL NOT NULL,
+    close       REAL NOT NULL,
+    volume      REAL NOT NULL,
+    PRIMARY KEY (symbol_id, ts)
+) WITHOUT ROWID;
+
+-- Old column layout for ad-hoc queries
+CREATE VIEW IF NOT EXISTS quotes_by_symbol AS
+    SELECT s.name AS symbol, q.ts, q.open, q.high, q.low, q.close, q.volume
+    FROM quotes q JOIN symbols s ON s.id = q.symbol_id;
+
+-- Only when migrating (quotes_legacy exists):
+-- INSERT OR IGNORE INTO symbols(name) SELECT DISTINCT symbol FROM quotes_legacy;
+-- INSERT INTO quotes (symbol_id, ts, open, high, low, close, volume)
+--     SELECT s.id, l.ts, l.open, l.high, l.low, l.close, l.volume
+--     FROM quotes_legacy l JOIN symbols s ON s.name = l.symbol
+--     ORDER BY s.id, l.ts;
+-- DROP TABLE quotes_legacy;
+
+PRAGMA user_version = 1;
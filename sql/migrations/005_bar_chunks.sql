@@ -0,0 +1,24 @@
+-- ======================================================
+-- 005: bar series as compressed columnar chunks (user_version 2)
+-- ======================================================
+-- One row per (symbol, timeframe, time partition). `data` holds the bars of
+-- the partition encoded by BarChunkCodec (delta-of-delta timestamps, XOR
+-- compressed prices and volumes). Partitions span a UTC day for bars below
+-- one hour, 64 days for hourly bars and 2048 days for daily and longer bars.
+-- Applied by SQLiteStore when it opens a database with user_version < 2.
+
+CREATE TABLE IF NOT EXISTS bar_chunks (
+    id          INTEGER PRIMARY KEY,
+    symbol_id   INTEGER NOT NULL REFERENCES symbols(id),
+    timeframe   TEXT NOT NULL,        -- e.g. "1m", "5m", "1h", "1d"
+    chunk_start INTEGER NOT NULL,     -- Epoch ms, start of the partition
+    bar_count   INTEGER NOT NULL,
+    first_ts    INTEGER NOT NULL,     -- Epoch ms of the first bar
+    last_ts     INTEGER NOT NULL,     -- Epoch ms of the last bar
+    data        BLOB NOT NULL
+);
+
+CREATE UNIQUE INDEX IF NOT EXISTS idx_bar_chunks_symbol_tf_start
+    ON bar_chunks(symbol_id, timeframe, chunk_start);
+
+PRAGMA user_version = 2;
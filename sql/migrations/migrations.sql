@@ -5,33 +5,42 @@
 PRAGMA foreign_keys = ON;
 
 -- ======================
--- Quotes (tick-level or OHLC aggregated)
+-- Quotes (tick-level or OHLC aggregated), keyed by symbol id
+-- (see 004_quote_symbols.sql)
 -- ======================
+CREATE TABLE IF NOT EXISTS symbols (
+    id          INTEGER PRIMARY KEY,
+    name        TEXT NOT NULL UNIQUE
+);
+
 CREATE TABLE IF NOT EXISTS quotes (
-    symbol      TEXT NOT NULL,
+    symbol_id   INTEGER NOT NULL REFERENCES symbols(id),
     ts          INTEGER NOT NULL,    -- Epoch ms
     open        REAL NOT NULL,
     high        REAL NOT NULL,
     low         REAL NOT NULL,
     close       REAL NOT NULL,
     volume      REAL NOT NULL,
-    PRIMARY KEY (symbol, ts)
-);
+    PRIMARY KEY (symbol_id, ts)
+) WITHOUT ROWID;
+
+CREATE VIEW IF NOT EXISTS quotes_by_symbol AS
+    SELECT s.name AS symbol, q.ts, q.open, q.high, q.low, q.close, q.volume
+    FROM quotes q JOIN symbols s ON s.id = q.symbol_id;
 
 -- ======================
--- BarSeries (candlestick data, derived from quotes)
+-- BarSeries (candlestick data, derived from quotes), stored as compressed
+-- columnar chunks per time partition (see 005_bar_chunks.sql)
 -- ======================
-CREATE TABLE IF NOT EXISTS bar_series (
-    id          INTEGER PRIMARY KEY AUTOINCREMENT,
-    symbol      TEXT NOT NULL,
+CREATE TABLE IF NOT EXISTS bar_chunks (
+    id          INTEGER PRIMARY KEY,
+    symbol_id   INTEGER NOT NULL REFERENCES symbols(id),
     timeframe   TEXT NOT NULL,        -- e.g. "1m", "5m", "1h", "1d"
-    ts          INTEGER NOT NULL,     -- Epoch ms start of bar
-    open        REAL NOT NULL,
-    high        REAL NOT NULL,
-    low         REAL NOT NULL,
-    close       REAL NOT NULL,
-    volume      REAL NOT NULL,
-    UNIQUE(symbol, timeframe, ts)
+    chunk_start INTEGER NOT NULL,     -- Epoch ms, start of the partition
+    bar_count   INTEGER NOT NULL,
+    first_ts    INTEGER NOT NULL,     -- Epoch ms of the first bar
+    last_ts     INTEGER NOT NULL,     -- Epoch ms of the last bar
+    data        BLOB NOT NULL
 );
 
 -- ======================
@@ -77,11 +86,8 @@ CREATE TABLE IF NOT EXISTS positions (
 -- ======================
 -- Indexes for faster queries
 -- ======================
-CREATE INDEX IF NOT EXISTS idx_quotes_symbol_ts
-    ON quotes(symbol, ts);
-
-CREATE INDEX IF NOT EXISTS idx_bar_series_symbol_tf_ts
-    ON bar_series(symbol, timeframe, ts);
+CREATE UNIQUE INDEX IF NOT EXISTS idx_bar_chunks_symbol_tf_start
+    ON bar_chunks(symbol_id, timeframe, chunk_start);
 
 CREATE INDEX IF NOT EXISTS idx_trades_portfolio
     ON trades(portfolio_id, ts);
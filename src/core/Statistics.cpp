@@ -5,6 +5,9 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <functional>
+#include <iterator>
 #include <memory>
 #include <numeric>
 #include <stdexcept>
@@ -17,13 +20,128 @@ namespace qga::core
         // Local logger – NOT a singleton (unit-test friendly)
         static std::shared_ptr<utils::ILogger> s_logger =
             utils::LoggerFactory::createConsoleLogger("Statistics", LogLevel::Info);
+
+#ifdef QGA_STATS_DIAGNOSTICS
+        constexpr bool DIAGNOSTICS = true;
+#else
+        constexpr bool DIAGNOSTICS = false;
+#endif
+
+        /**
+         * Logs a computed value. Success paths run millions of times in sweeps,
+         * so the message is only built (and the sink hit) when the library is
+         * compiled with QGA_STATS_DIAGNOSTICS; error paths always log.
+         */
+        template <typename MakeMessage>
+        void trace(MakeMessage&& make_message)
+        {
+            if constexpr (DIAGNOSTICS)
+                s_logger->log(LogLevel::Info, make_message());
+        }
     } // namespace
 
     // ================================================================
     // BASIC STATISTICS
     // ================================================================
 
-    std::optional<double> Statistics::calculateMean(const std::vector<int>& values)
+    namespace
+    {
+        /// Independent accumulators per reduction: enough to hide the add
+        /// latency and to fill a vector register of doubles.
+        constexpr std::size_t LANES = 8;
+
+        /// Sum, shifted sum of squares and extrema of a non-empty sample.
+        template <typename T> struct Moments
+        {
+            double shift;  ///< First value; sums are taken over `x - shift`.
+            double sum;
+            double sumsq;
+            T min;
+            T max;
+        };
+
+        template <typename T> double laneSum(std::span<const T> values)
+        {
+            double acc[LANES] = {};
+            const std::size_t BULK = values.size() - values.size() % LANES;
+            for (std::size_t i = 0; i < BULK; i += LANES)
+                for (std::size_t l = 0; l < LANES; ++l)
+                    acc[l] += static_cast<double>(values[i + l]);
+            for (std::size_t i = BULK; i < values.size(); ++i)
+                acc[i - BULK] += static_cast<double>(values[i]);
+
+            double sum = 0.0;
+            for (double a : acc)
+                sum += a;
+            return sum;
+        }
+
+        /// Extremum of a non-empty sample: the value @p better prefers over all others.
+        /// Only compares, so a min or max scan does not pay for the moments.
+        template <typename T, typename Better> T laneExtremum(std::span<const T> values, Better better)
+        {
+            T acc[LANES];
+            std::fill(std::begin(acc), std::end(acc), values.front());
+
+            const std::size_t BULK = values.size() - values.size() % LANES;
+            for (std::size_t i = 0; i < BULK; i += LANES)
+                for (std::size_t l = 0; l < LANES; ++l)
+                    acc[l] = better(values[i + l], acc[l]) ? values[i + l] : acc[l];
+            for (std::size_t i = BULK; i < values.size(); ++i)
+                acc[i - BULK] = better(values[i], acc[i - BULK]) ? values[i] : acc[i - BULK];
+
+            T best = acc[0];
+            for (std::size_t l = 1; l < LANES; ++l)
+                best = better(acc[l], best) ? acc[l] : best;
+            return best;
+        }
+
+        template <typename T> Moments<T> laneMoments(std::span<const T> values)
+        {
+            const T FIRST = values.front();
+            const double SHIFT = static_cast<double>(FIRST);
+            double sum[LANES] = {};
+            double sumsq[LANES] = {};
+            T lo[LANES], hi[LANES];
+            std::fill(std::begin(lo), std::end(lo), FIRST);
+            std::fill(std::begin(hi), std::end(hi), FIRST);
+
+            auto fold = [&](std::size_t l, T x) {
+                const double D = static_cast<double>(x) - SHIFT;
+                sum[l] += D;
+                sumsq[l] += D * D;
+                lo[l] = x < lo[l] ? x : lo[l];
+                hi[l] = x > hi[l] ? x : hi[l];
+            };
+
+            const std::size_t BULK = values.size() - values.size() % LANES;
+            for (std::size_t i = 0; i < BULK; i += LANES)
+                for (std::size_t l = 0; l < LANES; ++l)
+                    fold(l, values[i + l]);
+            for (std::size_t i = BULK; i < values.size(); ++i)
+                fold(i - BULK, values[i]);
+
+            Moments<T> m{SHIFT, 0.0, 0.0, FIRST, FIRST};
+            for (std::size_t l = 0; l < LANES; ++l)
+            {
+                m.sum += sum[l];
+                m.sumsq += sumsq[l];
+                m.min = std::min(m.min, lo[l]);
+                m.max = std::max(m.max, hi[l]);
+            }
+            return m;
+        }
+
+        /// Sample variance from shifted sums; clamped at 0 against rounding.
+        template <typename T> double sampleVariance(const Moments<T>& m, std::size_t n)
+        {
+            const double N = static_cast<double>(n);
+            return std::max(0.0, (m.sumsq - m.sum * m.sum / N) / (N - 1.0));
+        }
+    } // namespace
+
+    template <StatsElement T>
+    std::optional<double> Statistics::calculateMean(std::span<const T> values)
     {
         if (values.empty())
         {
@@ -31,14 +149,14 @@ namespace qga::core
             return std::nullopt;
         }
 
-        double sum = std::accumulate(values.begin(), values.end(), 0.0);
-        double mean = sum / values.size();
+        double mean = laneSum(values) / static_cast<double>(values.size());
 
-        s_logger->log(LogLevel::Info, "[Statistics] Mean calculated: " + std::to_string(mean));
+        trace([&] { return "[Statistics] Mean calculated: " + std::to_string(mean); });
         return mean;
     }
 
-    std::optional<int> Statistics::calculateMin(const std::vector<int>& values)
+    template <StatsElement T>
+    std::optional<T> Statistics::calculateMin(std::span<const T> values)
     {
         if (values.empty())
         {
@@ -46,12 +164,13 @@ namespace qga::core
             return std::nullopt;
         }
 
-        int min_val = *std::min_element(values.begin(), values.end());
-        s_logger->log(LogLevel::Info, "[Statistics] Min calculated: " + std::to_string(min_val));
+        T min_val = laneExtremum(values, std::less<T>{});
+        trace([&] { return "[Statistics] Min calculated: " + std::to_string(min_val); });
         return min_val;
     }
 
-    std::optional<int> Statistics::calculateMax(const std::vector<int>& values)
+    template <StatsElement T>
+    std::optional<T> Statistics::calculateMax(std::span<const T> values)
     {
         if (values.empty())
         {
@@ -59,12 +178,13 @@ namespace qga::core
             return std::nullopt;
         }
 
-        int max_val = *std::max_element(values.begin(), values.end());
-        s_logger->log(LogLevel::Info, "[Statistics] Max calculated: " + std::to_string(max_val));
+        T max_val = laneExtremum(values, std::greater<T>{});
+        trace([&] { return "[Statistics] Max calculated: " + std::to_string(max_val); });
         return max_val;
     }
 
-    std::optional<double> Statistics::calculateMedian(const std::vector<int>& values)
+    template <StatsElement T>
+    std::optional<double> Statistics::calculateMedian(std::span<const T> values)
     {
         if (values.empty())
         {
@@ -72,20 +192,23 @@ namespace qga::core
             return std::nullopt;
         }
 
-        std::vector<int> sorted = values;
-        std::sort(sorted.begin(), sorted.end());
+        // Selection instead of a full sort: the upper middle element lands in
+        // place, and everything before it is not larger.
+        std::vector<T> work(values.begin(), values.end());
+        const std::size_t n = work.size();
+        const auto mid = work.begin() + static_cast<std::ptrdiff_t>(n / 2);
+        std::nth_element(work.begin(), mid, work.end());
 
-        size_t n = sorted.size();
-        double median = (n % 2 == 0)
-                            ? (sorted[n / 2 - 1] + sorted[n / 2]) / 2.0
-                            : sorted[n / 2];
+        double median = static_cast<double>(*mid);
+        if (n % 2 == 0)
+            median = (static_cast<double>(*std::max_element(work.begin(), mid)) + median) / 2.0;
 
-        s_logger->log(LogLevel::Info,
-                      "[Statistics] Median calculated: " + std::to_string(median));
+        trace([&] { return "[Statistics] Median calculated: " + std::to_string(median); });
         return median;
     }
 
-    std::optional<double> Statistics::calculateStdDev(const std::vector<int>& values)
+    template <StatsElement T>
+    std::optional<double> Statistics::calculateStdDev(std::span<const T> values)
     {
         if (values.size() < 2)
         {
@@ -94,23 +217,50 @@ namespace qga::core
             return std::nullopt;
         }
 
-        auto mean_opt = calculateMean(values);
-        if (!mean_opt)
-            return std::nullopt;
+        double stddev = std::sqrt(sampleVariance(laneMoments(values), values.size()));
 
-        double mean = *mean_opt;
-        double sum_sq = 0.0;
+        trace([&] { return "[Statistics] StdDev calculated: " + std::to_string(stddev); });
+        return stddev;
+    }
+
+    template <StatsElement T>
+    std::optional<Statistics::Summary> Statistics::summarize(std::span<const T> values)
+    {
+        if (values.empty())
+        {
+            s_logger->log(LogLevel::Err, "[Statistics] Cannot summarize: data is empty");
+            return std::nullopt;
+        }
 
-        for (int v : values)
-            sum_sq += (v - mean) * (v - mean);
+        const auto m = laneMoments(values);
+        const std::size_t n = values.size();
 
-        double stddev = std::sqrt(sum_sq / (values.size() - 1));
+        Summary summary;
+        summary.count = n;
+        summary.mean = m.shift + m.sum / static_cast<double>(n);
+        summary.stddev = n < 2 ? 0.0 : std::sqrt(sampleVariance(m, n));
+        summary.min = static_cast<double>(m.min);
+        summary.max = static_cast<double>(m.max);
 
-        s_logger->log(LogLevel::Info,
-                      "[Statistics] StdDev calculated: " + std::to_string(stddev));
-        return stddev;
+        trace([&] { return "[Statistics] Summary calculated over " + std::to_string(n) + " values"; });
+        return summary;
     }
 
+#define QGA_STATISTICS_INSTANTIATE(T)                                                        \
+    template std::optional<double> Statistics::calculateMean<T>(std::span<const T>);         \
+    template std::optional<T> Statistics::calculateMin<T>(std::span<const T>);               \
+    template std::optional<T> Statistics::calculateMax<T>(std::span<const T>);               \
+    template std::optional<double> Statistics::calculateMedian<T>(std::span<const T>);       \
+    template std::optional<double> Statistics::calculateStdDev<T>(std::span<const T>);       \
+    template std::optional<Statistics::Summary> Statistics::summarize<T>(std::span<const T>);
+
+    QGA_STATISTICS_INSTANTIATE(int)
+    QGA_STATISTICS_INSTANTIATE(std::int64_t)
+    QGA_STATISTICS_INSTANTIATE(float)
+    QGA_STATISTICS_INSTANTIATE(double)
+
+#undef QGA_STATISTICS_INSTANTIATE
+
     // ================================================================
     // FINANCIAL METRICS
     // ================================================================
@@ -133,8 +283,7 @@ namespace qga::core
             max_dd = std::max(max_dd, dd);
         }
 
-        s_logger->log(LogLevel::Info, "[Statistics] MaxDrawdown calculated: " +
-                                          std::to_string(max_dd));
+        trace([&] { return "[Statistics] MaxDrawdown calculated: " + std::to_string(max_dd); });
         return max_dd;
     }
 
@@ -167,8 +316,7 @@ namespace qga::core
 
         double result = std::pow(end / start, 1.0 / years) - 1.0;
 
-        s_logger->log(LogLevel::Info, "[Statistics] CAGR calculated: " +
-                                          std::to_string(result));
+        trace([&] { return "[Statistics] CAGR calculated: " + std::to_string(result); });
         return result;
     }
 
@@ -211,8 +359,7 @@ namespace qga::core
 
         double sharpe = (mean - rf) / stddev;
 
-        s_logger->log(LogLevel::Info,
-                      "[Statistics] Sharpe Ratio calculated: " + std::to_string(sharpe));
+        trace([&] { return "[Statistics] Sharpe Ratio calculated: " + std::to_string(sharpe); });
         return sharpe;
     }
 
@@ -262,8 +409,7 @@ namespace qga::core
 
         double sortino = (mean - rf) / downside_dev;
 
-        s_logger->log(LogLevel::Info,
-                      "[Statistics] Sortino Ratio calculated: " + std::to_string(sortino));
+        trace([&] { return "[Statistics] Sortino Ratio calculated: " + std::to_string(sortino); });
         return sortino;
     }
 
@@ -282,8 +428,7 @@ namespace qga::core
 
         double ratio = static_cast<double>(wins) / returns.size();
 
-        s_logger->log(LogLevel::Info,
-                      "[Statistics] Hit Ratio calculated: " + std::to_string(ratio));
+        trace([&] { return "[Statistics] Hit Ratio calculated: " + std::to_string(ratio); });
         return ratio;
     }
 
@@ -0,0 +1,105 @@
+#include "core/ThreadPool.hpp"
+
+namespace qga::core
+{
+
+    namespace
+    {
+        // Identifies the pool and queue of the current worker thread, if any.
+        thread_local const ThreadPool* tl_pool = nullptr;
+        thread_local std::size_t tl_index = 0;
+    } // namespace
+
+    ThreadPool::ThreadPool(int threads)
+    {
+        std::size_t n = threads > 0 ? static_cast<std::size_t>(threads)
+                                    : std::thread::hardware_concurrency();
+        if (n == 0)
+            n = 1;
+
+        queues_.reserve(n);
+        for (std::size_t i = 0; i < n; ++i)
+            queues_.push_back(std::make_unique<WorkQueue>());
+
+        workers_.reserve(n);
+        for (std::size_t i = 0; i < n; ++i)
+            workers_.emplace_back([this, i] { workerLoop(i); });
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard lock(sleep_mtx_);
+            stop_ = true;
+        }
+        cv_.notify_all();
+        for (auto& t : workers_)
+            t.join();
+    }
+
+    void ThreadPool::enqueue(std::function<void()> job)
+    {
+        const std::size_t IDX =
+            (tl_pool == this) ? tl_index : next_queue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+        {
+            std::lock_guard lock(queues_[IDX]->mtx_);
+            queues_[IDX]->jobs_.push_back(std::move(job));
+        }
+        {
+            // Counted under the sleep mutex so a worker about to sleep cannot miss it.
+            std::lock_guard lock(sleep_mtx_);
+            pending_.fetch_add(1, std::memory_order_relaxed);
+        }
+        cv_.notify_one();
+    }
+
+    bool ThreadPool::popLocal(std::size_t self, std::function<void()>& job)
+    {
+        auto& q = *queues_[self];
+        std::lock_guard lock(q.mtx_);
+        if (q.jobs_.empty())
+            return false;
+        job = std::move(q.jobs_.back());
+        q.jobs_.pop_back();
+        return true;
+    }
+
+    bool ThreadPool::steal(std::size_t self, std::function<void()>& job)
+    {
+        const std::size_t N = queues_.size();
+        for (std::size_t k = 1; k < N; ++k)
+        {
+            auto& q = *queues_[(self + k) % N];
+            std::lock_guard lock(q.mtx_);
+            if (q.jobs_.empty())
+                continue;
+            job = std::move(q.jobs_.front());
+            q.jobs_.pop_front();
+            return true;
+        }
+        return false;
+    }
+
+    void ThreadPool::workerLoop(std::size_t self)
+    {
+        tl_pool = this;
+        tl_index = self;
+
+        while (true)
+        {
+            std::function<void()> job;
+            if (popLocal(self, job) || steal(self, job))
+            {
+                pending_.fetch_sub(1, std::memory_order_relaxed);
+                job();
+                continue;
+            }
+
+            std::unique_lock lock(sleep_mtx_);
+            cv_.wait(lock, [this] { return stop_ || pending_.load(std::memory_order_relaxed) > 0; });
+            if (stop_ && pending_.load(std::memory_order_relaxed) == 0)
+                return; // nothing left to run
+        }
+    }
+
+} // namespace qga::core
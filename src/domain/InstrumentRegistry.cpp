@@ -0,0 +1,50 @@
+#include "domain/InstrumentRegistry.hpp"
+#include <stdexcept>
+
+namespace qga::domain {
+
+    InstrumentRegistry::InstrumentRegistry(const InstrumentRegistry& other)
+        : instruments_(other.instruments_) {
+        rebuildIndex();
+    }
+
+    InstrumentRegistry& InstrumentRegistry::operator=(const InstrumentRegistry& other) {
+        if (this != &other) {
+            instruments_ = other.instruments_;
+            rebuildIndex();
+        }
+        return *this;
+    }
+
+    void InstrumentRegistry::rebuildIndex() {
+        // Keys are views into the instruments, so a copy must re-point them at its own storage.
+        ids_.clear();
+        ids_.reserve(instruments_.size());
+        for (std::size_t i = 0; i < instruments_.size(); ++i) {
+            const auto& ins = instruments_[i];
+            ids_.emplace(Key{ins.symbol(), ins.exchangeMic()}, static_cast<InstrumentId>(i));
+        }
+    }
+
+    InstrumentId InstrumentRegistry::intern(const Instrument& ins) {
+        if (auto id = find(ins)) return *id;
+
+        const auto ID = static_cast<InstrumentId>(instruments_.size());
+        instruments_.push_back(ins);
+        const auto& stored = instruments_.back();
+        ids_.emplace(Key{stored.symbol(), stored.exchangeMic()}, ID);
+        return ID;
+    }
+
+    std::optional<InstrumentId> InstrumentRegistry::find(const Instrument& ins) const noexcept {
+        const auto IT = ids_.find(Key{ins.symbol(), ins.exchangeMic()});
+        if (IT == ids_.end()) return std::nullopt;
+        return IT->second;
+    }
+
+    const Instrument& InstrumentRegistry::get(InstrumentId id) const {
+        if (id >= instruments_.size()) throw std::out_of_range("InstrumentRegistry: unknown instrument id");
+        return instruments_[id];
+    }
+
+}   // namespace qga::domain
@@ -1,46 +1,146 @@
 #include "domain/backtest/BarSeries.hpp"
 #include <stdexcept>
+#include <utility>
 
 namespace qga::domain::backtest{
 
+  BarSeries::BarSeries(const BarSeries& other)
+    : cols_(other.cols_), backing_(other.backing_),
+      ts_(other.ts_), open_(other.open_), high_(other.high_),
+      low_(other.low_), close_(other.close_), volume_(other.volume_) {
+    if (!backing_) rebind();
+  }
+
+  BarSeries::BarSeries(BarSeries&& other) noexcept
+    : cols_(other.cols_), backing_(std::move(other.backing_)),
+      ts_(std::move(other.ts_)), open_(std::move(other.open_)), high_(std::move(other.high_)),
+      low_(std::move(other.low_)), close_(std::move(other.close_)), volume_(std::move(other.volume_)) {
+    // Moved vectors keep their buffers, so cols_ stays valid; only the source must forget them.
+    other.clear();
+  }
+
+  BarSeries& BarSeries::operator=(const BarSeries& other) {
+    if (this != &other) {
+      BarSeries tmp(other);
+      *this = std::move(tmp);
+    }
+    return *this;
+  }
+
+  BarSeries& BarSeries::operator=(BarSeries&& other) noexcept {
+    if (this != &other) {
+      cols_    = other.cols_;
+      backing_ = std::move(other.backing_);
+      ts_      = std::move(other.ts_);
+      open_    = std::move(other.open_);
+      high_    = std::move(other.high_);
+      low_     = std::move(other.low_);
+      close_   = std::move(other.close_);
+      volume_  = std::move(other.volume_);
+      other.clear();
+    }
+    return *this;
+  }
+
+  BarSeries BarSeries::view(BarColumns columns, std::shared_ptr<const void> backing) {
+    const auto N = columns.ts_.size();
+    if (columns.open_.size() != N || columns.high_.size() != N || columns.low_.size() != N ||
+        columns.close_.size() != N || columns.volume_.size() != N) {
+      throw std::invalid_argument("BarSeries::view column lengths differ");
+    }
+    if (!backing) throw std::invalid_argument("BarSeries::view requires backing storage");
+
+    BarSeries s;
+    s.cols_    = columns;
+    s.backing_ = std::move(backing);
+    return s;
+  }
+
   void BarSeries::add(const domain::Quote& q) {
+    if (backing_) throw std::logic_error("BarSeries::add on read-only view");
     // (opcjonalnie) weryfikacja danych wejściowych
     // if (!(q.high >= q.low && q.high >= q.open && q.high >= q.close)) { ... }
-    data_.push_back(q);
+    ts_.push_back(q.ts_);
+    open_.push_back(q.open_);
+    high_.push_back(q.high_);
+    low_.push_back(q.low_);
+    close_.push_back(q.close_);
+    volume_.push_back(q.volume_);
+    rebind();
   }
 
-  std::size_t BarSeries::size() const noexcept { return data_.size(); }
+  void BarSeries::append(const BarColumns& cols) {
+    if (backing_) throw std::logic_error("BarSeries::append on read-only view");
+    ts_.insert(ts_.end(), cols.ts_.begin(), cols.ts_.end());
+    open_.insert(open_.end(), cols.open_.begin(), cols.open_.end());
+    high_.insert(high_.end(), cols.high_.begin(), cols.high_.end());
+    low_.insert(low_.end(), cols.low_.begin(), cols.low_.end());
+    close_.insert(close_.end(), cols.close_.begin(), cols.close_.end());
+    volume_.insert(volume_.end(), cols.volume_.begin(), cols.volume_.end());
+    rebind();
+  }
 
-  const domain::Quote& BarSeries::at(std::size_t i) const {
-    if (i >= data_.size()) throw std::out_of_range("BarSeries::at index out of range");
-    return data_[i];
+  void BarSeries::reserve(std::size_t n) {
+    if (backing_) throw std::logic_error("BarSeries::reserve on read-only view");
+    ts_.reserve(n);
+    open_.reserve(n);
+    high_.reserve(n);
+    low_.reserve(n);
+    close_.reserve(n);
+    volume_.reserve(n);
+    rebind();
   }
 
-  const BarSeries::Quote& BarSeries::operator[](std::size_t i) const {
-    if (data_.empty()) throw std::out_of_range("BarSeries::back on empty series");
-    return data_[i];
+  void BarSeries::resize(std::size_t n) {
+    if (backing_) throw std::logic_error("BarSeries::resize on read-only view");
+    ts_.resize(n);
+    open_.resize(n);
+    high_.resize(n);
+    low_.resize(n);
+    close_.resize(n);
+    volume_.resize(n);
+    rebind();
+  }
+
+  std::size_t BarSeries::size() const noexcept { return cols_.size(); }
+
+  domain::Quote BarSeries::at(std::size_t i) const {
+    if (i >= size()) throw std::out_of_range("BarSeries::at index out of range");
+    return (*this)[i];
   }
 
-  const domain::Quote& BarSeries::end() const {
-    if (data_.empty()) throw std::out_of_range("BarSeries::back on empty series");
-    return data_.back();
+  domain::Quote BarSeries::end() const {
+    if (empty()) throw std::out_of_range("BarSeries::back on empty series");
+    return (*this)[size() - 1];
   }
 
-   const domain::Quote& BarSeries::front() const {
-    if (data_.empty()) throw std::out_of_range("BarSeries::begin on empty series");
-    return data_.front();
+   domain::Quote BarSeries::front() const {
+    if (empty()) throw std::out_of_range("BarSeries::begin on empty series");
+    return (*this)[0];
   }
 
   bool BarSeries::empty() const noexcept {
-    return data_.empty();
+    return cols_.ts_.empty();
   }
 
   void BarSeries::clear() noexcept {
-    data_.clear();
+    backing_.reset();
+    ts_.clear();
+    open_.clear();
+    high_.clear();
+    low_.clear();
+    close_.clear();
+    volume_.clear();
+    rebind();
   }
 
-  const std::vector<domain::Quote>& BarSeries::data() const noexcept {
-    return data_;
+  void BarSeries::rebind() noexcept {
+    cols_.ts_     = {ts_.data(), ts_.size()};
+    cols_.open_   = {open_.data(), open_.size()};
+    cols_.high_   = {high_.data(), high_.size()};
+    cols_.low_    = {low_.data(), low_.size()};
+    cols_.close_  = {close_.data(), close_.size()};
+    cols_.volume_ = {volume_.data(), volume_.size()};
   }
 
 } // namespace qga::domain::backtest
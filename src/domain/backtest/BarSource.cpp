@@ -0,0 +1,95 @@
+#include "domain/backtest/BarSource.hpp"
+#include <algorithm>
+#include <utility>
+
+namespace qga::domain::backtest{
+
+  // === SeriesBarSource ===
+
+  bool SeriesBarSource::next(BarSeries& batch, std::size_t max_bars) {
+    batch.clear();
+    const std::size_t N = std::min(std::max<std::size_t>(max_bars, 1), series_.size() - pos_);
+    if (N == 0) return false;
+    batch.append(series_.columns().slice(pos_, N));
+    pos_ += N;
+    return true;
+  }
+
+  // === ReadAheadBarSource ===
+
+  ReadAheadBarSource::ReadAheadBarSource(std::unique_ptr<IBarSource> inner,
+                                         std::size_t batch_bars, std::size_t depth)
+    : inner_(std::move(inner)),
+      batch_bars_(std::max<std::size_t>(batch_bars, 1)),
+      depth_(std::max<std::size_t>(depth, 1)) {
+    worker_ = std::thread([this] { produce(); });
+  }
+
+  ReadAheadBarSource::~ReadAheadBarSource() {
+    {
+      std::lock_guard lock(mtx_);
+      stop_ = true;
+    }
+    cv_.notify_all();
+    worker_.join();
+  }
+
+  void ReadAheadBarSource::produce() {
+    try {
+      while (true) {
+        BarSeries batch;
+        {
+          std::unique_lock lock(mtx_);
+          cv_.wait(lock, [this] { return stop_ || ready_.size() < depth_; });
+          if (stop_) return;
+          if (!spare_.empty()) {
+            batch = std::move(spare_.back());
+            spare_.pop_back();
+          }
+        }
+
+        const bool MORE = inner_->next(batch, batch_bars_);  // decode outside the lock
+
+        {
+          std::lock_guard lock(mtx_);
+          if (!MORE) {
+            done_ = true;
+          } else {
+            ready_.push_back(std::move(batch));
+          }
+        }
+        cv_.notify_all();
+        if (!MORE) return;
+      }
+    } catch (...) {
+      {
+        std::lock_guard lock(mtx_);
+        error_ = std::current_exception();
+        done_  = true;
+      }
+      cv_.notify_all();
+    }
+  }
+
+  bool ReadAheadBarSource::next(BarSeries& batch, std::size_t /*max_bars*/) {
+    std::unique_lock lock(mtx_);
+    cv_.wait(lock, [this] { return !ready_.empty() || done_; });
+
+    if (ready_.empty()) {
+      batch.clear();
+      if (error_) std::rethrow_exception(std::exchange(error_, nullptr));
+      return false;
+    }
+
+    // Swap rather than copy: the caller's previous batch becomes a spare buffer.
+    BarSeries spent = std::move(ready_.front());
+    ready_.pop_front();
+    std::swap(batch, spent);
+    spare_.push_back(std::move(spent));
+
+    lock.unlock();
+    cv_.notify_all();
+    return true;
+  }
+
+} // namespace qga::domain::backtest
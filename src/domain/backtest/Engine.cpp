@@ -1,61 +1,207 @@
 #include "domain/backtest/Engine.hpp"
+#include <algorithm>
+#include <array>
 
 namespace qga::domain::backtest{
 
-  BacktestResult Engine::run(BarSeries const& s, strategy::IStrategy& strat) {
+  using detail::Account;
+  using detail::BLOCK_BARS;
+  using detail::CurveRecorder;
+  using detail::liquidate;
+  using detail::step;
+
+  namespace {
+
+    /// Executes the signals of one block bar by bar.
+    void executeBlock(const BarColumns& block, std::span<const strategy::Signal> sig, Account& acc,
+                      const ExecParams& exec, RecordLevel level, CurveRecorder& curve,
+                      BacktestResult& r) {
+      for (std::size_t i = 0; i < block.size(); ++i) {
+        step(acc, block.ts_[i], block.close_[i], sig[i], exec, level, r);
+        curve.update(r.final_equity_, level, r);
+      }
+    }
+
+    /**
+     * Feeds @p cols to the strategy in blocks of BLOCK_BARS bars and executes
+     * the returned signals bar by bar.
+     */
+    void runBlocks(const BarColumns& cols, strategy::IStrategy& strat, Account& acc,
+                   const ExecParams& exec, RecordLevel level, CurveRecorder& curve,
+                   BacktestResult& r) {
+      std::array<strategy::Signal, BLOCK_BARS> sig;
+
+      for (std::size_t b = 0; b < cols.size(); b += BLOCK_BARS) {
+        const std::size_t LEN = std::min(BLOCK_BARS, cols.size() - b);
+        const auto BLOCK      = cols.slice(b, LEN);
+        strat.onBars(BLOCK, std::span(sig).first(LEN));
+        executeBlock(BLOCK, std::span(sig).first(LEN), acc, exec, level, curve, r);
+      }
+    }
+
+    /// Writes `cash + close * qty` over a span of bars (vectorizable: no branches, no calls).
+    void markEquity(const double* close, double* out, std::size_t n, double cash, double qty) {
+      for (std::size_t i = 0; i < n; ++i) out[i] = cash + close[i] * qty;
+    }
+
+    /// Flat stretch: the streaming path adds 0.0 to the cash, which is kept for bit parity.
+    void markFlat(double* out, std::size_t n, double cash) {
+      std::fill(out, out + n, cash + 0.0);
+    }
+
+  } // namespace
+
+  BacktestResult Engine::run(BarSeries const& s, strategy::IStrategy& strat) const {
     BacktestResult r;
     r.initial_equity_ = initial_equity_;
     r.final_equity_   = initial_equity_;
 
-    // Simple account state: all-in 1 item; without leverage
-    bool has_pos  = false;
-   // double entry  = 0.0;  never used, safe to delete
-    double cash   = initial_equity_;
-    double qty    = 0.0;
+    const bool FULL = record_ == RecordLevel::Full;
+    if (FULL) {
+      r.equity_curve_.reserve(s.size());
+      r.drawdown_.reserve(s.size());
+    }
+    CurveRecorder curve(initial_equity_);
+
+    Account acc;
+    acc.cash = initial_equity_;
 
     strat.onStart();
+    runBlocks(s.columns(), strat, acc, exec_, record_, curve, r);
+    strat.onFinish();
 
-    for (std::size_t i = 0; i < s.size(); ++i) {
-      const auto& q = s.at(i);
-      const auto SIG = strat.onBar(q);
-
-      if (SIG == strategy::Signal::Buy && !has_pos) {
-        // Execution with delay
-        const double PX_EXEC  = applySlippage(q.close_, exec_.slippage_bps_, /*is_buy=*/true);
-        const double FEE      = commissionCost(PX_EXEC, 1.0, exec_.commission_fixed_, exec_.commission_bps_);
-
-        if(PX_EXEC > 0.0 && cash >= (PX_EXEC + FEE)) {
-          has_pos = true;
-         // entry   = PX_EXEC;    // never used safe to remove
-          qty     = 1.0;
-          cash    -= (PX_EXEC + FEE);
-          r.trades_executed_ += 1;
-        }
-
-      } else if (SIG == strategy::Signal::Sell && has_pos) {
-        const double PX_EXEC  = applySlippage(q.close_, exec_.slippage_bps_, /*is_buy=*/false);
-        const double FEE      = commissionCost(PX_EXEC, qty, exec_.commission_fixed_, exec_.commission_bps_);
-
-        has_pos = false;
-        cash    += PX_EXEC * qty;   // income from sell
-        cash    -= FEE;             // minus commission
-        qty     = 0.0;
-      }
+    if (acc.has_pos) liquidate(acc, s.end(), exec_, record_, r);
+
+    return r;
+  }
 
-      r.final_equity_ = cash + (has_pos ? q.close_ * qty : 0.0);
+  BacktestResult Engine::run(IBarSource& source, strategy::IStrategy& strat, std::size_t batch_bars) const {
+    BacktestResult r;
+    r.initial_equity_ = initial_equity_;
+    r.final_equity_   = initial_equity_;
+
+    CurveRecorder curve(initial_equity_);
+
+    Account acc;
+    acc.cash = initial_equity_;
+    Quote last{};
+
+    strat.onStart();
+
+    BarSeries batch;  // reused for every pull: memory stays at one batch
+    while (source.next(batch, batch_bars)) {
+      runBlocks(batch.columns(), strat, acc, exec_, record_, curve, r);
+      if (!batch.empty()) last = batch.end();
     }
     strat.onFinish();
 
-    if (has_pos) { //
-      const auto& last      = s.end();
-      const double PX_EXEC  = applySlippage(last.close_, exec_.slippage_bps_, /*is_buy=*/false);
-      const double FEE      = commissionCost(PX_EXEC, qty, exec_.commission_fixed_, exec_.commission_bps_);
-      cash                  += PX_EXEC * qty;
-      cash                  -= FEE;
-      // qty                   = 0.0; never read val, safe to del
-      // has_pos               = false; never read read, safe to del
-      r.final_equity_ = cash;
+    liquidate(acc, last, exec_, record_, r);
+
+    return r;
+  }
+
+  std::vector<BacktestResult> Engine::runMany(BarSeries const& s,
+                                              std::span<strategy::IGraphStrategy* const> strats) const {
+    const std::size_t K = strats.size();
+    const bool FULL     = record_ == RecordLevel::Full;
+
+    std::vector<BacktestResult> results(K);
+    std::vector<Account> accounts(K);
+    std::vector<CurveRecorder> curves(K, CurveRecorder(initial_equity_));
+    for (std::size_t k = 0; k < K; ++k) {
+      results[k].initial_equity_ = initial_equity_;
+      results[k].final_equity_   = initial_equity_;
+      accounts[k].cash           = initial_equity_;
+      if (FULL) {
+        results[k].equity_curve_.reserve(s.size());
+        results[k].drawdown_.reserve(s.size());
+      }
+    }
+
+    // One graph per run: every distinct indicator is advanced once per block,
+    // however many strategies read it.
+    strategy::IndicatorGraph graph;
+    for (auto* strat : strats) strat->subscribe(graph);
+    for (auto* strat : strats) strat->onStart();
+
+    const BarColumns COLS = s.columns();
+    std::array<strategy::Signal, BLOCK_BARS> sig;
+    for (std::size_t b = 0; b < COLS.size(); b += BLOCK_BARS) {
+      const std::size_t LEN = std::min(BLOCK_BARS, COLS.size() - b);
+      const auto BLOCK      = COLS.slice(b, LEN);
+      const auto OUT        = std::span(sig).first(LEN);
+      graph.update(BLOCK);
+      for (std::size_t k = 0; k < K; ++k) {
+        strats[k]->onBars(graph, BLOCK, OUT);
+        executeBlock(BLOCK, OUT, accounts[k], exec_, record_, curves[k], results[k]);
+      }
+    }
+
+    for (std::size_t k = 0; k < K; ++k) {
+      strats[k]->onFinish();
+      if (accounts[k].has_pos) liquidate(accounts[k], s.end(), exec_, record_, results[k]);
+    }
+    return results;
+  }
+
+  BacktestResult Engine::runVectorized(BarSeries const& s, strategy::IVectorStrategy& strat) const {
+    using strategy::Signal;
+
+    BacktestResult r;
+    r.initial_equity_ = initial_equity_;
+    r.final_equity_   = initial_equity_;
+
+    const std::size_t N = s.size();
+    if (N == 0) return r;
+
+    std::vector<Signal> sig(N);
+    strat.signals(s.columns(), sig);
+
+    const double* CLOSE = s.closes().data();
+    double* eq = nullptr;
+    if (record_ == RecordLevel::Full) {
+      r.equity_curve_.resize(N);
+      eq = r.equity_curve_.data();
     }
+    // Below Full the metrics are folded in bar by bar, without an equity array.
+    const bool MARK = !eq && record_ >= RecordLevel::Metrics;
+    CurveRecorder curve(initial_equity_);
+
+    // Only fills change the account, so walk from one actionable signal to the
+    // next and fill the equity curve for the stretch in between in one loop.
+    Account acc;
+    acc.cash = initial_equity_;
+    std::size_t i = 0;  // first bar not yet accounted for
+    const auto FIRST = sig.begin();
+
+    while (i < N) {
+      const std::size_t AT = static_cast<std::size_t>(
+          std::find(FIRST + static_cast<std::ptrdiff_t>(i), sig.end(),
+                    acc.has_pos ? Signal::Sell : Signal::Buy) - FIRST);
+
+      if (eq) {
+        if (acc.has_pos) markEquity(CLOSE + i, eq + i, AT - i, acc.cash, acc.qty);
+        else             markFlat(eq + i, AT - i, acc.cash);
+      } else if (MARK) {
+        if (acc.has_pos) for (std::size_t k = i; k < AT; ++k) curve.mark(acc.cash + CLOSE[k] * acc.qty, r);
+        else             for (std::size_t k = i; k < AT; ++k) curve.mark(acc.cash + 0.0, r);
+      }
+      if (AT == N) break;
+
+      step(acc, s.timestamps()[AT], CLOSE[AT], sig[AT], exec_, record_, r);
+      if (eq) eq[AT] = r.final_equity_;
+      else if (MARK) curve.mark(r.final_equity_, r);
+      i = AT + 1;
+    }
+
+    if (eq) {
+      // Drawdown and returns need the previous bars, so they are a second (sequential) pass.
+      r.drawdown_.resize(N);
+      for (std::size_t k = 0; k < N; ++k) r.drawdown_[k] = curve.mark(eq[k], r);
+    }
+
+    r.final_equity_ = acc.cash + (acc.has_pos ? CLOSE[N - 1] * acc.qty : 0.0);
+    if (acc.has_pos) liquidate(acc, s.end(), exec_, record_, r);
 
     return r;
   }
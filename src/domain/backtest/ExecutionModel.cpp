@@ -0,0 +1,22 @@
+#include "domain/backtest/ExecutionModel.hpp"
+#include <algorithm>
+#include <chrono>
+
+namespace qga::domain::backtest{
+
+  std::optional<Trade> CloseExecution::execute(const Order& order, const domain::Quote& bar,
+                                               double cash, double held_qty) const {
+    const bool IS_BUY = order.side() == Side::Buy;
+    const double QTY  = IS_BUY ? order.quantity() : std::min(order.quantity(), held_qty);
+    if (QTY <= 0.0) return std::nullopt;
+
+    const double PX_EXEC = applySlippage(bar.close_, exec_.slippage_bps_, IS_BUY);
+    if (PX_EXEC <= 0.0) return std::nullopt;
+    const double FEE = commissionCost(PX_EXEC, QTY, exec_.commission_fixed_, exec_.commission_bps_);
+    if (IS_BUY && cash < PX_EXEC * QTY + FEE) return std::nullopt;
+
+    const std::chrono::system_clock::time_point TS{std::chrono::milliseconds{bar.ts_}};
+    return Trade{order, PX_EXEC, QTY, TS, /*entry_price=*/0.0, FEE};
+  }
+
+} // namespace qga::domain::backtest
@@ -1,42 +1,44 @@
 #include "domain/backtest/Portfolio.hpp"
+#include <stdexcept>
 
 namespace qga::domain::backtest {
 
-    std::string Portfolio::keyFor(const domain::Instrument& ins) {
-        //Assumes your Instrument exposes symbol() and exchange_mic()
-        return ins.symbol() + "@" + ins.exchangeMic();
+    domain::InstrumentId Portfolio::idFor(const domain::Instrument& ins) {
+        if (auto id = registry_.find(ins)) return *id;
+        const auto ID = registry_.intern(ins);
+        positions_.emplace_back(registry_.get(ID));
+        return ID;
     }
 
-    Position& Portfolio::getOrCreate(const domain::Instrument& ins) {
-        auto k = keyFor(ins);
-        auto it = positions_.find(k);
-        if(it == positions_.end()) {
-            it = positions_.emplace(k, Position{ins}).first;
-        }
-        return it->second;
+    const Position& Portfolio::getOrCreate(const domain::Instrument& ins) {
+        return positions_[idFor(ins)];
     }
 
     void Portfolio::applyTrade(const Trade& t) {
-        cash_ += t.signedCash(); // Buy -> cash down, Sell -> cash up
-        auto& pos = getOrCreate(t.order().instrument());
+        applyTrade(idFor(t.order().instrument()), t);
+    }
+
+    void Portfolio::applyTrade(domain::InstrumentId id, const Trade& t) {
+        if (id >= positions_.size()) throw std::out_of_range("Portfolio: unknown instrument id");
+        auto& pos = positions_[id];
+
+        const double REALIZED_BEFORE = pos.realizedPnl();
+        const double BASIS_BEFORE    = pos.qty() * pos.avgPrice();
         pos.applyFill(t.price(), t.quantity(), t.side() == Side::Buy);
-        realized_pnl_ = aggregateRealized();
+
+        cash_ += t.signedCash(); // Buy -> cash down, Sell -> cash up
+        cash_ -= t.fee();
+        realized_pnl_ += pos.realizedPnl() - REALIZED_BEFORE;
+        cost_basis_   += pos.qty() * pos.avgPrice() - BASIS_BEFORE;
     }
 
     double Portfolio::navFor(const domain::Instrument& ins, double mark_price) const {
-        const auto K = keyFor(ins);
         double pos_val = 0.0;
-        if(auto it = positions_.find(K); it != positions_.end()) {
-            const auto& p = it ->second;
+        if (auto id = registry_.find(ins)) {
+            const auto& p = positions_[*id];
             pos_val = p.qty() * p.avgPrice() + p.unrealizedPnl(mark_price);
         }
         return cash_ + pos_val;
     }
 
-    double Portfolio::aggregateRealized() const {
-        double sum = 0.0;
-        for(auto const& kv : positions_) sum += kv.second.realizedPnl();
-        return sum;
-    }
-
 }   // namespace qga::domain::backtest
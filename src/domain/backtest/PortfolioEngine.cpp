@@ -0,0 +1,159 @@
+#include "domain/backtest/PortfolioEngine.hpp"
+#include "domain/backtest/EngineLoop.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+
+namespace qga::domain::backtest{
+
+  // === PerInstrumentStrategy ===
+
+  void PerInstrumentStrategy::onStart(std::size_t instruments) {
+    if (strategies_.size() != instruments) {
+      throw std::invalid_argument("PerInstrumentStrategy: need one strategy per instrument");
+    }
+    held_.assign(instruments, 0.0);
+    for (auto& s : strategies_) s->onStart();
+  }
+
+  void PerInstrumentStrategy::onBar(std::size_t instrument, const domain::Quote& q,
+                                    std::vector<OrderRequest>& orders) {
+    const auto SIG = strategies_[instrument]->onBar(q);
+    const double HELD = held_[instrument];
+    if (SIG == strategy::Signal::Buy && HELD == 0.0) {
+      orders.push_back({instrument, Side::Buy, qty_});
+    } else if (SIG == strategy::Signal::Sell && HELD > 0.0) {
+      orders.push_back({instrument, Side::Sell, HELD});
+    }
+  }
+
+  void PerInstrumentStrategy::onFill(std::size_t instrument, const Trade& t) {
+    held_[instrument] += t.side() == Side::Buy ? t.quantity() : -t.quantity();
+  }
+
+  void PerInstrumentStrategy::onFinish() {
+    for (auto& s : strategies_) s->onFinish();
+  }
+
+  // === PortfolioEngine ===
+
+  namespace {
+
+    /// Merge cursor: next unread bar of one feed.
+    struct Cursor {
+      std::int64_t ts;
+      std::uint32_t feed;
+      std::size_t pos;
+    };
+
+    /// Min-heap order on (timestamp, feed): ties keep feed order.
+    bool later(const Cursor& a, const Cursor& b) noexcept {
+      return a.ts != b.ts ? a.ts > b.ts : a.feed > b.feed;
+    }
+
+    std::chrono::system_clock::time_point toTimePoint(std::int64_t ts_ms) {
+      return std::chrono::system_clock::time_point{std::chrono::milliseconds{ts_ms}};
+    }
+
+  } // namespace
+
+  BacktestResult PortfolioEngine::run(std::span<const InstrumentFeed> feeds, IPortfolioStrategy& strat,
+                                      Portfolio* portfolio) const {
+    const std::size_t K = feeds.size();
+    for (const auto& f : feeds) {
+      if (!f.bars_) throw std::invalid_argument("PortfolioEngine: feed without bars");
+    }
+
+    BacktestResult r;
+    r.initial_equity_ = initial_equity_;
+    r.final_equity_   = initial_equity_;
+
+    Portfolio pf(initial_equity_);
+    std::vector<domain::InstrumentId> ids(K);  // feed index -> portfolio position slot
+    for (std::size_t k = 0; k < K; ++k) ids[k] = pf.idFor(feeds[k].instrument_);
+    auto held = [&](std::size_t k) { return pf.position(ids[k]).qty(); };
+
+    std::vector<double> last_close(K, 0.0);  // latest mark per instrument
+    std::vector<std::size_t> seen(K, 0);     // bars consumed per instrument
+    double holdings = 0.0;                   // sum of qty * last_close
+    detail::CurveRecorder curve(initial_equity_);
+    const bool MARK = record_ >= RecordLevel::Metrics;
+
+    std::vector<Cursor> heap;
+    heap.reserve(K);
+    for (std::size_t k = 0; k < K; ++k) {
+      if (!feeds[k].bars_->empty()) {
+        heap.push_back({feeds[k].bars_->timestamps()[0], static_cast<std::uint32_t>(k), 0});
+      }
+    }
+    std::make_heap(heap.begin(), heap.end(), later);
+
+    std::vector<OrderRequest> orders;
+    orders.reserve(16);
+
+    // Executes one order and books the fill; returns false if it was rejected.
+    auto fill = [&](std::size_t k, Side side, double qty, const domain::Quote& bar) {
+      const Order ORDER(feeds[k].instrument_, side, qty, OrderType::Market, toTimePoint(bar.ts_));
+      auto trade = exec_.execute(ORDER, bar, pf.cash(), held(k));
+      if (!trade) return false;
+
+      pf.applyTrade(ids[k], *trade);
+      const double DELTA = trade->side() == Side::Buy ? trade->quantity() : -trade->quantity();
+      holdings += DELTA * last_close[k];
+      if (trade->side() == Side::Buy) r.trades_executed_ += 1;
+      strat.onFill(k, *trade);
+      return true;
+    };
+
+    strat.onStart(K);
+
+    while (!heap.empty()) {
+      std::pop_heap(heap.begin(), heap.end(), later);
+      Cursor& cur = heap.back();
+      const std::size_t K_IDX = cur.feed;
+      const BarSeries& bars   = *feeds[K_IDX].bars_;
+      const auto Q            = bars[cur.pos];
+
+      holdings += held(K_IDX) * (Q.close_ - last_close[K_IDX]);
+      last_close[K_IDX] = Q.close_;
+      seen[K_IDX] = cur.pos + 1;
+
+      orders.clear();
+      strat.onBar(K_IDX, Q, orders);
+      for (const auto& o : orders) {
+        if (o.instrument_ >= K) throw std::out_of_range("PortfolioEngine: order for unknown instrument");
+        if (o.instrument_ == K_IDX) {
+          fill(K_IDX, o.side_, o.qty_, Q);
+        } else if (seen[o.instrument_] > 0) {
+          // Other instruments trade at their latest bar; before their first bar there is no price.
+          fill(o.instrument_, o.side_, o.qty_, (*feeds[o.instrument_].bars_)[seen[o.instrument_] - 1]);
+        }
+      }
+
+      const std::int64_t TS = cur.ts;
+      if (++cur.pos < bars.size()) {
+        cur.ts = bars.timestamps()[cur.pos];
+        std::push_heap(heap.begin(), heap.end(), later);
+      } else {
+        heap.pop_back();
+      }
+
+      // Mark the portfolio once all instruments of this timestamp are processed.
+      if (MARK && (heap.empty() || heap.front().ts != TS)) {
+        curve.update(pf.cash() + holdings, record_, r);
+      }
+    }
+
+    strat.onFinish();
+
+    for (std::size_t k = 0; k < K; ++k) {
+      if (held(k) > 0.0) fill(k, Side::Sell, held(k), feeds[k].bars_->end());
+    }
+
+    r.final_equity_ = pf.cash();  // everything is liquidated
+    if (portfolio) *portfolio = std::move(pf);
+    return r;
+  }
+
+} // namespace qga::domain::backtest
@@ -0,0 +1,136 @@
+#include "domain/backtest/SweepRunner.hpp"
+#include "core/Config.hpp"
+#include "core/ThreadPool.hpp"
+#include "strategy/MACrossover.hpp"
+#include <algorithm>
+#include <future>
+#include <optional>
+#include <stdexcept>
+
+namespace qga::domain::backtest{
+
+  namespace {
+
+    /// Collects the filled slots and sorts them by final equity (stable: ties keep grid order).
+    std::vector<SweepRow> rank(std::vector<std::optional<SweepRow>>& slots) {
+      std::vector<SweepRow> table;
+      table.reserve(slots.size());
+      for (auto& s : slots) {
+        if (s) table.push_back(std::move(*s));
+      }
+      std::stable_sort(table.begin(), table.end(), [](const SweepRow& a, const SweepRow& b) {
+        return a.result_.final_equity_ > b.result_.final_equity_;
+      });
+      return table;
+    }
+
+  } // namespace
+
+  // === ParamGrid ===
+
+  ParamGrid& ParamGrid::add(ParamRange range) {
+    if (range.step_ <= 0) throw std::invalid_argument("ParamGrid: step must be positive for " + range.name_);
+    if (range.last_ < range.first_) throw std::invalid_argument("ParamGrid: empty range for " + range.name_);
+    ranges_.push_back(std::move(range));
+    return *this;
+  }
+
+  std::size_t ParamGrid::size() const noexcept {
+    if (ranges_.empty()) return 0;
+    std::size_t n = 1;
+    for (const auto& r : ranges_) n *= static_cast<std::size_t>((r.last_ - r.first_) / r.step_ + 1);
+    return n;
+  }
+
+  ParamPoint ParamGrid::point(std::size_t i) const {
+    if (i >= size()) throw std::out_of_range("ParamGrid::point index out of range");
+    ParamPoint p(ranges_.size());
+    for (std::size_t d = ranges_.size(); d-- > 0;) {
+      const auto& r      = ranges_[d];
+      const auto  COUNT  = static_cast<std::size_t>((r.last_ - r.first_) / r.step_ + 1);
+      p[d] = r.first_ + static_cast<int>(i % COUNT) * r.step_;
+      i /= COUNT;
+    }
+    return p;
+  }
+
+  // === Factories ===
+
+  StrategyFactory maCrossoverFactory() {
+    return [](const ParamPoint& p) -> std::unique_ptr<strategy::IStrategy> {
+      if (p.size() != 2) throw std::invalid_argument("maCrossoverFactory expects (fast, slow)");
+      if (p[0] >= p[1]) return nullptr;
+      return std::make_unique<strategy::MACrossover>(p[0], p[1]);
+    };
+  }
+
+  GraphStrategyFactory maCrossoverGraphFactory() {
+    return [](const ParamPoint& p) -> std::unique_ptr<strategy::IGraphStrategy> {
+      if (p.size() != 2) throw std::invalid_argument("maCrossoverGraphFactory expects (fast, slow)");
+      if (p[0] >= p[1]) return nullptr;
+      return std::make_unique<strategy::MACrossover>(p[0], p[1]);
+    };
+  }
+
+  // === SweepRunner ===
+
+  std::vector<SweepRow> SweepRunner::run(const BarSeries& series, const ParamGrid& grid,
+                                         const StrategyFactory& factory) const {
+    const std::size_t N = grid.size();
+    std::vector<std::optional<SweepRow>> slots(N);  // one slot per point: no locking on write
+
+    {
+      core::ThreadPool pool(threads_ > 0 ? threads_ : core::Config::getInstance().threads());
+      std::vector<std::future<void>> done;
+      done.reserve(N);
+      for (std::size_t i = 0; i < N; ++i) {
+        done.push_back(pool.submit([&, i] {
+          auto params = grid.point(i);
+          auto strat  = factory(params);
+          if (!strat) return;
+          slots[i] = SweepRow{std::move(params), engine_.run(series, *strat)};
+        }));
+      }
+      for (auto& f : done) f.get();
+    }
+
+    return rank(slots);
+  }
+
+  std::vector<SweepRow> SweepRunner::runShared(const BarSeries& series, const ParamGrid& grid,
+                                               const GraphStrategyFactory& factory) const {
+    const std::size_t N = grid.size();
+    std::vector<std::optional<SweepRow>> slots(N);
+
+    {
+      core::ThreadPool pool(threads_ > 0 ? threads_ : core::Config::getInstance().threads());
+      // Contiguous groups: neighbouring points differ in the last parameter
+      // only, so they share the most indicators.
+      const std::size_t GROUPS = std::min(N, pool.size());
+      std::vector<std::future<void>> done;
+      done.reserve(GROUPS);
+      for (std::size_t g = 0; g < GROUPS; ++g) {
+        done.push_back(pool.submit([&, g] {
+          std::vector<std::unique_ptr<strategy::IGraphStrategy>> owned;
+          std::vector<strategy::IGraphStrategy*> strats;
+          std::vector<std::size_t> points;
+          for (std::size_t i = g * N / GROUPS; i < (g + 1) * N / GROUPS; ++i) {
+            auto strat = factory(grid.point(i));
+            if (!strat) continue;
+            strats.push_back(strat.get());
+            owned.push_back(std::move(strat));
+            points.push_back(i);
+          }
+
+          auto results = engine_.runMany(series, strats);
+          for (std::size_t k = 0; k < points.size(); ++k)
+            slots[points[k]] = SweepRow{grid.point(points[k]), std::move(results[k])};
+        }));
+      }
+      for (auto& f : done) f.get();
+    }
+
+    return rank(slots);
+  }
+
+} // namespace qga::domain::backtest
@@ -0,0 +1,325 @@
+#include "indicators/Indicators.hpp"
+#include "Kernels.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace qga::indicators
+{
+
+    namespace
+    {
+        constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+
+        // Outputs per rolling block; each block starts from an exact window sum.
+        constexpr std::size_t BLOCK = 4096;
+
+        // Scratch size for kernels whose intermediates do not fit in the output.
+        constexpr std::size_t CHUNK = 1024;
+
+        std::atomic<SimdLevel>& currentLevel() noexcept
+        {
+            static std::atomic<SimdLevel> level{detectSimdLevel()};
+            return level;
+        }
+
+        const detail::Kernels& kernels() noexcept
+        {
+            switch (currentLevel().load(std::memory_order_relaxed))
+            {
+            case SimdLevel::AVX512:
+                return *detail::avx512Kernels();
+            case SimdLevel::AVX2:
+                return *detail::avx2Kernels();
+            case SimdLevel::Scalar:
+                break;
+            }
+            return detail::SCALAR_KERNELS;
+        }
+
+        void check(const char* name, std::size_t period, std::size_t n, std::size_t out_n)
+        {
+            if (period == 0)
+                throw std::invalid_argument(std::string(name) + ": period must be > 0");
+            if (n != out_n)
+                throw std::invalid_argument(std::string(name) + ": input and output sizes differ");
+        }
+
+        void fillWarmup(std::span<double> out, std::size_t count)
+        {
+            std::fill_n(out.begin(), std::min(count, out.size()), NaN);
+        }
+
+        double windowSum(const double* first, std::size_t period)
+        {
+            double s = 0.0;
+            for (std::size_t j = 0; j < period; ++j)
+                s += first[j];
+            return s;
+        }
+
+        double rsiValue(double avg_gain, double avg_loss)
+        {
+            if (avg_loss == 0.0)
+                return avg_gain == 0.0 ? 50.0 : 100.0;
+            return 100.0 - 100.0 / (1.0 + avg_gain / avg_loss);
+        }
+
+        // Monotonic deque of indices kept in a ring of `period` slots: the front
+        // is the extremum of the window, values the new bar dominates are dropped
+        // from the back. Every index is pushed and popped once, so O(n) overall.
+        template <typename Dominates>
+        void rollingExtremum(std::span<const double> in, std::size_t period, std::span<double> out,
+                             Dominates dominates)
+        {
+            const std::size_t n = in.size();
+            std::vector<std::size_t> ring(period);
+            std::size_t head = 0;
+            std::size_t count = 0;
+
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                if (count > 0 && ring[head] + period <= i)
+                {
+                    head = head + 1 == period ? 0 : head + 1;
+                    --count;
+                }
+                while (count > 0)
+                {
+                    std::size_t back = head + count - 1;
+                    if (back >= period)
+                        back -= period;
+                    if (!dominates(in[i], in[ring[back]]))
+                        break;
+                    --count;
+                }
+                std::size_t slot = head + count;
+                if (slot >= period)
+                    slot -= period;
+                ring[slot] = i;
+                ++count;
+
+                out[i] = i + 1 >= period ? in[ring[head]] : NaN;
+            }
+        }
+    } // namespace
+
+    SimdLevel detectSimdLevel() noexcept
+    {
+#if defined(__GNUC__) && defined(__x86_64__)
+        static const SimdLevel DETECTED = [] {
+            __builtin_cpu_init();
+            if (detail::avx512Kernels() && __builtin_cpu_supports("avx512f"))
+                return SimdLevel::AVX512;
+            if (detail::avx2Kernels() && __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+                return SimdLevel::AVX2;
+            return SimdLevel::Scalar;
+        }();
+        return DETECTED;
+#else
+        return SimdLevel::Scalar;
+#endif
+    }
+
+    SimdLevel simdLevel() noexcept
+    {
+        return currentLevel().load(std::memory_order_relaxed);
+    }
+
+    SimdLevel setSimdLevel(SimdLevel level) noexcept
+    {
+        level = std::min(level, detectSimdLevel());
+        currentLevel().store(level, std::memory_order_relaxed);
+        return level;
+    }
+
+    const char* toString(SimdLevel level) noexcept
+    {
+        switch (level)
+        {
+        case SimdLevel::AVX512:
+            return "avx512";
+        case SimdLevel::AVX2:
+            return "avx2";
+        case SimdLevel::Scalar:
+            break;
+        }
+        return "scalar";
+    }
+
+    void sma(std::span<const double> in, std::size_t period, std::span<double> out)
+    {
+        check("sma", period, in.size(), out.size());
+        const std::size_t n = in.size();
+        fillWarmup(out, period - 1);
+        if (n < period)
+            return;
+
+        const detail::Kernels& k = kernels();
+        const std::size_t block = std::max(BLOCK, period);
+        const double p = static_cast<double>(period);
+
+        // out[i] = out[i-1] + in[i] - in[i-p], evaluated as a prefix sum of the
+        // lagged differences, seeded with the exact window sum of the block.
+        for (std::size_t i0 = period - 1; i0 < n; i0 += block)
+        {
+            const std::size_t len = std::min(block, n - i0);
+            out[i0] = windowSum(&in[i0 + 1 - period], period);
+            k.sub(&in[i0] + 1, &in[i0 + 1 - period], &out[i0] + 1, len - 1);
+            k.prefixSum(&out[i0] + 1, len - 1, out[i0]);
+            k.divide(&out[i0], len, p);
+        }
+    }
+
+    void ema(std::span<const double> in, std::size_t period, std::span<double> out)
+    {
+        check("ema", period, in.size(), out.size());
+        const std::size_t n = in.size();
+        fillWarmup(out, period - 1);
+        if (n < period)
+            return;
+
+        // Each value depends on the previous one: nothing to vectorize.
+        const double alpha = 2.0 / (static_cast<double>(period) + 1.0);
+        double e = windowSum(in.data(), period) / static_cast<double>(period);
+        out[period - 1] = e;
+        for (std::size_t i = period; i < n; ++i)
+        {
+            e += alpha * (in[i] - e);
+            out[i] = e;
+        }
+    }
+
+    void rsi(std::span<const double> close, std::size_t period, std::span<double> out)
+    {
+        check("rsi", period, close.size(), out.size());
+        const std::size_t n = close.size();
+        fillWarmup(out, period);
+        if (n <= period)
+            return;
+
+        const detail::Kernels& k = kernels();
+        const double p = static_cast<double>(period);
+        const double inv_p = 1.0 / p;
+        double gain[CHUNK];
+        double loss[CHUNK];
+        double avg_gain = 0.0;
+        double avg_loss = 0.0;
+
+        // Gains/losses of change j = close[j] - close[j-1] are split in vector
+        // chunks; the Wilder smoothing that consumes them is sequential.
+        for (std::size_t j0 = 1; j0 < n; j0 += CHUNK)
+        {
+            const std::size_t len = std::min(CHUNK, n - j0);
+            k.gainLoss(&close[j0], &close[j0 - 1], gain, loss, len);
+            for (std::size_t t = 0; t < len; ++t)
+            {
+                const std::size_t j = j0 + t;
+                if (j < period)
+                {
+                    avg_gain += gain[t];
+                    avg_loss += loss[t];
+                    continue;
+                }
+                if (j == period)
+                {
+                    avg_gain = (avg_gain + gain[t]) / p;
+                    avg_loss = (avg_loss + loss[t]) / p;
+                }
+                else
+                {
+                    avg_gain += (gain[t] - avg_gain) * inv_p;
+                    avg_loss += (loss[t] - avg_loss) * inv_p;
+                }
+                out[j] = rsiValue(avg_gain, avg_loss);
+            }
+        }
+    }
+
+    void atr(std::span<const double> high, std::span<const double> low, std::span<const double> close,
+             std::size_t period, std::span<double> out)
+    {
+        check("atr", period, close.size(), out.size());
+        if (high.size() != close.size() || low.size() != close.size())
+            throw std::invalid_argument("atr: high, low and close sizes differ");
+        const std::size_t n = close.size();
+        if (n < period)
+        {
+            fillWarmup(out, n);
+            return;
+        }
+
+        // True range in place, then Wilder smoothing over it. The smoothing
+        // `(a * (p - 1) + x) / p` is written as `a + (x - a) / p` with a
+        // precomputed reciprocal to keep the division off the dependency chain.
+        out[0] = high[0] - low[0];
+        kernels().trueRange(&high[0] + 1, &low[0] + 1, &close[0], &out[0] + 1, n - 1);
+
+        const double p = static_cast<double>(period);
+        const double inv_p = 1.0 / p;
+        double a = windowSum(out.data(), period) / p;
+        fillWarmup(out, period - 1);
+        out[period - 1] = a;
+        for (std::size_t i = period; i < n; ++i)
+        {
+            a += (out[i] - a) * inv_p;
+            out[i] = a;
+        }
+    }
+
+    void bollinger(std::span<const double> in, std::size_t period, double k, std::span<double> mid,
+                   std::span<double> upper, std::span<double> lower)
+    {
+        check("bollinger", period, in.size(), mid.size());
+        if (upper.size() != in.size() || lower.size() != in.size())
+            throw std::invalid_argument("bollinger: input and output sizes differ");
+        const std::size_t n = in.size();
+        fillWarmup(mid, period - 1);
+        fillWarmup(upper, period - 1);
+        fillWarmup(lower, period - 1);
+        if (n < period)
+            return;
+
+        const detail::Kernels& kt = kernels();
+        const std::size_t block = std::max(BLOCK, period);
+        const double p = static_cast<double>(period);
+
+        // Same rolling scheme as sma() for the sum (in mid) and for the sum of
+        // squares around the block's first value (in upper).
+        for (std::size_t i0 = period - 1; i0 < n; i0 += block)
+        {
+            const std::size_t len = std::min(block, n - i0);
+            const double* first = &in[i0 + 1 - period];
+            const double shift = in[i0];
+
+            double sq = 0.0;
+            for (std::size_t j = 0; j < period; ++j)
+                sq += (first[j] - shift) * (first[j] - shift);
+
+            mid[i0] = windowSum(first, period);
+            upper[i0] = sq;
+            kt.sub(&in[i0] + 1, first, &mid[i0] + 1, len - 1);
+            kt.prefixSum(&mid[i0] + 1, len - 1, mid[i0]);
+            kt.subSquares(&in[i0] + 1, first, shift, &upper[i0] + 1, len - 1);
+            kt.prefixSum(&upper[i0] + 1, len - 1, upper[i0]);
+            kt.bands(&mid[i0], &upper[i0], &upper[i0], &lower[i0], len, p, shift, k);
+        }
+    }
+
+    void rollingMin(std::span<const double> in, std::size_t period, std::span<double> out)
+    {
+        check("rollingMin", period, in.size(), out.size());
+        rollingExtremum(in, period, out, [](double x, double y) { return x <= y; });
+    }
+
+    void rollingMax(std::span<const double> in, std::size_t period, std::span<double> out)
+    {
+        check("rollingMax", period, in.size(), out.size());
+        rollingExtremum(in, period, out, [](double x, double y) { return x >= y; });
+    }
+
+} // namespace qga::indicators
@@ -0,0 +1,51 @@
+/**
+ * @file Kernels.hpp
+ * @brief Internal: per-instruction-set building blocks of the indicator library.
+ *
+ * Each table holds the data-parallel steps the indicators are composed of;
+ * Indicators.cpp picks one table at runtime. Tables for instruction sets the
+ * compiler or CPU cannot use are null.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace qga::indicators::detail
+{
+
+    struct Kernels
+    {
+        /// out[i] = a[i] - b[i]
+        void (*sub)(const double* a, const double* b, double* out, std::size_t n);
+
+        /// out[i] = (a[i] - s)^2 - (b[i] - s)^2
+        void (*subSquares)(const double* a, const double* b, double s, double* out, std::size_t n);
+
+        /// In place: x[i] = carry + x[0] + ... + x[i]; returns the last value (or carry if n == 0).
+        double (*prefixSum)(double* x, std::size_t n, double carry);
+
+        /// x[i] /= d
+        void (*divide)(double* x, std::size_t n, double d);
+
+        /// mid[i] = sum[i] / p; sd from the shifted sum of squares; upper/lower = mid ± k * sd.
+        /// @p sumsq may alias @p upper.
+        void (*bands)(double* mid, const double* sumsq, double* upper, double* lower, std::size_t n,
+                      double p, double shift, double k);
+
+        /// out[i] = max(h[i] - l[i], |h[i] - pc[i]|, |l[i] - pc[i]|)
+        void (*trueRange)(const double* h, const double* l, const double* pc, double* out, std::size_t n);
+
+        /// d = a[i] - b[i]; gain[i] = max(d, 0); loss[i] = max(-d, 0)
+        void (*gainLoss)(const double* a, const double* b, double* gain, double* loss, std::size_t n);
+    };
+
+    extern const Kernels SCALAR_KERNELS;
+
+    /// @return AVX2 table, or nullptr if not compiled in.
+    const Kernels* avx2Kernels() noexcept;
+
+    /// @return AVX-512 table, or nullptr if not compiled in.
+    const Kernels* avx512Kernels() noexcept;
+
+} // namespace qga::indicators::detail
@@ -0,0 +1,173 @@
+#include "Kernels.hpp"
+
+#if defined(__GNUC__) && defined(__x86_64__)
+
+#include <immintrin.h>
+#include <algorithm>
+#include <cmath>
+
+#define QGA_AVX2 __attribute__((target("avx2,fma")))
+
+namespace qga::indicators::detail
+{
+
+    namespace
+    {
+        constexpr std::size_t W = 4;
+
+        QGA_AVX2 void subAvx2(const double* a, const double* b, double* out, std::size_t n)
+        {
+            std::size_t i = 0;
+            for (; i + W <= n; i += W)
+                _mm256_storeu_pd(out + i, _mm256_sub_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i)));
+            for (; i < n; ++i)
+                out[i] = a[i] - b[i];
+        }
+
+        QGA_AVX2 void subSquaresAvx2(const double* a, const double* b, double s, double* out, std::size_t n)
+        {
+            const __m256d vs = _mm256_set1_pd(s);
+            std::size_t i = 0;
+            for (; i + W <= n; i += W)
+            {
+                const __m256d x = _mm256_sub_pd(_mm256_loadu_pd(a + i), vs);
+                const __m256d y = _mm256_sub_pd(_mm256_loadu_pd(b + i), vs);
+                _mm256_storeu_pd(out + i, _mm256_sub_pd(_mm256_mul_pd(x, x), _mm256_mul_pd(y, y)));
+            }
+            for (; i < n; ++i)
+            {
+                const double x = a[i] - s;
+                const double y = b[i] - s;
+                out[i] = x * x - y * y;
+            }
+        }
+
+        // In-register inclusive scan: log2(4) shift-and-add steps, then add the
+        // running total of the previous vectors.
+        QGA_AVX2 double prefixSumAvx2(double* x, std::size_t n, double carry)
+        {
+            const __m256d zero = _mm256_setzero_pd();
+            __m256d vc = _mm256_set1_pd(carry);
+            std::size_t i = 0;
+            for (; i + W <= n; i += W)
+            {
+                __m256d v = _mm256_loadu_pd(x + i);
+                // [a b c d] + [0 a b c]
+                v = _mm256_add_pd(v, _mm256_blend_pd(_mm256_permute4x64_pd(v, _MM_SHUFFLE(2, 1, 0, 0)), zero, 0b0001));
+                // + [0 0 a b']
+                v = _mm256_add_pd(v, _mm256_permute2f128_pd(v, v, 0x08));
+                v = _mm256_add_pd(v, vc);
+                _mm256_storeu_pd(x + i, v);
+                vc = _mm256_permute4x64_pd(v, _MM_SHUFFLE(3, 3, 3, 3));
+            }
+            carry = _mm256_cvtsd_f64(vc);
+            for (; i < n; ++i)
+            {
+                carry += x[i];
+                x[i] = carry;
+            }
+            return carry;
+        }
+
+        QGA_AVX2 void divideAvx2(double* x, std::size_t n, double d)
+        {
+            const __m256d vd = _mm256_set1_pd(d);
+            std::size_t i = 0;
+            for (; i + W <= n; i += W)
+                _mm256_storeu_pd(x + i, _mm256_div_pd(_mm256_loadu_pd(x + i), vd));
+            for (; i < n; ++i)
+                x[i] /= d;
+        }
+
+        QGA_AVX2 void bandsAvx2(double* mid, const double* sumsq, double* upper, double* lower, std::size_t n,
+                                double p, double shift, double k)
+        {
+            const __m256d vp = _mm256_set1_pd(p);
+            const __m256d vs = _mm256_set1_pd(shift);
+            const __m256d vk = _mm256_set1_pd(k);
+            const __m256d zero = _mm256_setzero_pd();
+            std::size_t i = 0;
+            for (; i + W <= n; i += W)
+            {
+                const __m256d m = _mm256_div_pd(_mm256_loadu_pd(mid + i), vp);
+                const __m256d dm = _mm256_sub_pd(m, vs);
+                const __m256d var = _mm256_max_pd(_mm256_sub_pd(_mm256_div_pd(_mm256_loadu_pd(sumsq + i), vp),
+                                                                _mm256_mul_pd(dm, dm)),
+                                                  zero);
+                const __m256d w = _mm256_mul_pd(vk, _mm256_sqrt_pd(var));
+                _mm256_storeu_pd(mid + i, m);
+                _mm256_storeu_pd(upper + i, _mm256_add_pd(m, w));
+                _mm256_storeu_pd(lower + i, _mm256_sub_pd(m, w));
+            }
+            for (; i < n; ++i)
+            {
+                const double m = mid[i] / p;
+                const double dm = m - shift;
+                const double w = k * std::sqrt(std::max(sumsq[i] / p - dm * dm, 0.0));
+                mid[i] = m;
+                upper[i] = m + w;
+                lower[i] = m - w;
+            }
+        }
+
+        QGA_AVX2 void trueRangeAvx2(const double* h, const double* l, const double* pc, double* out, std::size_t n)
+        {
+            const __m256d sign = _mm256_set1_pd(-0.0);
+            std::size_t i = 0;
+            for (; i + W <= n; i += W)
+            {
+                const __m256d vh = _mm256_loadu_pd(h + i);
+                const __m256d vl = _mm256_loadu_pd(l + i);
+                const __m256d vc = _mm256_loadu_pd(pc + i);
+                const __m256d hl = _mm256_sub_pd(vh, vl);
+                const __m256d hc = _mm256_andnot_pd(sign, _mm256_sub_pd(vh, vc));
+                const __m256d lc = _mm256_andnot_pd(sign, _mm256_sub_pd(vl, vc));
+                _mm256_storeu_pd(out + i, _mm256_max_pd(hl, _mm256_max_pd(hc, lc)));
+            }
+            for (; i < n; ++i)
+                out[i] = std::max({h[i] - l[i], std::abs(h[i] - pc[i]), std::abs(l[i] - pc[i])});
+        }
+
+        QGA_AVX2 void gainLossAvx2(const double* a, const double* b, double* gain, double* loss, std::size_t n)
+        {
+            const __m256d zero = _mm256_setzero_pd();
+            std::size_t i = 0;
+            for (; i + W <= n; i += W)
+            {
+                const __m256d d = _mm256_sub_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i));
+                _mm256_storeu_pd(gain + i, _mm256_max_pd(d, zero));
+                _mm256_storeu_pd(loss + i, _mm256_max_pd(_mm256_sub_pd(zero, d), zero));
+            }
+            for (; i < n; ++i)
+            {
+                const double d = a[i] - b[i];
+                gain[i] = std::max(d, 0.0);
+                loss[i] = std::max(-d, 0.0);
+            }
+        }
+
+        const Kernels AVX2_KERNELS{
+            subAvx2, subSquaresAvx2, prefixSumAvx2, divideAvx2, bandsAvx2, trueRangeAvx2, gainLossAvx2,
+        };
+    } // namespace
+
+    const Kernels* avx2Kernels() noexcept
+    {
+        return &AVX2_KERNELS;
+    }
+
+} // namespace qga::indicators::detail
+
+#else
+
+namespace qga::indicators::detail
+{
+
+    const Kernels* avx2Kernels() noexcept
+    {
+        return nullptr;
+    }
+
+} // namespace qga::indicators::detail
+
+#endif
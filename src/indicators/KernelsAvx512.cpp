@@ -0,0 +1,179 @@
+#include "Kernels.hpp"
+
+#if defined(__GNUC__) && defined(__x86_64__)
+
+#include <immintrin.h>
+#include <algorithm>
+#include <cmath>
+
+#define QGA_AVX512 __attribute__((target("avx512f")))
+
+// GCC 12's AVX-512 intrinsics pass _mm512_undefined_pd() as the unused merge
+// source, which -Wmaybe-uninitialized reports once inlined here.
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+namespace qga::indicators::detail
+{
+
+    namespace
+    {
+        constexpr std::size_t W = 8;
+
+        QGA_AVX512 void subAvx512(const double* a, const double* b, double* out, std::size_t n)
+        {
+            std::size_t i = 0;
+            for (; i + W <= n; i += W)
+                _mm512_storeu_pd(out + i, _mm512_sub_pd(_mm512_loadu_pd(a + i), _mm512_loadu_pd(b + i)));
+            for (; i < n; ++i)
+                out[i] = a[i] - b[i];
+        }
+
+        QGA_AVX512 void subSquaresAvx512(const double* a, const double* b, double s, double* out, std::size_t n)
+        {
+            const __m512d vs = _mm512_set1_pd(s);
+            std::size_t i = 0;
+            for (; i + W <= n; i += W)
+            {
+                const __m512d x = _mm512_sub_pd(_mm512_loadu_pd(a + i), vs);
+                const __m512d y = _mm512_sub_pd(_mm512_loadu_pd(b + i), vs);
+                _mm512_storeu_pd(out + i, _mm512_sub_pd(_mm512_mul_pd(x, x), _mm512_mul_pd(y, y)));
+            }
+            for (; i < n; ++i)
+            {
+                const double x = a[i] - s;
+                const double y = b[i] - s;
+                out[i] = x * x - y * y;
+            }
+        }
+
+        // In-register inclusive scan: shifts by 1, 2 and 4 lanes (zero-filled
+        // through the mask), then add the running total of the previous vectors.
+        QGA_AVX512 double prefixSumAvx512(double* x, std::size_t n, double carry)
+        {
+            const __m512i s1 = _mm512_set_epi64(6, 5, 4, 3, 2, 1, 0, 0);
+            const __m512i s2 = _mm512_set_epi64(5, 4, 3, 2, 1, 0, 0, 0);
+            const __m512i s4 = _mm512_set_epi64(3, 2, 1, 0, 0, 0, 0, 0);
+            const __m512i last = _mm512_set1_epi64(7);
+            __m512d vc = _mm512_set1_pd(carry);
+            std::size_t i = 0;
+            for (; i + W <= n; i += W)
+            {
+                __m512d v = _mm512_loadu_pd(x + i);
+                v = _mm512_add_pd(v, _mm512_maskz_permutexvar_pd(0xFE, s1, v));
+                v = _mm512_add_pd(v, _mm512_maskz_permutexvar_pd(0xFC, s2, v));
+                v = _mm512_add_pd(v, _mm512_maskz_permutexvar_pd(0xF0, s4, v));
+                v = _mm512_add_pd(v, vc);
+                _mm512_storeu_pd(x + i, v);
+                vc = _mm512_permutexvar_pd(last, v);
+            }
+            carry = _mm512_cvtsd_f64(vc);
+            for (; i < n; ++i)
+            {
+                carry += x[i];
+                x[i] = carry;
+            }
+            return carry;
+        }
+
+        QGA_AVX512 void divideAvx512(double* x, std::size_t n, double d)
+        {
+            const __m512d vd = _mm512_set1_pd(d);
+            std::size_t i = 0;
+            for (; i + W <= n; i += W)
+                _mm512_storeu_pd(x + i, _mm512_div_pd(_mm512_loadu_pd(x + i), vd));
+            for (; i < n; ++i)
+                x[i] /= d;
+        }
+
+        QGA_AVX512 void bandsAvx512(double* mid, const double* sumsq, double* upper, double* lower, std::size_t n,
+                                    double p, double shift, double k)
+        {
+            const __m512d vp = _mm512_set1_pd(p);
+            const __m512d vs = _mm512_set1_pd(shift);
+            const __m512d vk = _mm512_set1_pd(k);
+            const __m512d zero = _mm512_setzero_pd();
+            std::size_t i = 0;
+            for (; i + W <= n; i += W)
+            {
+                const __m512d m = _mm512_div_pd(_mm512_loadu_pd(mid + i), vp);
+                const __m512d dm = _mm512_sub_pd(m, vs);
+                const __m512d var = _mm512_max_pd(_mm512_sub_pd(_mm512_div_pd(_mm512_loadu_pd(sumsq + i), vp),
+                                                                _mm512_mul_pd(dm, dm)),
+                                                  zero);
+                const __m512d w = _mm512_mul_pd(vk, _mm512_sqrt_pd(var));
+                _mm512_storeu_pd(mid + i, m);
+                _mm512_storeu_pd(upper + i, _mm512_add_pd(m, w));
+                _mm512_storeu_pd(lower + i, _mm512_sub_pd(m, w));
+            }
+            for (; i < n; ++i)
+            {
+                const double m = mid[i] / p;
+                const double dm = m - shift;
+                const double w = k * std::sqrt(std::max(sumsq[i] / p - dm * dm, 0.0));
+                mid[i] = m;
+                upper[i] = m + w;
+                lower[i] = m - w;
+            }
+        }
+
+        QGA_AVX512 void trueRangeAvx512(const double* h, const double* l, const double* pc, double* out,
+                                        std::size_t n)
+        {
+            std::size_t i = 0;
+            for (; i + W <= n; i += W)
+            {
+                const __m512d vh = _mm512_loadu_pd(h + i);
+                const __m512d vl = _mm512_loadu_pd(l + i);
+                const __m512d vc = _mm512_loadu_pd(pc + i);
+                const __m512d hl = _mm512_sub_pd(vh, vl);
+                const __m512d hc = _mm512_abs_pd(_mm512_sub_pd(vh, vc));
+                const __m512d lc = _mm512_abs_pd(_mm512_sub_pd(vl, vc));
+                _mm512_storeu_pd(out + i, _mm512_max_pd(hl, _mm512_max_pd(hc, lc)));
+            }
+            for (; i < n; ++i)
+                out[i] = std::max({h[i] - l[i], std::abs(h[i] - pc[i]), std::abs(l[i] - pc[i])});
+        }
+
+        QGA_AVX512 void gainLossAvx512(const double* a, const double* b, double* gain, double* loss, std::size_t n)
+        {
+            const __m512d zero = _mm512_setzero_pd();
+            std::size_t i = 0;
+            for (; i + W <= n; i += W)
+            {
+                const __m512d d = _mm512_sub_pd(_mm512_loadu_pd(a + i), _mm512_loadu_pd(b + i));
+                _mm512_storeu_pd(gain + i, _mm512_max_pd(d, zero));
+                _mm512_storeu_pd(loss + i, _mm512_max_pd(_mm512_sub_pd(zero, d), zero));
+            }
+            for (; i < n; ++i)
+            {
+                const double d = a[i] - b[i];
+                gain[i] = std::max(d, 0.0);
+                loss[i] = std::max(-d, 0.0);
+            }
+        }
+
+        const Kernels AVX512_KERNELS{
+            subAvx512, subSquaresAvx512, prefixSumAvx512, divideAvx512, bandsAvx512, trueRangeAvx512, gainLossAvx512,
+        };
+    } // namespace
+
+    const Kernels* avx512Kernels() noexcept
+    {
+        return &AVX512_KERNELS;
+    }
+
+} // namespace qga::indicators::detail
+
+#else
+
+namespace qga::indicators::detail
+{
+
+    const Kernels* avx512Kernels() noexcept
+    {
+        return nullptr;
+    }
+
+} // namespace qga::indicators::detail
+
+#endif
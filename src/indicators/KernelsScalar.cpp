@@ -0,0 +1,79 @@
+#include "Kernels.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace qga::indicators::detail
+{
+
+    namespace
+    {
+        void subScalar(const double* a, const double* b, double* out, std::size_t n)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+                out[i] = a[i] - b[i];
+        }
+
+        void subSquaresScalar(const double* a, const double* b, double s, double* out, std::size_t n)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                const double x = a[i] - s;
+                const double y = b[i] - s;
+                out[i] = x * x - y * y;
+            }
+        }
+
+        double prefixSumScalar(double* x, std::size_t n, double carry)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                carry += x[i];
+                x[i] = carry;
+            }
+            return carry;
+        }
+
+        void divideScalar(double* x, std::size_t n, double d)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+                x[i] /= d;
+        }
+
+        void bandsScalar(double* mid, const double* sumsq, double* upper, double* lower, std::size_t n,
+                         double p, double shift, double k)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                const double m = mid[i] / p;
+                const double dm = m - shift;
+                const double var = std::max(sumsq[i] / p - dm * dm, 0.0);
+                const double w = k * std::sqrt(var);
+                mid[i] = m;
+                upper[i] = m + w;
+                lower[i] = m - w;
+            }
+        }
+
+        void trueRangeScalar(const double* h, const double* l, const double* pc, double* out, std::size_t n)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+                out[i] = std::max({h[i] - l[i], std::abs(h[i] - pc[i]), std::abs(l[i] - pc[i])});
+        }
+
+        void gainLossScalar(const double* a, const double* b, double* gain, double* loss, std::size_t n)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                const double d = a[i] - b[i];
+                gain[i] = std::max(d, 0.0);
+                loss[i] = std::max(-d, 0.0);
+            }
+        }
+    } // namespace
+
+    const Kernels SCALAR_KERNELS{
+        subScalar, subSquaresScalar, prefixSumScalar, divideScalar, bandsScalar, trueRangeScalar, gainLossScalar,
+    };
+
+} // namespace qga::indicators::detail
@@ -0,0 +1,184 @@
+#include "ingest/BarSources.hpp"
+#include "persistence/Statement.hpp"
+#include <curl/curl.h>
+#include <sqlite3.h>
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+
+    constexpr std::size_t CSV_BLOCK_SIZE = 64 * 1024;  // one block bounds the batch overshoot
+
+}   // namespace
+
+namespace qga::ingest {
+
+// === CsvFileBarSource ===
+
+CsvFileBarSource::CsvFileBarSource(const std::string& path)
+    : file_(std::fopen(path.c_str(), "rb"), &std::fclose),
+      parser_(sink_),
+      buffer_(std::make_unique<char[]>(CSV_BLOCK_SIZE)) {
+    if (!file_) throw std::runtime_error("CsvFileBarSource: cannot open " + path);
+}
+
+bool CsvFileBarSource::next(domain::backtest::BarSeries& batch, std::size_t max_bars) {
+    batch.clear();
+    parser_.setOutput(batch);
+    while (batch.size() < max_bars && !eof_) {
+        const std::size_t N = std::fread(buffer_.get(), 1, CSV_BLOCK_SIZE, file_.get());
+        if (N > 0) parser_.feed(std::string_view(buffer_.get(), N));
+        if (N < CSV_BLOCK_SIZE) {
+            if (std::ferror(file_.get())) {
+                parser_.setOutput(sink_);
+                throw std::runtime_error("CsvFileBarSource: read error");
+            }
+            eof_ = true;
+            parser_.finish();
+        }
+    }
+    parser_.setOutput(sink_);
+    return !batch.empty();
+}
+
+// === BarFileBarSource ===
+
+bool BarFileBarSource::next(domain::backtest::BarSeries& batch, std::size_t max_bars) {
+    batch.clear();
+    return reader_.read(batch, max_bars) > 0;
+}
+
+// === SqliteBarSource ===
+
+SqliteBarSource::SqliteBarSource(const std::string& db_path, const std::string& symbol) {
+    if (sqlite3_open_v2(db_path.c_str(), &db_, SQLITE_OPEN_READONLY, nullptr) != SQLITE_OK) {
+        const std::string MSG = db_ ? sqlite3_errmsg(db_) : "out of memory";
+        sqlite3_close(db_);
+        throw std::runtime_error("SqliteBarSource: could not open " + db_path + ": " + MSG);
+    }
+    try {
+        cursor_ = std::make_unique<persistence::Statement>(db_,
+            "SELECT ts, open, high, low, close, volume FROM quotes "
+            "WHERE symbol_id = (SELECT id FROM symbols WHERE name = ?) ORDER BY ts ASC;");
+        cursor_->bindText(1, symbol);
+    } catch (...) {
+        cursor_.reset();
+        sqlite3_close(db_);
+        throw;
+    }
+}
+
+SqliteBarSource::~SqliteBarSource() {
+    cursor_.reset();  // finalize before closing the connection
+    sqlite3_close(db_);
+}
+
+bool SqliteBarSource::next(domain::backtest::BarSeries& batch, std::size_t max_bars) {
+    batch.clear();
+    while (!done_ && batch.size() < max_bars) {
+        if (!cursor_->stepRow()) {
+            done_ = true;
+            break;
+        }
+        batch.add(domain::Quote{static_cast<std::int64_t>(cursor_->getColumnInt64(0)),
+                                cursor_->getColumnDouble(1), cursor_->getColumnDouble(2),
+                                cursor_->getColumnDouble(3), cursor_->getColumnDouble(4),
+                                cursor_->getColumnDouble(5)});
+    }
+    return !batch.empty();
+}
+
+// === HttpBarSource ===
+
+HttpBarSource::HttpBarSource(const std::string& url)
+    : url_(url), easy_(CurlHandlePool::shared().acquire()), parser_(sink_) {
+    multi_ = curl_multi_init();
+    if (!multi_) throw std::runtime_error("HttpBarSource: curl_multi_init failed");
+
+    CURL* easy = easy_.get();
+    curl_easy_setopt(easy, CURLOPT_URL, url_.c_str());
+    curl_easy_setopt(easy, CURLOPT_WRITEFUNCTION, &HttpBarSource::onData);
+    curl_easy_setopt(easy, CURLOPT_WRITEDATA, this);
+    curl_multi_add_handle(multi_, easy);
+}
+
+HttpBarSource::~HttpBarSource() {
+    curl_multi_remove_handle(multi_, easy_.get());
+    curl_multi_cleanup(multi_);
+}
+
+std::size_t HttpBarSource::onData(char* data, std::size_t size, std::size_t nmemb, void* self) {
+    auto* src = static_cast<HttpBarSource*>(self);
+    const std::size_t TOTAL = size * nmemb;
+
+    if (src->status_ == 0) {
+        curl_easy_getinfo(src->easy_.get(), CURLINFO_RESPONSE_CODE, &src->status_);
+    }
+    if (src->status_ >= 400) return 0;  // abort: error pages are not CSV
+
+    // Back-pressure: curl keeps the data and delivers it again after unpausing.
+    if (!src->batch_ || src->batch_->size() >= src->max_bars_) {
+        src->paused_ = true;
+        return CURL_WRITEFUNC_PAUSE;
+    }
+    src->parser_.feed(std::string_view(data, TOTAL));
+    return TOTAL;
+}
+
+bool HttpBarSource::next(domain::backtest::BarSeries& batch, std::size_t max_bars) {
+    batch.clear();
+    if (done_) return false;
+
+    CURL* easy = easy_.get();
+    CURLM* multi = multi_;
+
+    parser_.setOutput(batch);
+    batch_ = &batch;
+    max_bars_ = std::max<std::size_t>(max_bars, 1);
+    auto release = [this] {
+        parser_.setOutput(sink_);
+        batch_ = nullptr;
+    };
+
+    if (paused_) {
+        paused_ = false;
+        curl_easy_pause(easy, CURLPAUSE_CONT);  // may deliver the held data right away
+    }
+
+    CURLcode result = CURLE_OK;
+    while (!done_ && batch.size() < max_bars_ && !paused_) {
+        int running = 0;
+        if (curl_multi_perform(multi, &running) != CURLM_OK) {
+            release();
+            throw std::runtime_error("HttpBarSource: curl_multi_perform failed for " + url_);
+        }
+        if (running == 0) {
+            int queued = 0;
+            while (CURLMsg* msg = curl_multi_info_read(multi, &queued)) {
+                if (msg->msg == CURLMSG_DONE) result = msg->data.result;
+            }
+            done_ = true;
+            break;
+        }
+        if (!paused_) curl_multi_poll(multi, nullptr, 0, 100, nullptr);
+    }
+
+    if (done_) {
+        if (status_ == 0) curl_easy_getinfo(easy, CURLINFO_RESPONSE_CODE, &status_);
+        if (status_ >= 400) {
+            release();
+            throw std::runtime_error("HttpBarSource: HTTP " + std::to_string(status_) + " from " + url_);
+        }
+        if (result != CURLE_OK) {
+            release();
+            throw std::runtime_error("HttpBarSource: " + std::string(curl_easy_strerror(result)) +
+                                     " (" + url_ + ")");
+        }
+        parser_.finish();
+    }
+
+    release();
+    return !batch.empty();
+}
+
+} // namespace qga::ingest
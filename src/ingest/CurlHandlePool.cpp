@@ -0,0 +1,95 @@
+#include "ingest/CurlHandlePool.hpp"
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+    // === GLOBAL CURL INIT (RAII-style) ===
+    struct CurlGlobalInit {
+        CurlGlobalInit() { curl_global_init(CURL_GLOBAL_DEFAULT); }
+        ~CurlGlobalInit() { curl_global_cleanup(); }
+    };
+
+    void applyDefaults(CURL* h) {
+        curl_easy_setopt(h, CURLOPT_FOLLOWLOCATION, 1L);   // handle redirects
+        curl_easy_setopt(h, CURLOPT_ACCEPT_ENCODING, "");  // every encoding libcurl was built with
+        curl_easy_setopt(h, CURLOPT_TCP_KEEPALIVE, 1L);
+        curl_easy_setopt(h, CURLOPT_NOSIGNAL, 1L);         // safe to use from worker threads
+    }
+
+}   // namespace
+
+namespace qga::ingest {
+
+// === Lease ===
+
+CurlHandlePool::Lease::Lease(Lease&& other) noexcept
+    : pool_(std::exchange(other.pool_, nullptr)), handle_(std::exchange(other.handle_, nullptr)) {}
+
+CurlHandlePool::Lease& CurlHandlePool::Lease::operator=(Lease&& other) noexcept {
+    if (this != &other) {
+        release();
+        pool_ = std::exchange(other.pool_, nullptr);
+        handle_ = std::exchange(other.handle_, nullptr);
+    }
+    return *this;
+}
+
+void CurlHandlePool::Lease::release() noexcept {
+    if (pool_ && handle_) pool_->giveBack(handle_);
+    pool_ = nullptr;
+    handle_ = nullptr;
+}
+
+// === Pool ===
+
+CurlHandlePool::CurlHandlePool(std::size_t max_idle) : max_idle_(max_idle) {
+    idle_.reserve(max_idle_);  // giveBack() must not allocate
+}
+
+CurlHandlePool::~CurlHandlePool() {
+    for (CURL* h : idle_) curl_easy_cleanup(h);
+}
+
+CurlHandlePool& CurlHandlePool::shared() {
+    static CurlGlobalInit global_curl_init;  // constructed first, destroyed last
+    static CurlHandlePool pool;
+    return pool;
+}
+
+CurlHandlePool::Lease CurlHandlePool::acquire() {
+    CURL* h = nullptr;
+    {
+        std::lock_guard lock(mtx_);
+        if (!idle_.empty()) {
+            h = idle_.back();
+            idle_.pop_back();
+        }
+    }
+    if (h) {
+        curl_easy_reset(h);  // drops options, keeps connection/DNS/TLS caches
+    } else {
+        h = curl_easy_init();
+        if (!h) throw std::runtime_error("CurlHandlePool: curl_easy_init failed");
+    }
+    applyDefaults(h);
+    return Lease(this, h);
+}
+
+std::size_t CurlHandlePool::idle() const {
+    std::lock_guard lock(mtx_);
+    return idle_.size();
+}
+
+void CurlHandlePool::giveBack(CURL* handle) noexcept {
+    {
+        std::lock_guard lock(mtx_);
+        if (idle_.size() < max_idle_) {
+            idle_.push_back(handle);
+            return;
+        }
+    }
+    curl_easy_cleanup(handle);
+}
+
+} // namespace qga::ingest
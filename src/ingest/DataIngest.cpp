@@ -1,51 +1,42 @@
 #include "ingest/DataIngest.hpp"
-#include <fstream>
-#include <sstream>
-#include <iostream>
+#include "core/Config.hpp"
+#include "core/ThreadPool.hpp"
+#include "io/BarFile.hpp"
+#include "ingest/CurlHandlePool.hpp"
+#include "io/CsvBarParser.hpp"
+#include <algorithm>
+#include <deque>
 #include <curl/curl.h>  // For HTTP requests
-#include <ctime>
-#include <chrono>
-#include <iomanip>     // For std::get_time
 
 namespace {
 
-    // === GLOBAL CURL INIT (RAII-style) ===
-    struct CurlGlobalInit {
-        CurlGlobalInit() { curl_global_init(CURL_GLOBAL_DEFAULT); }
-        ~CurlGlobalInit() { curl_global_cleanup(); }
+    /// State shared with the libcurl write callback of fromHttpUrl().
+    struct HttpParseContext {
+        CURL* curl = nullptr;
+        qga::io::CsvBarParser* parser = nullptr;
+        long status = 0;
     };
 
-    CurlGlobalInit global_curl_init;
-
-    // === CALLBACK: Append HTTP body to std::string ===
-    size_t writeToString(void* contents, size_t size, size_t nmemb, std::string* userp) {
-        size_t total = size * nmemb;
-        auto* buffer = static_cast<std::string*>(userp);
-        buffer->append(static_cast<char*>(contents), total);
-        return total;
+    // === CALLBACK: Parse HTTP body chunks as they arrive ===
+    size_t feedParser(char* contents, size_t size, size_t nmemb, void* userp) {
+        auto* ctx = static_cast<HttpParseContext*>(userp);
+        const size_t TOTAL = size * nmemb;
+        if (ctx->status == 0) curl_easy_getinfo(ctx->curl, CURLINFO_RESPONSE_CODE, &ctx->status);
+        if (ctx->status >= 400) return 0;  // abort: error pages are not CSV
+        ctx->parser->feed(std::string_view(contents, TOTAL));
+        return TOTAL;
     }
 
-    // === HTTP GET using libcurl ===
-    std::optional<std::string> fetchHttpContent(const std::string& url) {
-        CURL* curl = curl_easy_init();
-        if (!curl) return std::nullopt;
-
-        std::string response;
-        curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
-        curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, writeToString);
-        curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response);
-        curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L); // handle redirects
-
-        CURLcode res = curl_easy_perform(curl);
-        curl_easy_cleanup(curl);
-
-        if (res != CURLE_OK) {
-            std::cerr << "[DataIngest] HTTP error: " << curl_easy_strerror(res) << "\n";
-            return std::nullopt;
-        }
-
-        return response;
-    }
+    /// One symbol of fromHttpUrls(): waiting, in flight, or scheduled for a retry.
+    struct HttpTransfer {
+        std::size_t index = 0;                                ///< Position in the request list.
+        int attempts = 0;
+        qga::domain::backtest::BarSeries series;
+        std::unique_ptr<qga::io::CsvBarParser> parser;
+        HttpParseContext ctx;
+        qga::ingest::CurlHandlePool::Lease lease;             ///< Held while in flight.
+        std::chrono::steady_clock::time_point ready_at{};     ///< Earliest (re)start time.
+    };
 }   // namespace
 
 namespace qga::ingest {
@@ -56,68 +47,74 @@ DataIngest::DataIngest(std::shared_ptr<utils::ILogger> logger)
     : logger_(std::move(logger)) {}
 
 std::optional<domain::backtest::BarSeries> DataIngest::fromCsv(const std::string& path) {
-    std::ifstream file(path);
-    if (!file.is_open()) {
+    domain::backtest::BarSeries series;
+    io::CsvParseStats stats;
+    if (!io::parseCsvFile(path, series, &stats)) {
         logger_->error("Failed to open file: {}", path);
         return std::nullopt;
     }
+    reportParseIssues(stats, path);
 
-    domain::backtest::BarSeries series;
-    std::string line;
-    bool is_header = true;
-    while (std::getline(file, line)) {
-        std::vector<std::string> fields;
-        std::stringstream ss(line);
-        std::string item;
-        if (is_header) {
-            // Skip header row
-            is_header = false;
-            logger_->debug("Skipping header row: {}", line);
-            continue;
-        }
-        while (std::getline(ss, item, ',')) {
-            fields.push_back(item);
-        }
+    if (series.empty()) {
+        logger_->error("No valid rows found in file: {}", path);
+        return std::nullopt;
+    }
 
-        if (!validateRow(fields)) continue;
-        auto quote = parseRow(fields);
-        if (quote) {
-            series.add(*quote);
-        }
+    return series;
+}
+
+std::optional<domain::backtest::BarSeries> DataIngest::fromCsvParallel(const std::string& path,
+                                                                      int threads) {
+    core::ThreadPool pool(threads > 0 ? threads : core::Config::getInstance().threads());
+
+    domain::backtest::BarSeries series;
+    io::CsvParseStats stats;
+    if (!io::parseCsvFileParallel(path, series, pool, &stats)) {
+        logger_->error("Failed to open file: {}", path);
+        return std::nullopt;
     }
+    reportParseIssues(stats, path);
 
     if (series.empty()) {
         logger_->error("No valid rows found in file: {}", path);
         return std::nullopt;
     }
 
+    logger_->debug("Parsed {} rows from {} on {} threads", series.size(), path, pool.size());
     return series;
 }
 
 std::optional<domain::backtest::BarSeries> DataIngest::fromHttpUrl(const std::string& url) {
-    auto content = fetchHttpContent(url);
-    if (!content.has_value()) {
-        logger_->error("Failed to fetch HTTP content from: {}", url);
+    domain::backtest::BarSeries series;
+    io::CsvBarParser parser(series);
+
+    CURLcode res = CURLE_OK;
+    HttpParseContext ctx;
+    try {
+        auto lease = CurlHandlePool::shared().acquire();
+        ctx.curl = lease.get();
+        ctx.parser = &parser;
+        curl_easy_setopt(ctx.curl, CURLOPT_URL, url.c_str());
+        curl_easy_setopt(ctx.curl, CURLOPT_WRITEFUNCTION, feedParser);
+        curl_easy_setopt(ctx.curl, CURLOPT_WRITEDATA, &ctx);
+        res = curl_easy_perform(ctx.curl);
+        if (ctx.status == 0) curl_easy_getinfo(ctx.curl, CURLINFO_RESPONSE_CODE, &ctx.status);
+    } catch (const std::exception& e) {
+        logger_->error("Failed to fetch HTTP content from {}: {}", url, e.what());
         return std::nullopt;
     }
 
-    domain::backtest::BarSeries series;
-    std::istringstream iss(*content);
-    std::string line;
-    while (std::getline(iss, line)) {
-        std::vector<std::string> fields;
-        std::stringstream ss(line);
-        std::string item;
-        while (std::getline(ss, item, ',')) {
-            fields.push_back(item);
-        }
-
-        if (!validateRow(fields)) continue;
-        auto quote = parseRow(fields);
-        if (quote) {
-            series.add(*quote);
-        }
+    if (ctx.status >= 400) {
+        logger_->error("Failed to fetch HTTP content from {}: HTTP {}", url, ctx.status);
+        return std::nullopt;
     }
+    if (res != CURLE_OK) {
+        logger_->error("Failed to fetch HTTP content from {}: {}", url, curl_easy_strerror(res));
+        return std::nullopt;
+    }
+
+    parser.finish();
+    reportParseIssues(parser.stats(), url);
 
     if (series.empty()) {
         logger_->error("No valid rows fetched from HTTP source.");
@@ -127,49 +124,214 @@ std::optional<domain::backtest::BarSeries> DataIngest::fromHttpUrl(const std::st
     return series;
 }
 
-// === PRIVATE ===
+std::size_t DataIngest::fromHttpUrls(const std::vector<HttpSymbolRequest>& requests,
+                                     const HttpSymbolCallback& on_result,
+                                     const HttpBatchParams& params) {
+    using Clock = std::chrono::steady_clock;
+    if (requests.empty()) return 0;
+
+    std::vector<std::unique_ptr<HttpTransfer>> transfers;
+    transfers.reserve(requests.size());
+    std::deque<HttpTransfer*> waiting;  // not yet started, or waiting for a retry
+    for (std::size_t i = 0; i < requests.size(); ++i) {
+        transfers.push_back(std::make_unique<HttpTransfer>());
+        transfers.back()->index = i;
+        waiting.push_back(transfers.back().get());
+    }
 
-bool DataIngest::validateRow(const std::vector<std::string>& fields) {
-    return fields.size() == 6;
-}
+    std::unique_ptr<CURLM, decltype(&curl_multi_cleanup)> multi(curl_multi_init(), &curl_multi_cleanup);
+    const std::size_t MAX_ACTIVE = std::max<std::size_t>(params.max_concurrent_, 1);
+    if (multi) {
+        // Connections live in the multi handle's cache and are reused by later symbols.
+        curl_multi_setopt(multi.get(), CURLMOPT_MAX_TOTAL_CONNECTIONS, static_cast<long>(MAX_ACTIVE));
+        curl_multi_setopt(multi.get(), CURLMOPT_MAX_HOST_CONNECTIONS, static_cast<long>(MAX_ACTIVE));
+        curl_multi_setopt(multi.get(), CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+    }
 
-std::optional<domain::Quote> DataIngest::parseRow(const std::vector<std::string>& fields) {
+    std::size_t active = 0;
+    std::size_t finished = 0;
+    std::size_t loaded = 0;
+
+    auto complete = [&](HttpTransfer& t, std::string error) {
+        const auto& req = requests[t.index];
+        HttpSymbolResult result;
+        result.symbol_ = req.symbol_;
+        result.attempts_ = t.attempts;
+
+        if (error.empty()) {
+            reportParseIssues(t.parser->stats(), req.url_);
+            if (t.series.empty()) error = "no valid rows";
+        }
+        if (error.empty()) {
+            result.series_ = std::move(t.series);
+            ++loaded;
+        } else {
+            logger_->error("Failed to fetch {} from {}: {}", req.symbol_, req.url_, error);
+            result.error_ = std::move(error);
+        }
+        t.parser.reset();
+        ++finished;
+        on_result(std::move(result));
+    };
+
+    auto start = [&](HttpTransfer& t) {
+        t.series.clear();
+        t.parser = std::make_unique<io::CsvBarParser>(t.series);
+        t.lease = CurlHandlePool::shared().acquire();
+        t.ctx = HttpParseContext{t.lease.get(), t.parser.get(), 0};
+
+        CURL* h = t.lease.get();
+        curl_easy_setopt(h, CURLOPT_URL, requests[t.index].url_.c_str());
+        curl_easy_setopt(h, CURLOPT_WRITEFUNCTION, feedParser);
+        curl_easy_setopt(h, CURLOPT_WRITEDATA, &t.ctx);
+        curl_easy_setopt(h, CURLOPT_PRIVATE, &t);
+        curl_easy_setopt(h, CURLOPT_TIMEOUT_MS, static_cast<long>(params.timeout_.count()));
+        curl_easy_setopt(h, CURLOPT_PIPEWAIT, 1L);  // prefer multiplexing over a new connection
+        if (curl_multi_add_handle(multi.get(), h) != CURLM_OK) {
+            throw std::runtime_error("curl_multi_add_handle failed");
+        }
+        ++t.attempts;
+        ++active;
+    };
+
+    auto onDone = [&](CURL* h, CURLcode res) {
+        HttpTransfer* t = nullptr;
+        curl_easy_getinfo(h, CURLINFO_PRIVATE, reinterpret_cast<char**>(&t));
+        curl_multi_remove_handle(multi.get(), h);
+        --active;
+
+        if (t->ctx.status == 0) curl_easy_getinfo(h, CURLINFO_RESPONSE_CODE, &t->ctx.status);
+        t->lease = {};  // back to the pool; the connection stays in the multi cache
+
+        std::string error;
+        bool retryable = false;
+        if (t->ctx.status >= 400) {
+            error = "HTTP " + std::to_string(t->ctx.status);
+            retryable = t->ctx.status == 429 || t->ctx.status >= 500;
+        } else if (res != CURLE_OK) {
+            error = curl_easy_strerror(res);
+            retryable = true;
+        } else {
+            t->parser->finish();
+        }
+
+        if (!error.empty() && retryable && t->attempts <= params.max_retries_) {
+            const auto DELAY = params.initial_backoff_ * (1LL << std::min(t->attempts - 1, 16));
+            logger_->warn("Retrying {} in {} ms after {} (attempt {})",
+                          requests[t->index].symbol_, DELAY.count(), error, t->attempts);
+            t->ready_at = Clock::now() + DELAY;
+            waiting.push_back(t);
+        } else {
+            complete(*t, std::move(error));
+        }
+    };
+
+    if (!multi) {
+        for (auto& t : transfers) complete(*t, "curl_multi_init failed");
+        return 0;
+    }
 
     try {
-        domain::Quote quote;
-        // --- Parse timestamp (ISO 8601 or epoch)
-        if (fields[0].find('T') != std::string::npos) {
-
-            // ISO 8601 format
-            std::istringstream ss(fields[0]);
-            std::tm tm = {};
-            ss >> std::get_time(&tm, "%Y-%m-%dT%H:%M:%S");
-            if (ss.fail()) {
-                logger_->error("Invalid ISO timestamp: {}", fields[0]);
-                throw std::runtime_error("Invalid ISO timestamp");
+        while (finished < requests.size()) {
+            const auto NOW = Clock::now();
+            for (auto it = waiting.begin(); it != waiting.end() && active < MAX_ACTIVE;) {
+                HttpTransfer* t = *it;
+                if (t->ready_at > NOW) {
+                    ++it;
+                    continue;
+                }
+                it = waiting.erase(it);
+                try {
+                    start(*t);
+                } catch (const std::exception& e) {
+                    t->lease = {};
+                    complete(*t, e.what());
+                }
             }
-            auto time_point = std::chrono::system_clock::from_time_t(std::mktime(&tm));
 
-            quote.ts_ = std::chrono::duration_cast<std::chrono::milliseconds>(time_point.time_since_epoch()).count();
-        } else {
-            // Epoch milliseconds
-            quote.ts_ = std::stoll(fields[0]); // fallback: epoch millis
+            int running = 0;
+            curl_multi_perform(multi.get(), &running);
+
+            int queued = 0;
+            while (CURLMsg* msg = curl_multi_info_read(multi.get(), &queued)) {
+                if (msg->msg == CURLMSG_DONE) onDone(msg->easy_handle, msg->data.result);
+            }
+            if (finished == requests.size()) break;
+
+            // Sleep until socket activity, or until the next retry is due when idle.
+            int wait_ms = 100;
+            if (active == 0 && !waiting.empty()) {
+                auto next = waiting.front()->ready_at;
+                for (const auto* t : waiting) next = std::min(next, t->ready_at);
+                const auto DUE = std::chrono::duration_cast<std::chrono::milliseconds>(next - Clock::now());
+                wait_ms = static_cast<int>(std::clamp<std::int64_t>(DUE.count(), 0, 100));
+            }
+            if (wait_ms > 0) curl_multi_poll(multi.get(), nullptr, 0, wait_ms, nullptr);
         }
+    } catch (...) {
+        // e.g. thrown by on_result: detach in-flight handles before they go back to the pool
+        for (auto& t : transfers) {
+            if (t->lease.get()) curl_multi_remove_handle(multi.get(), t->lease.get());
+        }
+        throw;
+    }
 
-        // --- Parse OHLCV ---
-        quote.open_ = std::stod(fields[1]);
-        quote.high_ = std::stod(fields[2]);
-        quote.low_ = std::stod(fields[3]);
-        quote.close_ = std::stod(fields[4]);
-        quote.volume_ = std::stod(fields[5]);
+    logger_->debug("Fetched {}/{} symbols over HTTP", loaded, requests.size());
+    return loaded;
+}
 
-        return quote;
+std::optional<domain::backtest::BarSeries> DataIngest::fromBinaryFile(const std::string& path,
+                                                                     bool verify_checksum) {
+    try {
+        auto contents = io::mapBarFile(path, verify_checksum);
+        if (contents.series_.empty()) {
+            logger_->error("No bars found in binary file: {}", path);
+            return std::nullopt;
+        }
+        logger_->debug("Mapped {} bars for {} from {}", contents.series_.size(), contents.symbol_, path);
+        return std::move(contents.series_);
     } catch (const std::exception& e) {
-        if (logger_) logger_->error("parseRow failed: {}", e.what());
+        logger_->error("Failed to map binary file {}: {}", path, e.what());
+        return std::nullopt;
+    }
+}
+
+// === PRIVATE ===
+
+bool DataIngest::validateRow(const std::vector<std::string>& fields) {
+    return fields.size() == 6;
+}
+
+std::optional<domain::Quote> DataIngest::parseRow(const std::vector<std::string>& fields) {
+    if (!validateRow(fields)) {
+        if (logger_) logger_->error("parseRow failed: expected 6 fields, got {}", fields.size());
         return std::nullopt;
     }
 
+    domain::Quote quote;
+    if (!io::CsvBarParser::parseTimestamp(fields[0], quote.ts_)) {
+        if (logger_) logger_->error("Invalid timestamp: {}", fields[0]);
+        return std::nullopt;
+    }
+    if (!io::CsvBarParser::parseNumber(fields[1], quote.open_) ||
+        !io::CsvBarParser::parseNumber(fields[2], quote.high_) ||
+        !io::CsvBarParser::parseNumber(fields[3], quote.low_) ||
+        !io::CsvBarParser::parseNumber(fields[4], quote.close_) ||
+        !io::CsvBarParser::parseNumber(fields[5], quote.volume_)) {
+        if (logger_) logger_->error("parseRow failed: invalid OHLCV value");
+        return std::nullopt;
+    }
+    return quote;
+}
 
+void DataIngest::reportParseIssues(const io::CsvParseStats& stats, const std::string& source) {
+    if (stats.header_skipped_) logger_->debug("Skipped header row in {}", source);
+    for (const auto& issue : stats.issues_) {
+        logger_->error("Rejected row {} in {}: {}", issue.line_, source, io::toString(issue.error_));
+    }
+    if (stats.rows_bad_ > stats.issues_.size()) {
+        logger_->warn("{} more rows rejected in {}", stats.rows_bad_ - stats.issues_.size(), source);
+    }
 }
 
 } // namespace qga::ingest
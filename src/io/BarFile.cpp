@@ -0,0 +1,231 @@
+#include "io/BarFile.hpp"
+#include "io/MappedFile.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdio>
+#include <filesystem>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <span>
+#include <stdexcept>
+
+namespace qga::io {
+
+    namespace {
+
+        constexpr std::size_t COLUMN_COUNT = 6;
+        constexpr std::size_t COLUMN_ALIGN = 64;
+
+        constexpr std::uint64_t columnStride(std::uint64_t bar_count) noexcept {
+            const std::uint64_t BYTES = bar_count * sizeof(double);
+            return (BYTES + COLUMN_ALIGN - 1) / COLUMN_ALIGN * COLUMN_ALIGN;
+        }
+
+        void requireLittleEndian() {
+            if constexpr (std::endian::native != std::endian::little) {
+                throw std::runtime_error("Bar files are only supported on little-endian hosts");
+            }
+        }
+
+        /**
+         * Word-at-a-time multiply/rotate hash over the column bytes.
+         * Inputs are always multiples of 8 bytes (columns are padded to 64).
+         */
+        class ColumnHasher {
+        public:
+            void update(const std::byte* p, std::size_t n) noexcept {
+                for (std::size_t i = 0; i + 8 <= n; i += 8) {
+                    std::uint64_t w;
+                    std::memcpy(&w, p + i, sizeof(w));
+                    h_ = std::rotl(h_ ^ w, 29) * PRIME;
+                }
+            }
+            std::uint64_t digest() const noexcept { return h_ ^ (h_ >> 32); }
+
+        private:
+            static constexpr std::uint64_t PRIME = 0x9E3779B97F4A7C15ULL;
+            std::uint64_t h_ = 0xCBF29CE484222325ULL;
+        };
+
+        template <typename T>
+        void writeColumn(std::ofstream& out, ColumnHasher& hasher, std::span<const T> col,
+                         std::uint64_t stride) {
+            static const std::array<std::byte, COLUMN_ALIGN> ZEROS{};
+            const auto* bytes = reinterpret_cast<const std::byte*>(col.data());
+            const std::size_t LEN = col.size_bytes();
+            out.write(reinterpret_cast<const char*>(bytes), static_cast<std::streamsize>(LEN));
+            hasher.update(bytes, LEN);
+
+            const std::size_t PAD = static_cast<std::size_t>(stride) - LEN;
+            out.write(reinterpret_cast<const char*>(ZEROS.data()), static_cast<std::streamsize>(PAD));
+            hasher.update(ZEROS.data(), PAD);
+        }
+
+        void validateHeader(const BarFileHeader& h, std::uint64_t file_size, const std::string& path) {
+            if (std::memcmp(h.magic_, BAR_FILE_MAGIC, sizeof(h.magic_)) != 0) {
+                throw std::runtime_error("bar file: not a bar file: " + path);
+            }
+            if (h.version_ != BAR_FILE_VERSION) {
+                throw std::runtime_error("bar file: unsupported version " + std::to_string(h.version_) +
+                                         " in " + path);
+            }
+            if (h.header_size_ != sizeof(BarFileHeader)) {
+                throw std::runtime_error("bar file: corrupt header in " + path);
+            }
+            // Bound bar_count_ by the file size first, so columnStride() cannot overflow;
+            // the remaining checks divide instead of multiplying for the same reason.
+            const std::uint64_t PAYLOAD = file_size > h.header_size_ ? file_size - h.header_size_ : 0;
+            if (h.bar_count_ > PAYLOAD / (COLUMN_COUNT * sizeof(double))) {
+                throw std::runtime_error("bar file: truncated file " + path);
+            }
+            if (h.column_stride_ != columnStride(h.bar_count_)) {
+                throw std::runtime_error("bar file: corrupt header in " + path);
+            }
+            if (h.column_stride_ > PAYLOAD / COLUMN_COUNT) {
+                throw std::runtime_error("bar file: truncated file " + path);
+            }
+        }
+
+        std::string symbolOf(const BarFileHeader& h) {
+            return std::string(h.symbol_, std::find(h.symbol_, h.symbol_ + sizeof(h.symbol_), '\0'));
+        }
+
+        bool seekTo(std::FILE* f, std::uint64_t offset) noexcept {
+#ifdef _WIN32
+            return _fseeki64(f, static_cast<__int64>(offset), SEEK_SET) == 0;
+#else
+            return fseeko(f, static_cast<off_t>(offset), SEEK_SET) == 0;
+#endif
+        }
+
+        template <typename T>
+        std::span<const T> columnAt(const MappedFile& file, std::size_t index, const BarFileHeader& h) {
+            const auto* base = file.data() + h.header_size_ + index * h.column_stride_;
+            return {reinterpret_cast<const T*>(base), static_cast<std::size_t>(h.bar_count_)};
+        }
+
+    } // namespace
+
+    void writeBarFile(const std::string& path, const std::string& symbol,
+                      const domain::backtest::BarSeries& series) {
+        requireLittleEndian();
+
+        BarFileHeader header{};
+        if (symbol.size() >= sizeof(header.symbol_)) {
+            throw std::invalid_argument("writeBarFile: symbol longer than 23 characters: " + symbol);
+        }
+        std::memcpy(header.magic_, BAR_FILE_MAGIC, sizeof(header.magic_));
+        std::memcpy(header.symbol_, symbol.data(), symbol.size());
+        header.version_       = BAR_FILE_VERSION;
+        header.header_size_   = sizeof(BarFileHeader);
+        header.bar_count_     = series.size();
+        header.column_stride_ = columnStride(series.size());
+
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out) throw std::runtime_error("writeBarFile: cannot open " + path);
+
+        // Header is rewritten once the checksum is known.
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+        ColumnHasher hasher;
+        const auto STRIDE = header.column_stride_;
+        writeColumn(out, hasher, series.timestamps(), STRIDE);
+        writeColumn(out, hasher, series.opens(), STRIDE);
+        writeColumn(out, hasher, series.highs(), STRIDE);
+        writeColumn(out, hasher, series.lows(), STRIDE);
+        writeColumn(out, hasher, series.closes(), STRIDE);
+        writeColumn(out, hasher, series.volumes(), STRIDE);
+
+        header.checksum_ = hasher.digest();
+        out.seekp(0);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+        out.flush();
+        if (!out) throw std::runtime_error("writeBarFile: write failed for " + path);
+    }
+
+    BarFileContents mapBarFile(const std::string& path, bool verify_checksum) {
+        requireLittleEndian();
+
+        auto file = std::make_shared<MappedFile>(path);
+        if (file->size() < sizeof(BarFileHeader)) {
+            throw std::runtime_error("mapBarFile: file too small: " + path);
+        }
+
+        BarFileHeader h{};
+        std::memcpy(&h, file->data(), sizeof(h));
+        validateHeader(h, file->size(), path);
+
+        const std::uint64_t PAYLOAD = COLUMN_COUNT * h.column_stride_;
+        if (verify_checksum) {
+            ColumnHasher hasher;
+            hasher.update(file->data() + h.header_size_, static_cast<std::size_t>(PAYLOAD));
+            if (hasher.digest() != h.checksum_) {
+                throw std::runtime_error("mapBarFile: checksum mismatch in " + path);
+            }
+        }
+
+        domain::BarColumns cols;
+        cols.ts_     = columnAt<std::int64_t>(*file, 0, h);
+        cols.open_   = columnAt<double>(*file, 1, h);
+        cols.high_   = columnAt<double>(*file, 2, h);
+        cols.low_    = columnAt<double>(*file, 3, h);
+        cols.close_  = columnAt<double>(*file, 4, h);
+        cols.volume_ = columnAt<double>(*file, 5, h);
+
+        BarFileContents out;
+        out.symbol_ = symbolOf(h);
+        out.series_ = domain::backtest::BarSeries::view(cols, std::move(file));
+        return out;
+    }
+
+    // === BarFileReader ===
+
+    BarFileReader::BarFileReader(const std::string& path)
+        : file_(std::fopen(path.c_str(), "rb"), &std::fclose), path_(path) {
+        requireLittleEndian();
+        if (!file_) throw std::runtime_error("BarFileReader: cannot open " + path);
+
+        if (std::fread(&header_, sizeof(header_), 1, file_.get()) != 1) {
+            throw std::runtime_error("BarFileReader: file too small: " + path);
+        }
+        std::error_code ec;
+        const auto SIZE = std::filesystem::file_size(path, ec);
+        if (ec) throw std::runtime_error("BarFileReader: cannot stat " + path);
+        validateHeader(header_, SIZE, path);
+        symbol_ = symbolOf(header_);
+    }
+
+    std::size_t BarFileReader::read(domain::backtest::BarSeries& out, std::size_t max_bars) {
+        const std::size_t N = std::min(max_bars, remaining());
+        if (N == 0) return 0;
+
+        ts_buf_.resize(N);
+        for (auto& col : col_buf_) col.resize(N);
+
+        auto readColumn = [&](std::size_t index, void* dst, std::size_t elem_size) {
+            const std::uint64_t OFFSET = header_.header_size_ + index * header_.column_stride_ + pos_ * elem_size;
+            if (!seekTo(file_.get(), OFFSET) || std::fread(dst, elem_size, N, file_.get()) != N) {
+                throw std::runtime_error("BarFileReader: read failed in " + path_);
+            }
+        };
+        readColumn(0, ts_buf_.data(), sizeof(std::int64_t));
+        for (std::size_t c = 0; c < col_buf_.size(); ++c) readColumn(c + 1, col_buf_[c].data(), sizeof(double));
+
+        domain::BarColumns cols;
+        cols.ts_     = ts_buf_;
+        cols.open_   = col_buf_[0];
+        cols.high_   = col_buf_[1];
+        cols.low_    = col_buf_[2];
+        cols.close_  = col_buf_[3];
+        cols.volume_ = col_buf_[4];
+        out.append(cols);
+
+        pos_ += N;
+        return N;
+    }
+
+} // namespace qga::io
@@ -0,0 +1,363 @@
+#include "io/CsvBarParser.hpp"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include "core/ThreadPool.hpp"
+#include "io/MappedFile.hpp"
+
+namespace qga::io {
+
+    namespace {
+
+        constexpr std::size_t FIELD_COUNT = 6;
+        constexpr std::size_t READ_BLOCK_SIZE = 1 << 20;  // 1 MiB
+        constexpr std::size_t MIN_CHUNK_SIZE = 1 << 20;   // below this, threads cost more than they save
+        constexpr std::size_t CHUNKS_PER_THREAD = 4;      // smooths out uneven chunk costs
+
+        std::string_view trim(std::string_view s) noexcept {
+            while (!s.empty() && (s.front() == ' ' || s.front() == '\t')) s.remove_prefix(1);
+            while (!s.empty() && (s.back() == ' ' || s.back() == '\t' || s.back() == '\r')) s.remove_suffix(1);
+            return s;
+        }
+
+        bool isDigit(char c) noexcept { return c >= '0' && c <= '9'; }
+
+        /// Parses exactly N digits at @p p into @p out.
+        template <std::size_t N>
+        bool fixedDigits(const char* p, int& out) noexcept {
+            int v = 0;
+            for (std::size_t i = 0; i < N; ++i) {
+                if (!isDigit(p[i])) return false;
+                v = v * 10 + (p[i] - '0');
+            }
+            out = v;
+            return true;
+        }
+
+        /// Days since 1970-01-01 for a proleptic Gregorian date (H. Hinnant's algorithm).
+        constexpr std::int64_t daysFromCivil(int y, int m, int d) noexcept {
+            y -= m <= 2;
+            const int ERA = (y >= 0 ? y : y - 399) / 400;
+            const int YOE = y - ERA * 400;
+            const int DOY = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+            const int DOE = YOE * 365 + YOE / 4 - YOE / 100 + DOY;
+            return static_cast<std::int64_t>(ERA) * 146097 + DOE - 719468;
+        }
+
+        /// Fixed-format `YYYY-MM-DDTHH:MM:SS[.fff...][Z]`, interpreted as UTC.
+        bool parseIso8601(std::string_view s, std::int64_t& epoch_ms) noexcept {
+            if (s.size() < 19) return false;
+            const char* p = s.data();
+            int y, mo, d, h, mi, sec;
+            if (!fixedDigits<4>(p, y) || p[4] != '-' || !fixedDigits<2>(p + 5, mo) || p[7] != '-' ||
+                !fixedDigits<2>(p + 8, d) || (p[10] != 'T' && p[10] != ' ') ||
+                !fixedDigits<2>(p + 11, h) || p[13] != ':' || !fixedDigits<2>(p + 14, mi) ||
+                p[16] != ':' || !fixedDigits<2>(p + 17, sec)) {
+                return false;
+            }
+            if (mo < 1 || mo > 12 || d < 1 || d > 31 || h > 23 || mi > 59 || sec > 60) return false;
+
+            std::size_t i = 19;
+            int millis = 0;
+            if (i < s.size() && s[i] == '.') {
+                ++i;
+                int scale = 100;
+                const std::size_t START = i;
+                for (; i < s.size() && isDigit(s[i]); ++i) {
+                    millis += (s[i] - '0') * scale;
+                    scale /= 10;
+                }
+                if (i == START) return false;
+            }
+            if (i < s.size() && s[i] == 'Z') ++i;
+            if (i != s.size()) return false;
+
+            const std::int64_t DAYS = daysFromCivil(y, mo, d);
+            epoch_ms = ((DAYS * 24 + h) * 60 + mi) * 60'000LL + sec * 1000LL + millis;
+            return true;
+        }
+
+        bool looksLikeHeader(std::string_view line) noexcept {
+            const char C = line.front();
+            return !isDigit(C) && C != '-' && C != '+';
+        }
+
+        std::size_t countLines(std::string_view text) noexcept {
+            std::size_t n = static_cast<std::size_t>(std::count(text.begin(), text.end(), '\n'));
+            if (!text.empty() && text.back() != '\n') ++n;  // unterminated last line
+            return n;
+        }
+
+        /// A newline-aligned slice of the input and the index range reserved for its rows.
+        struct Chunk {
+            std::string_view text_;
+            std::size_t first_line_ = 0;   ///< 1-based line number of the first line.
+            std::size_t first_row_ = 0;    ///< First reserved index in the output series.
+            std::size_t capacity_ = 0;     ///< Lines in the chunk (upper bound on rows).
+            std::size_t rows_ok_ = 0;
+            std::size_t rows_bad_ = 0;
+            std::vector<CsvRowIssue> issues_;
+        };
+
+        void parseChunkInto(Chunk& c, domain::backtest::BarSeries& out) {
+            const char* p = c.text_.data();
+            const char* end = p + c.text_.size();
+            std::size_t line_no = c.first_line_;
+            while (p < end) {
+                const auto* nl = static_cast<const char*>(std::memchr(p, '\n', static_cast<std::size_t>(end - p)));
+                const char* eol = nl ? nl : end;
+                const auto LINE = trim(std::string_view(p, static_cast<std::size_t>(eol - p)));
+                p = nl ? nl + 1 : end;
+
+                if (!LINE.empty()) {
+                    domain::Quote q;
+                    const auto ERR = CsvBarParser::parseLine(LINE, q);
+                    if (ERR == CsvRowError::None) {
+                        out.set(c.first_row_ + c.rows_ok_++, q);
+                    } else {
+                        ++c.rows_bad_;
+                        if (c.issues_.size() < CsvBarParser::MAX_RECORDED_ISSUES) {
+                            c.issues_.push_back({line_no, ERR});
+                        }
+                    }
+                }
+                ++line_no;
+            }
+        }
+
+    } // namespace
+
+    const char* toString(CsvRowError err) noexcept {
+        switch (err) {
+            case CsvRowError::None:         return "ok";
+            case CsvRowError::FieldCount:   return "wrong field count";
+            case CsvRowError::BadTimestamp: return "invalid timestamp";
+            case CsvRowError::BadNumber:    return "invalid number";
+        }
+        return "unknown";
+    }
+
+    // === STATIC FIELD PARSERS ===
+
+    bool CsvBarParser::parseNumber(std::string_view field, double& value) noexcept {
+        field = trim(field);
+        if (field.empty()) return false;
+        const char* first = field.data();
+        const char* last = first + field.size();
+        if (*first == '+') ++first;  // from_chars rejects an explicit plus sign
+        const auto [ptr, ec] = std::from_chars(first, last, value);
+        return ec == std::errc{} && ptr == last;
+    }
+
+    bool CsvBarParser::parseTimestamp(std::string_view field, std::int64_t& epoch_ms) noexcept {
+        field = trim(field);
+        if (field.empty()) return false;
+        if (field.size() >= 19 && field[4] == '-') return parseIso8601(field, epoch_ms);
+
+        const char* last = field.data() + field.size();
+        const auto [ptr, ec] = std::from_chars(field.data(), last, epoch_ms);
+        return ec == std::errc{} && ptr == last;
+    }
+
+    CsvRowError CsvBarParser::parseLine(std::string_view line, domain::Quote& q) noexcept {
+        std::array<std::string_view, FIELD_COUNT> f;
+        std::size_t n = 0;
+        while (true) {
+            const auto COMMA = line.find(',');
+            if (n == FIELD_COUNT) return CsvRowError::FieldCount;
+            if (COMMA == std::string_view::npos) {
+                f[n++] = line;
+                break;
+            }
+            f[n++] = line.substr(0, COMMA);
+            line.remove_prefix(COMMA + 1);
+        }
+        if (n != FIELD_COUNT) return CsvRowError::FieldCount;
+
+        if (!parseTimestamp(f[0], q.ts_)) return CsvRowError::BadTimestamp;
+        if (!parseNumber(f[1], q.open_) || !parseNumber(f[2], q.high_) ||
+            !parseNumber(f[3], q.low_) || !parseNumber(f[4], q.close_) ||
+            !parseNumber(f[5], q.volume_)) {
+            return CsvRowError::BadNumber;
+        }
+        return CsvRowError::None;
+    }
+
+    // === STREAMING ===
+
+    CsvBarParser::CsvBarParser(domain::backtest::BarSeries& out) : out_(&out) {}
+
+    void CsvBarParser::processLine(std::string_view line) {
+        ++line_no_;
+        line = trim(line);
+        if (line.empty()) return;
+
+        if (first_line_) {
+            first_line_ = false;
+            if (looksLikeHeader(line)) {
+                stats_.header_skipped_ = true;
+                return;
+            }
+        }
+
+        domain::Quote q;
+        const auto ERR = parseLine(line, q);
+        if (ERR == CsvRowError::None) {
+            out_->add(q);
+            ++stats_.rows_ok_;
+            return;
+        }
+
+        ++stats_.rows_bad_;
+        if (stats_.issues_.size() < MAX_RECORDED_ISSUES) {
+            stats_.issues_.push_back({line_no_, ERR});
+        }
+    }
+
+    void CsvBarParser::feed(std::string_view chunk) {
+        if (!carry_.empty()) {
+            const auto NL = chunk.find('\n');
+            if (NL == std::string_view::npos) {
+                carry_.append(chunk);
+                return;
+            }
+            carry_.append(chunk.substr(0, NL));
+            processLine(carry_);
+            carry_.clear();
+            chunk.remove_prefix(NL + 1);
+        }
+
+        const char* p = chunk.data();
+        const char* end = p + chunk.size();
+        while (p < end) {
+            const auto* nl = static_cast<const char*>(std::memchr(p, '\n', static_cast<std::size_t>(end - p)));
+            if (!nl) {
+                carry_.assign(p, end);
+                return;
+            }
+            processLine(std::string_view(p, static_cast<std::size_t>(nl - p)));
+            p = nl + 1;
+        }
+    }
+
+    void CsvBarParser::finish() {
+        if (!carry_.empty()) {
+            processLine(carry_);
+            carry_.clear();
+        }
+    }
+
+    // === FILE ===
+
+    bool parseCsvFile(const std::string& path, domain::backtest::BarSeries& out, CsvParseStats* stats) {
+        std::unique_ptr<std::FILE, int (*)(std::FILE*)> file(std::fopen(path.c_str(), "rb"), &std::fclose);
+        if (!file) return false;
+
+        CsvBarParser parser(out);
+        auto buffer = std::make_unique<char[]>(READ_BLOCK_SIZE);
+        std::size_t n = 0;
+        while ((n = std::fread(buffer.get(), 1, READ_BLOCK_SIZE, file.get())) > 0) {
+            parser.feed(std::string_view(buffer.get(), n));
+        }
+        const bool OK = std::ferror(file.get()) == 0;
+        parser.finish();
+
+        if (stats) *stats = parser.stats();
+        return OK;
+    }
+
+    bool parseCsvFileParallel(const std::string& path, domain::backtest::BarSeries& out,
+                              core::ThreadPool& pool, CsvParseStats* stats) {
+        std::shared_ptr<MappedFile> file;
+        try {
+            file = std::make_shared<MappedFile>(path);
+        } catch (const std::runtime_error&) {
+            return false;
+        }
+        file->adviseSequential();
+
+        std::string_view text(reinterpret_cast<const char*>(file->data()), file->size());
+        CsvParseStats result;
+
+        // Header detection mirrors CsvBarParser: first non-empty line only.
+        std::size_t line_no = 1;
+        while (!text.empty()) {
+            const auto NL = text.find('\n');
+            const auto LINE = trim(text.substr(0, NL));
+            if (!LINE.empty()) {
+                if (looksLikeHeader(LINE)) {
+                    result.header_skipped_ = true;
+                    text.remove_prefix(NL == std::string_view::npos ? text.size() : NL + 1);
+                    ++line_no;
+                }
+                break;
+            }
+            text.remove_prefix(NL == std::string_view::npos ? text.size() : NL + 1);
+            ++line_no;
+        }
+
+        // Split at newline boundaries.
+        const std::size_t WANTED = std::max<std::size_t>(1, pool.size() * CHUNKS_PER_THREAD);
+        const std::size_t TARGET = std::max(MIN_CHUNK_SIZE, text.size() / WANTED + 1);
+        std::vector<Chunk> chunks;
+        for (std::size_t pos = 0; pos < text.size();) {
+            std::size_t stop = std::min(text.size(), pos + TARGET);
+            if (stop < text.size()) {
+                const auto NL = text.find('\n', stop - 1);
+                stop = NL == std::string_view::npos ? text.size() : NL + 1;
+            }
+            chunks.emplace_back().text_ = text.substr(pos, stop - pos);
+            pos = stop;
+        }
+
+        auto runAll = [&](auto&& fn) {
+            std::vector<std::future<void>> pending;
+            pending.reserve(chunks.size());
+            for (auto& c : chunks) pending.push_back(pool.submit([&fn, &c] { fn(c); }));
+            for (auto& f : pending) f.get();
+        };
+
+        // Pass 1: line counts give each chunk its line numbers and output range.
+        runAll([](Chunk& c) { c.capacity_ = countLines(c.text_); });
+
+        const std::size_t BASE = out.size();
+        std::size_t total = 0;
+        for (auto& c : chunks) {
+            c.first_line_ = line_no;
+            c.first_row_ = BASE + total;
+            line_no += c.capacity_;
+            total += c.capacity_;
+        }
+        out.resize(BASE + total);
+
+        // Pass 2: parse every chunk directly into its slice of the columns.
+        runAll([&out](Chunk& c) { parseChunkInto(c, out); });
+
+        // Close gaps left by blank or rejected lines, keeping file order.
+        std::size_t dst = BASE;
+        for (auto& c : chunks) {
+            if (dst != c.first_row_) {
+                for (std::size_t i = 0; i < c.rows_ok_; ++i) out.set(dst + i, out[c.first_row_ + i]);
+            }
+            dst += c.rows_ok_;
+
+            result.rows_ok_ += c.rows_ok_;
+            result.rows_bad_ += c.rows_bad_;
+            for (const auto& issue : c.issues_) {
+                if (result.issues_.size() == CsvBarParser::MAX_RECORDED_ISSUES) break;
+                result.issues_.push_back(issue);
+            }
+        }
+        out.resize(dst);
+
+        if (stats) *stats = std::move(result);
+        return true;
+    }
+
+} // namespace qga::io
@@ -83,7 +83,8 @@ namespace qga::io {
 
     void DataExporter::writeCSV(std::ofstream& out,
         const qga::domain::backtest::BarSeries& series) {
-        for (const auto& bar : series.data()) {
+        for (std::size_t i = 0; i < series.size(); ++i) {
+            const auto bar = series[i];
             out << bar.ts_ << ","
                 << bar.open_ << ","
                 << bar.high_ << ","
@@ -96,7 +97,8 @@ namespace qga::io {
     void DataExporter::writeJSON(std::ofstream& out,
         const qga::domain::backtest::BarSeries& series) {
         json j = json::array();
-        for (const auto& bar : series.data()) {
+        for (std::size_t i = 0; i < series.size(); ++i) {
+            const auto bar = series[i];
             j.push_back({
                 {"timestamp", bar.ts_},
                 {"open", bar.open_},
@@ -0,0 +1,125 @@
+#include "io/MappedFile.hpp"
+
+#include <stdexcept>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace qga::io {
+
+#ifdef _WIN32
+
+    MappedFile::MappedFile(const std::string& path) {
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            throw std::runtime_error("MappedFile: cannot open " + path);
+        }
+
+        LARGE_INTEGER len{};
+        if (!GetFileSizeEx(file, &len)) {
+            CloseHandle(file);
+            throw std::runtime_error("MappedFile: cannot stat " + path);
+        }
+        size_ = static_cast<std::size_t>(len.QuadPart);
+
+        if (size_ > 0) {
+            mapping_ = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping_) {
+                data_ = static_cast<const std::byte*>(
+                    MapViewOfFile(static_cast<HANDLE>(mapping_), FILE_MAP_READ, 0, 0, 0));
+            }
+        }
+        CloseHandle(file);  // the mapping keeps its own reference
+
+        if (size_ > 0 && !data_) {
+            unmap();
+            throw std::runtime_error("MappedFile: cannot map " + path);
+        }
+    }
+
+    void MappedFile::unmap() noexcept {
+        if (data_) UnmapViewOfFile(data_);
+        if (mapping_) CloseHandle(static_cast<HANDLE>(mapping_));
+        data_ = nullptr;
+        mapping_ = nullptr;
+        size_ = 0;
+    }
+
+    void MappedFile::adviseSequential() const noexcept {}
+
+#else
+
+    MappedFile::MappedFile(const std::string& path) {
+        const int FD = ::open(path.c_str(), O_RDONLY);
+        if (FD < 0) {
+            throw std::runtime_error("MappedFile: cannot open " + path);
+        }
+
+        struct stat st{};
+        if (::fstat(FD, &st) != 0) {
+            ::close(FD);
+            throw std::runtime_error("MappedFile: cannot stat " + path);
+        }
+        size_ = static_cast<std::size_t>(st.st_size);
+
+        if (size_ > 0) {
+            void* p = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, FD, 0);
+            if (p == MAP_FAILED) {
+                ::close(FD);
+                size_ = 0;
+                throw std::runtime_error("MappedFile: cannot map " + path);
+            }
+            data_ = static_cast<const std::byte*>(p);
+        }
+        ::close(FD);  // the mapping keeps its own reference
+    }
+
+    void MappedFile::unmap() noexcept {
+        if (data_) ::munmap(const_cast<std::byte*>(data_), size_);
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+    void MappedFile::adviseSequential() const noexcept {
+        if (data_) ::madvise(const_cast<std::byte*>(data_), size_, MADV_SEQUENTIAL);
+    }
+
+#endif
+
+    MappedFile::~MappedFile() { unmap(); }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept
+        : data_(std::exchange(other.data_, nullptr)),
+          size_(std::exchange(other.size_, 0))
+#ifdef _WIN32
+          , mapping_(std::exchange(other.mapping_, nullptr))
+#endif
+    {}
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            unmap();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+#ifdef _WIN32
+            mapping_ = std::exchange(other.mapping_, nullptr);
+#endif
+        }
+        return *this;
+    }
+
+} // namespace qga::io
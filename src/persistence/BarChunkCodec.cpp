@@ -0,0 +1,402 @@
+#include "persistence/BarChunkCodec.hpp"
+#include <array>
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <stdexcept>
+
+namespace qga::persistence {
+
+    namespace {
+
+        constexpr std::uint8_t VERSION = 1;
+        constexpr std::size_t STREAMS = 6;  // ts, open, high, low, close, volume
+
+        /// MSB-first bit stream appended to a byte vector.
+        class BitWriter {
+        public:
+            explicit BitWriter(std::vector<std::uint8_t>& out) : out_(out) {}
+
+            /// Writes the low @p bits bits of @p value (1..64).
+            void write(std::uint64_t value, int bits) {
+                if (bits > 32) {
+                    write(value >> 32, bits - 32);
+                    bits = 32;
+                }
+                acc_ = (acc_ << bits) | (value & ((1ULL << bits) - 1));
+                pending_ += bits;
+                while (pending_ >= 8) {
+                    pending_ -= 8;
+                    out_.push_back(static_cast<std::uint8_t>(acc_ >> pending_));
+                }
+            }
+
+            /// Pads the last byte with zero bits.
+            void flush() {
+                if (pending_ > 0) {
+                    out_.push_back(static_cast<std::uint8_t>(acc_ << (8 - pending_)));
+                }
+                acc_ = 0;
+                pending_ = 0;
+            }
+
+        private:
+            std::vector<std::uint8_t>& out_;
+            std::uint64_t acc_ = 0;
+            int pending_ = 0;  ///< Bits in acc_ not yet written (< 8 between calls)
+        };
+
+        class BitReader {
+        public:
+            explicit BitReader(std::span<const std::uint8_t> in) : p_(in.data()), end_(in.data() + in.size()) {}
+
+            std::uint64_t read(int bits) {
+                if (bits > 32) {
+                    const std::uint64_t HI = read(bits - 32);
+                    return (HI << 32) | read(32);
+                }
+                while (avail_ < bits) {
+                    if (p_ == end_) throw std::runtime_error("Bar chunk truncated");
+                    acc_ = (acc_ << 8) | *p_++;
+                    avail_ += 8;
+                }
+                avail_ -= bits;
+                return (acc_ >> avail_) & ((1ULL << bits) - 1);
+            }
+
+            bool bit() { return read(1) != 0; }
+
+        private:
+            const std::uint8_t* p_;
+            const std::uint8_t* end_;
+            std::uint64_t acc_ = 0;
+            int avail_ = 0;
+        };
+
+        void putVarint(std::vector<std::uint8_t>& out, std::uint64_t v) {
+            while (v >= 0x80) {
+                out.push_back(static_cast<std::uint8_t>(v | 0x80));
+                v >>= 7;
+            }
+            out.push_back(static_cast<std::uint8_t>(v));
+        }
+
+        std::uint64_t getVarint(std::span<const std::uint8_t> in, std::size_t& pos) {
+            std::uint64_t v = 0;
+            for (int shift = 0; shift < 64; shift += 7) {
+                if (pos >= in.size()) throw std::runtime_error("Bar chunk truncated");
+                const std::uint8_t B = in[pos++];
+                v |= static_cast<std::uint64_t>(B & 0x7F) << shift;
+                if ((B & 0x80) == 0) return v;
+            }
+            throw std::runtime_error("Bar chunk has a malformed length");
+        }
+
+        // --- Small signed integers: zigzag, prefix-coded buckets ---------------
+
+        /// Value widths after the prefixes 10, 110, 1110, 11110 and 11111; 0 is the single bit 0.
+        constexpr std::array<int, 5> DOD_BITS = {7, 12, 20, 32, 64};
+
+        void putDod(BitWriter& w, std::int64_t dod) {
+            const std::uint64_t Z = (static_cast<std::uint64_t>(dod) << 1) ^ static_cast<std::uint64_t>(dod >> 63);
+            if (Z == 0) {
+                w.write(0, 1);
+                return;
+            }
+            for (std::size_t b = 0; b < DOD_BITS.size(); ++b) {
+                const int WIDTH = DOD_BITS[b];
+                if (WIDTH == 64 || Z < (1ULL << WIDTH)) {
+                    const int ONES = static_cast<int>(b) + 1;  // prefix: ONES 1s, then 0 except for the last bucket
+                    const bool LAST = b + 1 == DOD_BITS.size();
+                    w.write(((1ULL << ONES) - 1) << (LAST ? 0 : 1), ONES + (LAST ? 0 : 1));
+                    w.write(Z, WIDTH);
+                    return;
+                }
+            }
+        }
+
+        std::int64_t getDod(BitReader& r) {
+            std::size_t b = 0;
+            while (b < DOD_BITS.size() && r.bit()) ++b;
+            if (b == 0) return 0;
+            const std::uint64_t Z = r.read(DOD_BITS[b - 1]);
+            return static_cast<std::int64_t>((Z >> 1) ^ (~(Z & 1) + 1));
+        }
+
+        /// Wrapping difference, so any int64 sequence round-trips.
+        std::int64_t wrapSub(std::int64_t a, std::int64_t b) {
+            return static_cast<std::int64_t>(static_cast<std::uint64_t>(a) - static_cast<std::uint64_t>(b));
+        }
+
+        std::int64_t wrapAdd(std::int64_t a, std::int64_t b) {
+            return static_cast<std::int64_t>(static_cast<std::uint64_t>(a) + static_cast<std::uint64_t>(b));
+        }
+
+        // --- Doubles, decimal mode: scaled integers, delta coded --------------
+        //
+        // Prices and volumes are usually decimals with a few digits, whose
+        // binary mantissas differ in almost every bit, so XOR coding gains
+        // little on them. If every value of a column is exactly n / 10^k for
+        // an integer n (|n| < 2^53), the column stores k and the deltas of n.
+
+        constexpr std::uint8_t MODE_XOR = 0;
+        constexpr std::uint8_t MODE_DECIMAL = 1;
+        constexpr int MAX_DECIMALS = 8;
+        constexpr double POW10[MAX_DECIMALS + 1] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8};
+
+        /// Scaled integer of @p x with @p k decimals, if @p x round-trips through it bit for bit.
+        bool toScaled(double x, int k, std::int64_t& n) {
+            const double SCALED = x * POW10[k];
+            if (!(std::abs(SCALED) < 9007199254740992.0)) return false;  // 2^53; also rejects NaN/inf
+            n = static_cast<std::int64_t>(std::llround(SCALED));
+            return std::bit_cast<std::uint64_t>(static_cast<double>(n) / POW10[k]) == std::bit_cast<std::uint64_t>(x);
+        }
+
+        /// Fewest decimals representing every value of @p column, or -1.
+        int decimalsOf(std::span<const double> column) {
+            int k = 0;
+            std::int64_t n;
+            for (double x : column) {
+                while (!toScaled(x, k, n)) {
+                    if (++k > MAX_DECIMALS) return -1;
+                }
+            }
+            // A value exact at a smaller k need not be at the final one: its
+            // scaled integer may pass 2^53 (150000000 at k = 8) or round
+            // differently (44640302.7 at k = 8). Those columns take XOR mode.
+            for (double x : column) {
+                if (!toScaled(x, k, n)) return -1;
+            }
+            return k;
+        }
+
+        // --- Doubles, XOR mode: Gorilla XOR against the previous value --------
+
+        class XorEncoder {
+        public:
+            void put(BitWriter& w, double x) {
+                const std::uint64_t BITS = std::bit_cast<std::uint64_t>(x);
+                if (first_) {
+                    w.write(BITS, 64);
+                    first_ = false;
+                } else if (const std::uint64_t X = BITS ^ prev_; X == 0) {
+                    w.write(0, 1);
+                } else {
+                    const int LZ = std::min(std::countl_zero(X), 31);  // 5-bit field
+                    const int TZ = std::countr_zero(X);
+                    if (lz_ >= 0 && LZ >= lz_ && TZ >= tz_) {
+                        // Meaningful bits fit in the previous window.
+                        w.write(0b10, 2);
+                        w.write(X >> tz_, 64 - lz_ - tz_);
+                    } else {
+                        const int LEN = 64 - LZ - TZ;
+                        w.write(0b11, 2);
+                        w.write(static_cast<std::uint64_t>(LZ), 5);
+                        w.write(static_cast<std::uint64_t>(LEN & 63), 6);  // 64 stored as 0
+                        w.write(X >> TZ, LEN);
+                        lz_ = LZ;
+                        tz_ = TZ;
+                    }
+                }
+                prev_ = BITS;
+            }
+
+        private:
+            std::uint64_t prev_ = 0;
+            int lz_ = -1;  ///< Leading zeros of the current window (-1: none yet)
+            int tz_ = 0;
+            bool first_ = true;
+        };
+
+        class XorDecoder {
+        public:
+            double get(BitReader& r) {
+                if (first_) {
+                    prev_ = r.read(64);
+                    first_ = false;
+                } else if (r.bit()) {
+                    if (r.bit()) {
+                        lz_ = static_cast<int>(r.read(5));
+                        const int LEN = static_cast<int>(r.read(6));
+                        tz_ = 64 - lz_ - (LEN == 0 ? 64 : LEN);
+                        if (tz_ < 0) throw std::runtime_error("Bar chunk has a malformed value");
+                    } else if (lz_ < 0) {
+                        throw std::runtime_error("Bar chunk has a malformed value");
+                    }
+                    prev_ ^= r.read(64 - lz_ - tz_) << tz_;
+                }
+                return std::bit_cast<double>(prev_);
+            }
+
+        private:
+            std::uint64_t prev_ = 0;
+            int lz_ = -1;
+            int tz_ = 0;
+            bool first_ = true;
+        };
+
+        /// Reads one value column in either mode (first byte of the stream).
+        class ColumnDecoder {
+        public:
+            explicit ColumnDecoder(std::span<const std::uint8_t> stream) : reader_(body(stream)) {
+                if (stream.empty()) return;  // no bars; any read throws
+                mode_ = stream[0];
+                if (mode_ == MODE_DECIMAL) {
+                    if (stream.size() < 2 || stream[1] > MAX_DECIMALS) {
+                        throw std::runtime_error("Bar chunk has a malformed column header");
+                    }
+                    scale_ = POW10[stream[1]];
+                } else if (mode_ != MODE_XOR) {
+                    throw std::runtime_error("Bar chunk has an unknown column mode");
+                }
+            }
+
+            double get() {
+                if (mode_ == MODE_DECIMAL) {
+                    n_ = wrapAdd(n_, getDod(reader_));
+                    return static_cast<double>(n_) / scale_;
+                }
+                return xor_.get(reader_);
+            }
+
+        private:
+            static std::span<const std::uint8_t> body(std::span<const std::uint8_t> stream) {
+                if (stream.empty()) return stream;
+                return stream.subspan(std::min<std::size_t>(stream.size(), stream[0] == MODE_DECIMAL ? 2 : 1));
+            }
+
+            BitReader reader_;
+            std::uint8_t mode_ = MODE_XOR;
+            double scale_ = 1.0;
+            std::int64_t n_ = 0;
+            XorDecoder xor_;
+        };
+
+    } // namespace
+
+    std::vector<std::uint8_t> encodeBarChunk(const domain::BarColumns& bars) {
+        const std::size_t N = bars.size();
+        std::array<std::vector<std::uint8_t>, STREAMS> streams;
+
+        {
+            BitWriter w(streams[0]);
+            std::int64_t prev = 0, prev_delta = 0;
+            for (std::size_t i = 0; i < N; ++i) {
+                const std::int64_t TS = bars.ts_[i];
+                if (i == 0) {
+                    w.write(static_cast<std::uint64_t>(TS), 64);
+                } else {
+                    const std::int64_t DELTA = wrapSub(TS, prev);
+                    putDod(w, wrapSub(DELTA, prev_delta));
+                    prev_delta = DELTA;
+                }
+                prev = TS;
+            }
+            w.flush();
+        }
+
+        const std::array<std::span<const double>, STREAMS - 1> VALUES = {bars.open_, bars.high_, bars.low_,
+                                                                         bars.close_, bars.volume_};
+        for (std::size_t c = 0; c < VALUES.size(); ++c) {
+            auto& out = streams[c + 1];
+            const int DECIMALS = decimalsOf(VALUES[c]);
+            BitWriter w(out);
+            if (DECIMALS >= 0) {
+                out.push_back(MODE_DECIMAL);
+                out.push_back(static_cast<std::uint8_t>(DECIMALS));
+                std::int64_t prev = 0, n = 0;
+                for (double x : VALUES[c]) {
+                    [[maybe_unused]] const bool EXACT = toScaled(x, DECIMALS, n);
+                    assert(EXACT);  // checked by decimalsOf()
+                    putDod(w, wrapSub(n, prev));
+                    prev = n;
+                }
+            } else {
+                out.push_back(MODE_XOR);
+                XorEncoder enc;
+                for (double x : VALUES[c]) enc.put(w, x);
+            }
+            w.flush();
+        }
+
+        std::vector<std::uint8_t> out;
+        std::size_t body = 0;
+        for (const auto& s : streams) body += s.size();
+        out.reserve(1 + 10 * (STREAMS + 1) + body);
+        out.push_back(VERSION);
+        putVarint(out, N);
+        for (const auto& s : streams) putVarint(out, s.size());
+        for (const auto& s : streams) out.insert(out.end(), s.begin(), s.end());
+        return out;
+    }
+
+    std::size_t decodeBarChunk(std::span<const std::uint8_t> chunk, domain::backtest::BarSeries& out,
+                               QuoteField fields, std::int64_t from_ts, std::int64_t to_ts) {
+        if (chunk.empty() || chunk[0] != VERSION) {
+            throw std::runtime_error("Unsupported bar chunk version");
+        }
+        std::size_t pos = 1;
+        const std::uint64_t N = getVarint(chunk, pos);
+        std::array<std::span<const std::uint8_t>, STREAMS> streams;
+        std::array<std::uint64_t, STREAMS> lengths{};
+        for (auto& len : lengths) len = getVarint(chunk, pos);
+        for (std::size_t s = 0; s < STREAMS; ++s) {
+            if (lengths[s] > chunk.size() - pos) throw std::runtime_error("Bar chunk truncated");
+            streams[s] = chunk.subspan(pos, lengths[s]);
+            pos += lengths[s];
+        }
+        // Every bar takes at least one bit of the timestamp stream.
+        if (N > 8 * lengths[0]) throw std::runtime_error("Bar chunk truncated");
+
+        // Timestamps first: they decide how many rows to append and where to stop.
+        std::vector<std::int64_t> ts(N);
+        std::size_t keep = 0, end = 0;  // rows in the window; one past the last of them
+        {
+            BitReader r(streams[0]);
+            std::int64_t prev = 0, prev_delta = 0;
+            for (std::size_t i = 0; i < N; ++i) {
+                if (i == 0) {
+                    prev = static_cast<std::int64_t>(r.read(64));
+                } else {
+                    prev_delta = wrapAdd(prev_delta, getDod(r));
+                    prev = wrapAdd(prev, prev_delta);
+                }
+                ts[i] = prev;
+                if (prev >= from_ts && prev < to_ts) {
+                    ++keep;
+                    end = i + 1;
+                }
+            }
+        }
+        if (keep == 0) return 0;
+
+        const QuoteField FIELD[STREAMS - 1] = {QuoteField::Open, QuoteField::High, QuoteField::Low,
+                                               QuoteField::Close, QuoteField::Volume};
+        std::array<ColumnDecoder, STREAMS - 1> columns = {ColumnDecoder(streams[1]), ColumnDecoder(streams[2]),
+                                                          ColumnDecoder(streams[3]), ColumnDecoder(streams[4]),
+                                                          ColumnDecoder(streams[5])};
+        bool wanted[STREAMS - 1];
+        for (std::size_t c = 0; c < STREAMS - 1; ++c) wanted[c] = hasField(fields, FIELD[c]);
+
+        const std::size_t BASE = out.size();
+        out.resize(BASE + keep);
+        try {
+            std::size_t row = BASE;
+            double v[STREAMS - 1] = {};
+            for (std::size_t i = 0; i < end; ++i) {
+                for (std::size_t c = 0; c < STREAMS - 1; ++c) {
+                    if (wanted[c]) v[c] = columns[c].get();
+                }
+                if (ts[i] >= from_ts && ts[i] < to_ts) {
+                    out.set(row++, domain::Quote{ts[i], v[0], v[1], v[2], v[3], v[4]});
+                }
+            }
+        } catch (...) {
+            out.resize(BASE);  // leave @p out as it was
+            throw;
+        }
+        return keep;
+    }
+
+} // namespace qga::persistence
@@ -3,48 +3,116 @@
 namespace qga::persistence {
 
 DatabaseWorker::DatabaseWorker(std::unique_ptr<IDataStore> store,
-                               std::shared_ptr<utils::ILogger> logger)
-    : store_(std::move(store)), logger_(std::move(logger)) {
+                               std::shared_ptr<utils::ILogger> logger,
+                               const DatabaseWorkerOptions& options)
+    : store_(std::move(store)), logger_(std::move(logger)), options_(options) {
+    if (options_.capacity_ == 0 || options_.max_batch_ == 0) {
+        throw std::invalid_argument("DatabaseWorker: capacity and max_batch must be positive");
+    }
     worker_ = std::thread(&DatabaseWorker::run, this);
     if (logger_) logger_->info("DatabaseWorker started");
 }
 
 DatabaseWorker::~DatabaseWorker() {
     stop();
-    if (worker_.joinable()) {
-        worker_.join();
-    }
     if (logger_) logger_->info("DatabaseWorker stopped");
 }
 
-void DatabaseWorker::enqueue(Task task) {
+bool DatabaseWorker::enqueue(Task task) {
+    return push(std::move(task), true);
+}
+
+bool DatabaseWorker::push(Task task, bool write) {
     {
-        std::lock_guard<std::mutex> lock(mutex_);
-        tasks_.push(std::move(task));
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (options_.overflow_ == OverflowPolicy::Block) {
+            space_.wait(lock, [&] { return jobs_.size() < options_.capacity_ || stopping_; });
+        }
+        if (stopping_ || jobs_.size() >= options_.capacity_) {
+            ++rejected_;
+            return false;
+        }
+        jobs_.push_back(Job{std::move(task), write});
     }
     cv_.notify_one();
+    return true;
 }
 
 void DatabaseWorker::stop() {
-    running_ = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
     cv_.notify_all();
+    space_.notify_all();
+
+    // A task that stops its own worker cannot wait for itself.
+    if (std::this_thread::get_id() == worker_.get_id()) return;
+    std::lock_guard<std::mutex> lock(join_mutex_);
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+}
+
+std::size_t DatabaseWorker::rejected() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return rejected_;
 }
 
 void DatabaseWorker::run() {
-    while (running_) {
-        Task task;
+    std::vector<Job> batch;
+    for (;;) {
         {
             std::unique_lock<std::mutex> lock(mutex_);
-            cv_.wait(lock, [&] { return !tasks_.empty() || !running_; });
-            if (!running_ && tasks_.empty()) break;
-            task = std::move(tasks_.front());
-            tasks_.pop();
+            cv_.wait(lock, [&] { return !jobs_.empty() || stopping_; });
+            if (jobs_.empty()) break;  // stopping and drained
+
+            // A read runs alone; a write takes the writes queued right behind it.
+            do {
+                batch.push_back(std::move(jobs_.front()));
+                jobs_.pop_front();
+            } while (batch.front().write_ && batch.size() < options_.max_batch_ &&
+                     !jobs_.empty() && jobs_.front().write_);
         }
+        space_.notify_all();
+        runBatch(batch);
+        batch.clear();
+    }
+}
+
+void DatabaseWorker::runBatch(std::vector<Job>& batch) {
+    auto runOne = [&](Job& job) {
         try {
-            task(*store_);
+            job.task_(*store_);
         } catch (const std::exception& ex) {
             if (logger_) logger_->error("Database task failed: " + std::string(ex.what()));
         }
+    };
+
+    // Single tasks and reads keep the store's own per-call transactions.
+    bool batched = batch.size() > 1;
+    if (batched) {
+        try {
+            store_->beginWriteBatch();
+        } catch (const std::exception& ex) {
+            if (logger_) logger_->error("Write batch not started, running tasks one by one: " +
+                                        std::string(ex.what()));
+            batched = false;
+        }
+    }
+
+    for (auto& job : batch) {
+        runOne(job);
+    }
+
+    if (batched) {
+        try {
+            store_->commitWriteBatch();
+        } catch (const std::exception& ex) {
+            store_->rollbackWriteBatch();
+            if (logger_) logger_->error("Write batch of " + std::to_string(batch.size()) +
+                                        " tasks failed: " + std::string(ex.what()));
+        }
     }
 }
 
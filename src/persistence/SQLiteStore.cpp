@@ -1,89 +1,389 @@
 #include "persistence/SQLiteStore.hpp"
+#include "persistence/BarChunkCodec.hpp"
 #include "persistence/Statement.hpp"
 #include "utils/ILogger.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <vector>
 
 namespace qga::persistence {
 
+    namespace {
+
+        /// user_version written by initSchema(): 1 = symbols table, 2 = bar_chunks.
+        constexpr int SCHEMA_VERSION = 2;
+
+        /// Rows per multi-row INSERT: 1 + 6 * 128 parameters stay below the
+        /// 999-variable limit of older SQLite builds.
+        constexpr std::size_t ROWS_PER_INSERT = 128;
+
+        constexpr const char* UPSERT_TAIL =
+            " ON CONFLICT(symbol_id, ts) DO UPDATE SET "
+            "open = excluded.open, high = excluded.high, "
+            "low = excluded.low, close = excluded.close, volume = excluded.volume;";
+
+        /// `INSERT INTO <table> ... VALUES (?1,?,?,?,?,?,?), ...` for @p rows rows;
+        /// ?1 is the symbol id shared by every row.
+        std::string multiRowInsert(const char* table, std::size_t rows, bool upsert) {
+            std::string sql = std::string("INSERT INTO ") + table +
+                              " (symbol_id, ts, open, high, low, close, volume) VALUES ";
+            sql.reserve(sql.size() + rows * 18 + 160);
+            for (std::size_t r = 0; r < rows; ++r) {
+                sql += r == 0 ? "(?1,?,?,?,?,?,?)" : ",(?1,?,?,?,?,?,?)";
+            }
+            sql += upsert ? UPSERT_TAIL : ";";
+            return sql;
+        }
+
+        constexpr const char* STAGING_TABLE = "temp.bulk_quotes";
+
+        /// Statements on the staging table end with it.
+        void dropStagingStatements(StatementCache& cache) noexcept {
+            cache.erase(multiRowInsert(STAGING_TABLE, ROWS_PER_INSERT, false));
+            cache.erase(multiRowInsert(STAGING_TABLE, 1, false));
+        }
+
+        constexpr struct {
+            QuoteField field_;
+            const char* column_;
+        } PROJECTED[] = {
+            {QuoteField::Open, "open"}, {QuoteField::High, "high"}, {QuoteField::Low, "low"},
+            {QuoteField::Close, "close"}, {QuoteField::Volume, "volume"},
+        };
+
+        /// Range query reading `ts` and the columns in @p fields (at most 32 distinct texts).
+        std::string selectRangeSql(QuoteField fields) {
+            std::string sql = "SELECT ts";
+            for (const auto& p : PROJECTED) {
+                if (hasField(fields, p.field_)) {
+                    sql += ", ";
+                    sql += p.column_;
+                }
+            }
+            sql += " FROM quotes"
+                   " WHERE symbol_id = (SELECT id FROM symbols WHERE name = ?1) AND ts >= ?2 AND ts < ?3"
+                   " ORDER BY ts ASC LIMIT ?4;";
+            return sql;
+        }
+
+        /// SQLite LIMIT value for @p limit, where 0 means no limit.
+        sqlite3_int64 sqlLimit(std::size_t limit) {
+            constexpr auto MAX = static_cast<std::size_t>(std::numeric_limits<sqlite3_int64>::max());
+            return limit == 0 || limit > MAX ? -1 : static_cast<sqlite3_int64>(limit);
+        }
+
+        constexpr std::int64_t MS_PER_DAY = 86'400'000;
+
+        /// Length of one bar of @p timeframe ("30s", "1m", "5m", "1h", "1d", "1w") in ms.
+        std::int64_t barLengthMs(const std::string& timeframe) {
+            std::size_t digits = 0;
+            while (digits < timeframe.size() && timeframe[digits] >= '0' && timeframe[digits] <= '9') ++digits;
+            std::int64_t unit = 0;
+            if (timeframe.size() == digits + 1) {
+                switch (timeframe.back()) {
+                    case 's': unit = 1'000; break;
+                    case 'm': unit = 60'000; break;
+                    case 'h': unit = 3'600'000; break;
+                    case 'd': unit = MS_PER_DAY; break;
+                    case 'w': unit = 7 * MS_PER_DAY; break;
+                    default: break;
+                }
+            }
+            if (digits == 0 || digits > 6 || unit == 0 || std::stoll(timeframe.substr(0, digits)) == 0) {
+                throw std::invalid_argument("Unsupported timeframe: '" + timeframe + "'");
+            }
+            return std::stoll(timeframe.substr(0, digits)) * unit;
+        }
+
+        /// Time span of one bar_chunks row: a UTC day for intraday bars below one
+        /// hour, 64 days for hourly bars and 2048 days from daily bars up, i.e.
+        /// a few hundred to a few thousand bars per chunk.
+        std::int64_t chunkSpanMs(const std::string& timeframe) {
+            const std::int64_t BAR = barLengthMs(timeframe);
+            if (BAR < 3'600'000) return MS_PER_DAY;
+            if (BAR < MS_PER_DAY) return 64 * MS_PER_DAY;
+            return 2'048 * MS_PER_DAY;
+        }
+
+        /// Start of the chunk holding @p ts (floor division, also for negative ts).
+        std::int64_t chunkStart(std::int64_t ts, std::int64_t span) {
+            const std::int64_t REM = ((ts % span) + span) % span;
+            return ts < std::numeric_limits<std::int64_t>::min() + REM ? std::numeric_limits<std::int64_t>::min()
+                                                                       : ts - REM;
+        }
+
+        domain::Quote barAt(const domain::BarColumns& c, std::size_t i) {
+            return {c.ts_[i], c.open_[i], c.high_[i], c.low_[i], c.close_[i], c.volume_[i]};
+        }
+
+        /// Merges two time-ordered runs into @p out; @p newer wins on equal timestamps.
+        void mergeBars(const domain::BarColumns& older, const domain::BarColumns& newer,
+                       domain::backtest::BarSeries& out) {
+            out.clear();
+            out.reserve(older.size() + newer.size());
+            std::size_t i = 0, j = 0;
+            while (i < older.size() || j < newer.size()) {
+                if (j == newer.size() || (i < older.size() && older.ts_[i] < newer.ts_[j])) {
+                    out.add(barAt(older, i++));
+                } else {
+                    if (i < older.size() && older.ts_[i] == newer.ts_[j]) ++i;
+                    out.add(barAt(newer, j++));
+                }
+            }
+        }
+
+        constexpr int BUSY_TIMEOUT_MS = 5'000;
+
+        sqlite3* openConnection(const std::string& path, int flags) {
+            sqlite3* db = nullptr;
+            if (sqlite3_open_v2(path.c_str(), &db, flags, nullptr) != SQLITE_OK) {
+                const std::string ERR = db ? sqlite3_errmsg(db) : "out of memory";
+                sqlite3_close(db);
+                throw std::runtime_error("Could not open SQLite database: " + ERR);
+            }
+            sqlite3_busy_timeout(db, BUSY_TIMEOUT_MS);
+            return db;
+        }
+
+        /// Private databases exist once per connection, so they cannot get read connections.
+        bool isPrivateDatabase(const std::string& path) {
+            return path.empty() || path == ":memory:" || path.find("mode=memory") != std::string::npos;
+        }
+
+        int pragmaInt(sqlite3* db, const char* name) {
+            Statement st{db, (std::string("PRAGMA ") + name + ";").c_str()};
+            return st.stepRow() ? st.getColumnInt(0) : 0;
+        }
+
+    } // namespace
+
+    struct SQLiteStore::ReadConnection {
+        sqlite3* db_;
+        StatementCache statements_;
+
+        explicit ReadConnection(sqlite3* db) noexcept : db_(db), statements_(db) {}
+        ~ReadConnection() {
+            statements_.clear();
+            sqlite3_close(db_);
+        }
+    };
+
+    // Every use of db_ holds write_mtx_, and each read connection stays on
+    // its thread, so SQLite's own per-connection mutex is not needed.
     SQLiteStore::SQLiteStore(const std::string& db_file,
                              std::shared_ptr<utils::ILogger> logger)
-        : db_path_(db_file), logger_(std::move(logger)) {
-        if (sqlite3_open_v2(db_path_.c_str(), &db_,
-                            SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_FULLMUTEX,
-                            nullptr) != SQLITE_OK) {
-            db_ = nullptr;
-            throw std::runtime_error("Could not open SQLite database: " +
-                                     std::string(sqlite3_errmsg(db_)));
-        }
+        : db_path_(db_file), logger_(std::move(logger)),
+          db_(openConnection(db_path_, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_NOMUTEX)),
+          statements_(db_), shared_reads_(isPrivateDatabase(db_path_)) {
         if (logger_) {
             logger_->info("Opened SQLite database at: " + db_path_);
         }
 
-        // Minimal schema
-        Statement::execDdl(db_,
-            "PRAGMA foreign_keys=ON;"
-            "CREATE TABLE IF NOT EXISTS quotes("
-            "  symbol TEXT NOT NULL,"
-            "  ts     INTEGER NOT NULL,"    // epoch ms
-            "  open   REAL NOT NULL,"
-            "  high   REAL NOT NULL,"
-            "  low    REAL NOT NULL,"
-            "  close  REAL NOT NULL,"
-            "  volume REAL NOT NULL,"
-            "  PRIMARY KEY(symbol, ts)"
-            ");"
-        );
+        try {
+            initSchema();
+        } catch (...) {
+            statements_.clear();
+            sqlite3_close(db_);
+            db_ = nullptr;
+            throw;
+        }
     }
 
     SQLiteStore::~SQLiteStore() {
+        readers_.clear();
         if (db_) {
+            if (bulk_) {
+                if (logger_) {
+                    logger_->error("Bulk load not ended, rolling back: " + db_path_);
+                }
+                abortBulkLoad();
+            }
+            if (batch_) {
+                if (logger_) {
+                    logger_->error("Write batch not committed, rolling back: " + db_path_);
+                }
+                rollbackWriteBatch();
+            }
             if (logger_) {
                 logger_->info("Closed SQLite database at: " + db_path_);
             }
+            statements_.clear();  // finalize before closing
             sqlite3_close(db_);
             db_ = nullptr;
         }
     }
 
+    void SQLiteStore::initSchema() {
+        // WAL lets readers run next to the writer; it is persistent, so this
+        // only switches a database once.
+        Statement::execDdl(db_, "PRAGMA foreign_keys=ON; PRAGMA journal_mode=WAL;");
+        const int VERSION = pragmaInt(db_, "user_version");
+        if (VERSION >= SCHEMA_VERSION) return;
+
+        Statement::execDdl(db_, "BEGIN IMMEDIATE;");
+        try {
+            bool legacy_layout = false;
+            if (VERSION < 1) {
+                Statement legacy{db_, "SELECT 1 FROM pragma_table_info('quotes') WHERE name = 'symbol';"};
+                legacy_layout = legacy.stepRow();
+            }
+            const bool MIGRATE = legacy_layout;
+            if (MIGRATE) {
+                Statement::execDdl(db_, "ALTER TABLE quotes RENAME TO quotes_legacy;");
+            }
+
+            // Keep in sync with sql/migrations/004_quote_symbols.sql
+            Statement::execDdl(db_,
+                "CREATE TABLE IF NOT EXISTS symbols("
+                "  id   INTEGER PRIMARY KEY,"
+                "  name TEXT NOT NULL UNIQUE"
+                ");"
+                "CREATE TABLE IF NOT EXISTS quotes("
+                "  symbol_id INTEGER NOT NULL REFERENCES symbols(id),"
+                "  ts        INTEGER NOT NULL,"    // epoch ms
+                "  open      REAL NOT NULL,"
+                "  high      REAL NOT NULL,"
+                "  low       REAL NOT NULL,"
+                "  close     REAL NOT NULL,"
+                "  volume    REAL NOT NULL,"
+                "  PRIMARY KEY(symbol_id, ts)"
+                ") WITHOUT ROWID;"
+                "CREATE VIEW IF NOT EXISTS quotes_by_symbol AS"
+                "  SELECT s.name AS symbol, q.ts, q.open, q.high, q.low, q.close, q.volume"
+                "  FROM quotes q JOIN symbols s ON s.id = q.symbol_id;"
+            );
+
+            if (MIGRATE) {
+                Statement::execDdl(db_,
+                    "INSERT OR IGNORE INTO symbols(name) SELECT DISTINCT symbol FROM quotes_legacy;"
+                    "INSERT INTO quotes (symbol_id, ts, open, high, low, close, volume)"
+                    "  SELECT s.id, l.ts, l.open, l.high, l.low, l.close, l.volume"
+                    "  FROM quotes_legacy l JOIN symbols s ON s.name = l.symbol"
+                    "  ORDER BY s.id, l.ts;"
+                    "DROP TABLE quotes_legacy;"
+                );
+            }
+
+            // Keep in sync with sql/migrations/005_bar_chunks.sql
+            Statement::execDdl(db_,
+                "CREATE TABLE IF NOT EXISTS bar_chunks("
+                "  id          INTEGER PRIMARY KEY,"
+                "  symbol_id   INTEGER NOT NULL REFERENCES symbols(id),"
+                "  timeframe   TEXT NOT NULL,"
+                "  chunk_start INTEGER NOT NULL,"  // epoch ms, start of the time partition
+                "  bar_count   INTEGER NOT NULL,"
+                "  first_ts    INTEGER NOT NULL,"
+                "  last_ts     INTEGER NOT NULL,"
+                "  data        BLOB NOT NULL"       // BarChunkCodec
+                ");"
+                "CREATE UNIQUE INDEX IF NOT EXISTS idx_bar_chunks_symbol_tf_start"
+                "  ON bar_chunks(symbol_id, timeframe, chunk_start);"
+            );
+            Statement::execDdl(db_, ("PRAGMA user_version = " + std::to_string(SCHEMA_VERSION) +
+                                     "; COMMIT;").c_str());
+            if (MIGRATE && logger_) {
+                logger_->info("Migrated quotes to the symbols dimension table: " + db_path_);
+            }
+        } catch (...) {
+            Statement::execDdl(db_, "ROLLBACK;");
+            throw;
+        }
+    }
+
+    std::int64_t SQLiteStore::symbolId(const std::string& symbol) {
+        if (const auto IT = symbol_ids_.find(symbol); IT != symbol_ids_.end()) {
+            return IT->second;
+        }
+
+        {
+            auto ins = statements_.acquire("INSERT OR IGNORE INTO symbols(name) VALUES (?);");
+            ins->bindText(1, symbol);
+            ins->stepDone();
+        }
+
+        auto sel = statements_.acquire("SELECT id FROM symbols WHERE name = ?;");
+        sel->bindText(1, symbol);
+        if (!sel->stepRow()) {
+            throw std::runtime_error("Failed to register symbol: " + symbol);
+        }
+        const std::int64_t ID = sel->getColumnInt64(0);
+        symbol_ids_.emplace(symbol, ID);
+        return ID;
+    }
+
+    void SQLiteStore::writeQuotes(std::int64_t symbol_id, const std::vector<domain::Quote>& quotes,
+                                  bool staged) {
+        const char* TABLE = staged ? STAGING_TABLE : "quotes";
+        auto run = [&](const std::string& sql, std::size_t first, std::size_t rows) {
+            auto ins = statements_.acquire(sql);
+            ins->bindInt64(1, symbol_id);
+            int p = 2;
+            for (std::size_t i = first; i < first + rows; ++i) {
+                const auto& q = quotes[i];
+                ins->bindInt64(p++, static_cast<sqlite3_int64>(q.ts_));
+                ins->bindDouble(p++, q.open_);
+                ins->bindDouble(p++, q.high_);
+                ins->bindDouble(p++, q.low_);
+                ins->bindDouble(p++, q.close_);
+                ins->bindDouble(p++, q.volume_);
+            }
+            if (!ins->stepDone()) {
+                throw std::runtime_error("Failed to insert/update quotes");
+            }
+        };
+
+        // Full batches through the multi-row statement, the rest row by row:
+        // two cached statements serve every call.
+        const std::size_t BULK = quotes.size() - quotes.size() % ROWS_PER_INSERT;
+        if (BULK > 0) {
+            const std::string SQL = multiRowInsert(TABLE, ROWS_PER_INSERT, !staged);
+            for (std::size_t i = 0; i < BULK; i += ROWS_PER_INSERT) {
+                run(SQL, i, ROWS_PER_INSERT);
+            }
+        }
+        if (BULK < quotes.size()) {
+            const std::string SQL = multiRowInsert(TABLE, 1, !staged);
+            for (std::size_t i = BULK; i < quotes.size(); ++i) {
+                run(SQL, i, 1);
+            }
+        }
+    }
+
     void SQLiteStore::saveQuotes(const std::string& symbol,
                                  const std::vector<domain::Quote>& quotes) {
         if (!db_) throw std::runtime_error("Database not open");
         if (quotes.empty()) return;
 
-        Statement::execDdl(db_, "BEGIN IMMEDIATE;");
-        try {
-            Statement ins{db_,
-                "INSERT INTO quotes (symbol, ts, open, high, low, close, volume) "
-                "VALUES (?, ?, ?, ?, ?, ?, ?) "
-                "ON CONFLICT(symbol, ts) DO UPDATE SET "
-                "open = excluded.open, high = excluded.high, "
-                "low = excluded.low, close = excluded.close, volume = excluded.volume;"
-            };
-
-            for (const auto& q : quotes) {
-                ins.bindText(1, symbol);
-                ins.bindInt64(2, static_cast<sqlite3_int64>(q.ts_));
-                ins.bindDouble(3, q.open_);
-                ins.bindDouble(4, q.high_);
-                ins.bindDouble(5, q.low_);
-                ins.bindDouble(6, q.close_);
-                ins.bindDouble(7, q.volume_);
-
-                if (!ins.stepDone()) {
-                    throw std::runtime_error("Failed to insert/update quote");
+        std::lock_guard lock(write_mtx_);
+        if (bulk_) {
+            try {
+                writeQuotes(symbolId(symbol), quotes, staged_);
+            } catch (...) {
+                if (logger_) {
+                    logger_->error("saveQuotes failed during bulk load, rolling back: " + symbol);
                 }
-                ins.reset();
+                abortBulkLoad();
+                throw;
             }
+            return;
+        }
 
-            Statement::execDdl(db_, "COMMIT;");
+        beginWrite();
+        try {
+            writeQuotes(symbolId(symbol), quotes, false);
+
+            commitWrite();
             if (logger_) {
                 logger_->info("Saved " + std::to_string(quotes.size()) +
                               " quotes for symbol: " + symbol);
             }
         } catch (...) {
-            Statement::execDdl(db_, "ROLLBACK;");
+            rollbackWrite();
             if (logger_) {
                 logger_->error("saveQuotes rollback for " + symbol);
             }
@@ -91,24 +391,213 @@ namespace qga::persistence {
         }
     }
 
-    std::vector<domain::Quote> SQLiteStore::loadQuotes(const std::string& symbol) {
+    void SQLiteStore::beginBulkLoad(const BulkLoadOptions& options) {
         if (!db_) throw std::runtime_error("Database not open");
+        std::lock_guard lock(write_mtx_);
+        if (bulk_ || batch_) throw std::logic_error("SQLiteStore: bulk load or write batch already open");
 
-        std::vector<domain::Quote> quotes;
-        Statement sel{db_, "SELECT ts, open, high, low, close, volume "
-                           "FROM quotes WHERE symbol = ? ORDER BY ts ASC;"};
-        sel.bindText(1, symbol);
+        saved_synchronous_ = pragmaInt(db_, "synchronous");
+        saved_cache_size_  = pragmaInt(db_, "cache_size");
+        const std::string CACHE = std::to_string(-1024LL * options.cache_mib_);  // negative = KiB
+        try {
+            // Inside the try: a BEGIN failing with SQLITE_BUSY must restore the settings too.
+            Statement::execDdl(db_, ("PRAGMA synchronous=NORMAL; PRAGMA cache_size=" + CACHE + ";").c_str());
+            Statement::execDdl(db_, "BEGIN IMMEDIATE;");
+            if (options.defer_index_) {
+                Statement::execDdl(db_,
+                    "CREATE TEMP TABLE IF NOT EXISTS bulk_quotes("
+                    "  symbol_id INTEGER, ts INTEGER,"
+                    "  open REAL, high REAL, low REAL, close REAL, volume REAL"
+                    ");");
+            }
+        } catch (...) {
+            abortBulkLoad();
+            throw;
+        }
+        bulk_   = true;
+        staged_ = options.defer_index_;
+        if (logger_) {
+            logger_->info("Bulk load started: " + db_path_);
+        }
+    }
+
+    void SQLiteStore::endBulkLoad() {
+        std::lock_guard lock(write_mtx_);
+        if (!bulk_) throw std::logic_error("SQLiteStore: no bulk load open");
+
+        try {
+            if (staged_) {
+                dropStagingStatements(statements_);
+                // Key order turns the merge into appends to the clustered index;
+                // rowid keeps the last staged quote of a duplicate (symbol, ts).
+                Statement::execDdl(db_, (std::string(
+                    "INSERT INTO quotes (symbol_id, ts, open, high, low, close, volume)"
+                    "  SELECT symbol_id, ts, open, high, low, close, volume FROM temp.bulk_quotes"
+                    "  WHERE true ORDER BY symbol_id, ts, rowid") + UPSERT_TAIL +
+                    "DROP TABLE temp.bulk_quotes;").c_str());
+            }
+            Statement::execDdl(db_, "COMMIT;");
+        } catch (...) {
+            if (logger_) {
+                logger_->error("Bulk load commit failed, rolling back: " + db_path_);
+            }
+            abortBulkLoad();
+            throw;
+        }
+
+        bulk_   = false;
+        staged_ = false;
+        Statement::execDdl(db_, ("PRAGMA synchronous=" + std::to_string(saved_synchronous_) +
+                                 "; PRAGMA cache_size=" + std::to_string(saved_cache_size_) + ";").c_str());
+        if (logger_) {
+            logger_->info("Bulk load committed: " + db_path_);
+        }
+    }
+
+    void SQLiteStore::abortBulkLoad() noexcept {
+        dropStagingStatements(statements_);
+        sqlite3_exec(db_, "ROLLBACK;", nullptr, nullptr, nullptr);
+        sqlite3_exec(db_, "DROP TABLE IF EXISTS temp.bulk_quotes;", nullptr, nullptr, nullptr);
+        const std::string RESTORE = "PRAGMA synchronous=" + std::to_string(saved_synchronous_) +
+                                    "; PRAGMA cache_size=" + std::to_string(saved_cache_size_) + ";";
+        sqlite3_exec(db_, RESTORE.c_str(), nullptr, nullptr, nullptr);
+        symbol_ids_.clear();
+        bulk_   = false;
+        staged_ = false;
+    }
+
+    void SQLiteStore::beginWriteBatch() {
+        if (!db_) throw std::runtime_error("Database not open");
+        std::lock_guard lock(write_mtx_);
+        if (bulk_ || batch_) throw std::logic_error("SQLiteStore: bulk load or write batch already open");
+        Statement::execDdl(db_, "BEGIN IMMEDIATE;");
+        batch_ = true;
+    }
+
+    void SQLiteStore::commitWriteBatch() {
+        std::lock_guard lock(write_mtx_);
+        if (!batch_) throw std::logic_error("SQLiteStore: no write batch open");
+        batch_ = false;
+        try {
+            Statement::execDdl(db_, "COMMIT;");
+        } catch (...) {
+            if (logger_) {
+                logger_->error("Write batch commit failed, rolling back: " + db_path_);
+            }
+            rollbackWrite();
+            throw;
+        }
+    }
+
+    void SQLiteStore::rollbackWriteBatch() noexcept {
+        std::lock_guard lock(write_mtx_);
+        if (!batch_) return;
+        batch_ = false;
+        rollbackWrite();
+    }
+
+    // Inside a write batch a failed call only rolls back to its savepoint;
+    // the batch transaction stays open for the calls after it.
+    void SQLiteStore::beginWrite() {
+        Statement::execDdl(db_, batch_ ? "SAVEPOINT save_call;" : "BEGIN IMMEDIATE;");
+    }
+
+    void SQLiteStore::commitWrite() {
+        Statement::execDdl(db_, batch_ ? "RELEASE save_call;" : "COMMIT;");
+    }
+
+    void SQLiteStore::rollbackWrite() noexcept {
+        sqlite3_exec(db_, batch_ ? "ROLLBACK TO save_call; RELEASE save_call;" : "ROLLBACK;",
+                     nullptr, nullptr, nullptr);
+        symbol_ids_.clear();  // a new symbol row may have been rolled back
+    }
+
+    SQLiteStore::ReadConnection& SQLiteStore::readConnection() {
+        const auto ID = std::this_thread::get_id();
+        {
+            std::shared_lock lock(readers_mtx_);
+            if (const auto IT = readers_.find(ID); IT != readers_.end()) {
+                return *IT->second;
+            }
+        }
 
-        while (sel.stepRow()) {
-            domain::Quote q{};
-            q.ts_     = static_cast<std::int64_t>(sel.getColumnInt64(0));
-            q.open_   = sel.getColumnDouble(1);
-            q.high_   = sel.getColumnDouble(2);
-            q.low_    = sel.getColumnDouble(3);
-            q.close_  = sel.getColumnDouble(4);
-            q.volume_ = sel.getColumnDouble(5);
-            quotes.push_back(q);
+        // Only this thread adds its own entry, so opening outside the lock is safe.
+        auto conn = std::make_unique<ReadConnection>(
+            openConnection(db_path_, SQLITE_OPEN_READONLY | SQLITE_OPEN_NOMUTEX));
+        std::unique_lock lock(readers_mtx_);
+        auto& slot = readers_[ID];
+        slot = std::move(conn);
+        return *slot;
+    }
+
+    template <typename Fn>
+    decltype(auto) SQLiteStore::withReader(Fn&& fn) {
+        if (!db_) throw std::runtime_error("Database not open");
+        if (shared_reads_) {
+            std::lock_guard lock(write_mtx_);
+            return fn(statements_);
         }
+        return fn(readConnection().statements_);
+    }
+
+    template <typename Emit>
+    std::size_t SQLiteStore::readRange(const std::string& symbol, std::int64_t from, std::int64_t to,
+                                       std::size_t limit, QuoteField fields, Emit&& emit) {
+        // Result column of each projected field (0 = not selected; ts is column 0).
+        int col[std::size(PROJECTED)] = {};
+        for (int i = 0, next = 1; i < static_cast<int>(std::size(PROJECTED)); ++i) {
+            if (hasField(fields, PROJECTED[i].field_)) col[i] = next++;
+        }
+
+        return withReader([&](StatementCache& cache) {
+            auto sel = cache.acquire(selectRangeSql(fields));
+            sel->bindText(1, symbol);
+            sel->bindInt64(2, from);
+            sel->bindInt64(3, to);
+            sel->bindInt64(4, sqlLimit(limit));
+
+            std::size_t rows = 0;
+            while (sel->stepRow()) {
+                domain::Quote q{};
+                q.ts_     = static_cast<std::int64_t>(sel->getColumnInt64(0));
+                q.open_   = col[0] ? sel->getColumnDouble(col[0]) : 0.0;
+                q.high_   = col[1] ? sel->getColumnDouble(col[1]) : 0.0;
+                q.low_    = col[2] ? sel->getColumnDouble(col[2]) : 0.0;
+                q.close_  = col[3] ? sel->getColumnDouble(col[3]) : 0.0;
+                q.volume_ = col[4] ? sel->getColumnDouble(col[4]) : 0.0;
+                emit(q);
+                ++rows;
+            }
+            return rows;
+        });
+    }
+
+    std::int64_t SQLiteStore::lastRangeStart(const std::string& symbol, std::int64_t from,
+                                             std::int64_t to, std::size_t count) {
+        return withReader([&](StatementCache& cache) {
+            auto sel = cache.acquire(
+                "SELECT ts FROM quotes"
+                " WHERE symbol_id = (SELECT id FROM symbols WHERE name = ?1) AND ts >= ?2 AND ts < ?3"
+                " ORDER BY ts DESC LIMIT 1 OFFSET ?4;");
+            sel->bindText(1, symbol);
+            sel->bindInt64(2, from);
+            sel->bindInt64(3, to);
+            sel->bindInt64(4, sqlLimit(count) - 1);
+            return sel->stepRow() ? static_cast<std::int64_t>(sel->getColumnInt64(0)) : from;
+        });
+    }
+
+    std::vector<domain::Quote> SQLiteStore::loadQuotes(const std::string& symbol) {
+        return loadQuotes(symbol, QuoteQuery{});
+    }
+
+    std::vector<domain::Quote> SQLiteStore::loadQuotes(const std::string& symbol, const QuoteQuery& query) {
+        const std::int64_t FROM = query.last_ && query.limit_ > 0
+                                      ? lastRangeStart(symbol, query.from_ts_, query.to_ts_, query.limit_)
+                                      : query.from_ts_;
+        std::vector<domain::Quote> quotes;
+        readRange(symbol, FROM, query.to_ts_, query.limit_, query.fields_,
+                  [&](const domain::Quote& q) { quotes.push_back(q); });
 
         if (logger_) {
             logger_->info("Loaded " + std::to_string(quotes.size()) +
@@ -117,13 +606,184 @@ namespace qga::persistence {
         return quotes;
     }
 
-    void SQLiteStore::saveBarSeries(const qga::domain::backtest::BarSeries& /*series*/) {
-        // TODO: implement with CREATE TABLE bars(...) + INSERT loop
-        throw std::runtime_error("saveBarSeries not implemented yet");
+    class SQLiteStore::QuoteCursor final : public domain::backtest::IBarSource {
+    public:
+        QuoteCursor(SQLiteStore& store, std::string symbol, const QuoteQuery& query)
+            : store_(store), symbol_(std::move(symbol)), query_(query),
+              remaining_(query.limit_ > 0 ? query.limit_ : std::numeric_limits<std::size_t>::max()) {
+            next_ts_ = query.last_ && query.limit_ > 0
+                           ? store_.lastRangeStart(symbol_, query.from_ts_, query.to_ts_, query.limit_)
+                           : query.from_ts_;
+        }
+
+        bool next(domain::backtest::BarSeries& batch, std::size_t max_bars) override {
+            batch.clear();
+            if (done_ || max_bars == 0) return false;
+
+            const std::size_t WANT = std::min(max_bars, remaining_);
+            const std::size_t GOT = store_.readRange(symbol_, next_ts_, query_.to_ts_, WANT, query_.fields_,
+                                                     [&](const domain::Quote& q) { batch.add(q); });
+            remaining_ -= GOT;
+            done_ = GOT < WANT || remaining_ == 0;
+            if (GOT > 0) next_ts_ = batch.timestamps().back() + 1;  // below to_ts_, cannot overflow
+            return GOT > 0;
+        }
+
+    private:
+        SQLiteStore& store_;
+        std::string symbol_;
+        QuoteQuery query_;
+        std::size_t remaining_;    ///< Rows left under query_.limit_
+        std::int64_t next_ts_ = 0; ///< Lower bound of the next batch
+        bool done_ = false;
+    };
+
+    std::unique_ptr<domain::backtest::IBarSource> SQLiteStore::openQuotes(const std::string& symbol,
+                                                                         const QuoteQuery& query) {
+        return std::make_unique<QuoteCursor>(*this, symbol, query);
+    }
+
+    void SQLiteStore::writeBars(std::int64_t symbol_id, const std::string& timeframe,
+                                const qga::domain::backtest::BarSeries& series) {
+        const std::int64_t SPAN = chunkSpanMs(timeframe);
+        const auto& COLS = series.columns();
+        qga::domain::backtest::BarSeries merged;
+
+        for (std::size_t first = 0; first < COLS.size();) {
+            const std::int64_t START = chunkStart(COLS.ts_[first], SPAN);
+            std::size_t last = first + 1;
+            while (last < COLS.size() && chunkStart(COLS.ts_[last], SPAN) == START) ++last;
+            domain::BarColumns bars = COLS.slice(first, last - first);
+
+            {
+                auto sel = statements_.acquire(
+                    "SELECT data FROM bar_chunks WHERE symbol_id = ?1 AND timeframe = ?2 AND chunk_start = ?3;");
+                sel->bindInt64(1, symbol_id);
+                sel->bindText(2, timeframe);
+                sel->bindInt64(3, START);
+                if (sel->stepRow()) {
+                    qga::domain::backtest::BarSeries stored;
+                    decodeBarChunk(sel->getColumnBlob(0), stored);
+                    mergeBars(stored.columns(), bars, merged);
+                    bars = merged.columns();
+                }
+            }
+
+            const auto BLOB = encodeBarChunk(bars);
+            auto up = statements_.acquire(
+                "INSERT INTO bar_chunks (symbol_id, timeframe, chunk_start, bar_count, first_ts, last_ts, data)"
+                " VALUES (?1, ?2, ?3, ?4, ?5, ?6, ?7)"
+                " ON CONFLICT(symbol_id, timeframe, chunk_start) DO UPDATE SET"
+                " bar_count = excluded.bar_count, first_ts = excluded.first_ts,"
+                " last_ts = excluded.last_ts, data = excluded.data;");
+            up->bindInt64(1, symbol_id);
+            up->bindText(2, timeframe);
+            up->bindInt64(3, START);
+            up->bindInt64(4, static_cast<sqlite3_int64>(bars.size()));
+            up->bindInt64(5, bars.ts_.front());
+            up->bindInt64(6, bars.ts_.back());
+            up->bindBlob(7, BLOB);
+            if (!up->stepDone()) {
+                throw std::runtime_error("Failed to write bar chunk");
+            }
+            first = last;
+        }
+    }
+
+    void SQLiteStore::saveBarSeries(const std::string& symbol, const std::string& timeframe,
+                                    const qga::domain::backtest::BarSeries& series) {
+        if (!db_) throw std::runtime_error("Database not open");
+        chunkSpanMs(timeframe);  // validate before touching the database
+        const auto TS = series.timestamps();
+        for (std::size_t i = 1; i < TS.size(); ++i) {
+            if (TS[i] <= TS[i - 1]) {
+                throw std::invalid_argument("saveBarSeries: timestamps must be strictly increasing");
+            }
+        }
+        if (series.empty()) return;
+
+        std::lock_guard lock(write_mtx_);
+        if (bulk_) {
+            try {
+                writeBars(symbolId(symbol), timeframe, series);
+            } catch (...) {
+                if (logger_) {
+                    logger_->error("saveBarSeries failed during bulk load, rolling back: " + symbol);
+                }
+                abortBulkLoad();
+                throw;
+            }
+            return;
+        }
+
+        beginWrite();
+        try {
+            writeBars(symbolId(symbol), timeframe, series);
+
+            commitWrite();
+            if (logger_) {
+                logger_->info("Saved " + std::to_string(series.size()) + " " + timeframe +
+                              " bars for symbol: " + symbol);
+            }
+        } catch (...) {
+            rollbackWrite();
+            if (logger_) {
+                logger_->error("saveBarSeries rollback for " + symbol);
+            }
+            throw;
+        }
     }
 
-    qga::domain::backtest::BarSeries SQLiteStore::loadBarSeries(const std::string& /*symbol*/) {
-        throw std::runtime_error("loadBarSeries not implemented yet");
+    qga::domain::backtest::BarSeries SQLiteStore::loadBarSeries(const std::string& symbol,
+                                                                const std::string& timeframe,
+                                                                const QuoteQuery& query) {
+        const std::int64_t SPAN = chunkSpanMs(timeframe);
+        const bool TAIL = query.last_ && query.limit_ > 0;
+        qga::domain::backtest::BarSeries out;
+
+        withReader([&](StatementCache& cache) {
+            auto sel = cache.acquire(std::string(
+                "SELECT data FROM bar_chunks"
+                " WHERE symbol_id = (SELECT id FROM symbols WHERE name = ?1) AND timeframe = ?2"
+                " AND chunk_start >= ?3 AND chunk_start < ?4 ORDER BY chunk_start ") +
+                (TAIL ? "DESC;" : "ASC;"));
+            sel->bindText(1, symbol);
+            sel->bindText(2, timeframe);
+            sel->bindInt64(3, chunkStart(query.from_ts_, SPAN));
+            sel->bindInt64(4, query.to_ts_);
+
+            if (!TAIL) {
+                while (sel->stepRow()) {
+                    decodeBarChunk(sel->getColumnBlob(0), out, query.fields_, query.from_ts_, query.to_ts_);
+                    if (query.limit_ > 0 && out.size() >= query.limit_) break;
+                }
+                if (query.limit_ > 0 && out.size() > query.limit_) out.resize(query.limit_);
+                return;
+            }
+
+            // Latest bars: walk chunks backwards until the limit is covered.
+            std::vector<qga::domain::backtest::BarSeries> parts;  // newest first
+            std::size_t total = 0;
+            while (total < query.limit_ && sel->stepRow()) {
+                parts.emplace_back();
+                total += decodeBarChunk(sel->getColumnBlob(0), parts.back(), query.fields_, query.from_ts_,
+                                        query.to_ts_);
+            }
+            std::size_t skip = total > query.limit_ ? total - query.limit_ : 0;
+            out.reserve(total - skip);
+            for (auto it = parts.rbegin(); it != parts.rend(); ++it) {
+                const auto& cols = it->columns();
+                const std::size_t S = std::min(skip, cols.size());
+                skip -= S;
+                out.append(cols.slice(S, cols.size() - S));
+            }
+        });
+
+        if (logger_) {
+            logger_->info("Loaded " + std::to_string(out.size()) + " " + timeframe +
+                          " bars for symbol: " + symbol);
+        }
+        return out;
     }
 
     void SQLiteStore::savePortfolio(const qga::domain::backtest::Portfolio& /*portfolio*/) {
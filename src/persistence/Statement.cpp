@@ -60,6 +60,12 @@ namespace qga::persistence {
         }
     }
 
+    void Statement::bindBlob(int index, std::span<const std::uint8_t> value) {
+        if (sqlite3_bind_blob64(statement_, index, value.data(), value.size(), SQLITE_STATIC) != SQLITE_OK) {
+            throw std::runtime_error("Failed to bind blob parameter");
+        }
+    }
+
     void Statement::bindNull(int index) {
         if (sqlite3_bind_null(statement_, index) != SQLITE_OK) {
             throw std::runtime_error("Failed to bind null parameter");
@@ -107,6 +113,13 @@ namespace qga::persistence {
         return p ? p : "";
     }
 
+    std::span<const std::uint8_t> Statement::getColumnBlob(int col) const {
+        const auto* p = static_cast<const std::uint8_t*>(sqlite3_column_blob(statement_, col));
+        const int n = sqlite3_column_bytes(statement_, col);  // after the pointer, as SQLite requires
+        return p ? std::span<const std::uint8_t>(p, static_cast<std::size_t>(n))
+                 : std::span<const std::uint8_t>{};
+    }
+
     void Statement::reset() {
         if (sqlite3_reset(statement_) != SQLITE_OK) {
             throw std::runtime_error("Failed to reset statement");
@@ -116,6 +129,13 @@ namespace qga::persistence {
         }
     }
 
+    void Statement::release() noexcept {
+        if (statement_) {
+            sqlite3_reset(statement_);  // returns the last step's error, resets anyway
+            sqlite3_clear_bindings(statement_);
+        }
+    }
+
     void Statement::execDdl(sqlite3* database, const char* sql) {
         char* err_msg = nullptr;
         if (sqlite3_exec(database, sql, nullptr, nullptr, &err_msg) != SQLITE_OK) {
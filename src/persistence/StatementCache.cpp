@@ -0,0 +1,14 @@
+#include "persistence/StatementCache.hpp"
+
+namespace qga::persistence {
+
+    StatementCache::Lease StatementCache::acquire(const std::string& sql) {
+        auto it = statements_.find(sql);
+        if (it == statements_.end()) {
+            auto statement = std::make_unique<Statement>(db_, sql.c_str());
+            it = statements_.emplace(sql, std::move(statement)).first;
+        }
+        return Lease(*it->second);
+    }
+
+} // namespace qga::persistence
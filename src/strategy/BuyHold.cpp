@@ -1,5 +1,5 @@
 #include "strategy/BuyHold.hpp"
-
+#include <algorithm>
 
 namespace qga::strategy {
 
@@ -13,6 +13,19 @@ namespace qga::strategy {
     return Signal::None;
   }
 
+  void BuyHold::onBars(const domain::BarColumns& bars, std::span<Signal> out) {
+    std::fill(out.begin(), out.begin() + static_cast<std::ptrdiff_t>(bars.size()), Signal::None);
+    if (!has_bought_ && bars.size() > 0) {
+      has_bought_ = true;
+      out[0] = Signal::Buy;
+    }
+  }
+
   void BuyHold::onFinish() {}
 
+  void BuyHold::signals(const domain::BarColumns&, std::span<Signal> out) {
+    std::fill(out.begin(), out.end(), Signal::None);
+    if (!out.empty()) out[0] = Signal::Buy;
+  }
+
 } // namespace qga::strategy
@@ -0,0 +1,104 @@
+#include "strategy/IndicatorGraph.hpp"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+namespace qga::strategy {
+
+  namespace {
+
+    std::span<const double> fieldColumn(const domain::BarColumns& bars, BarField f) {
+      switch (f) {
+        case BarField::Open:   return bars.open_;
+        case BarField::High:   return bars.high_;
+        case BarField::Low:    return bars.low_;
+        case BarField::Volume: return bars.volume_;
+        case BarField::Close:  break;
+      }
+      return bars.close_;
+    }
+
+    /// Runs a single-input indicator over one block.
+    template <typename Ind>
+    void apply(Ind& ind, std::span<const double> in, double* out) {
+      for (std::size_t i = 0; i < in.size(); ++i) out[i] = ind.update(in[i]);
+    }
+
+  } // namespace
+
+  template <typename State>
+  IndicatorGraph::NodeId IndicatorGraph::intern(Kind kind, std::size_t param, NodeId input, State state) {
+    ++requests_;
+    if (kind != Kind::Field && kind != Kind::Atr && input >= nodes_.size())
+      throw std::out_of_range("IndicatorGraph: unknown input node");
+
+    const auto KEY = std::make_tuple(kind, param, input);
+    if (const auto IT = index_.find(KEY); IT != index_.end()) return IT->second;
+
+    const auto ID = static_cast<NodeId>(nodes_.size());
+    nodes_.push_back(Node{kind, input, std::move(state)});
+    columns_.emplace_back();
+    index_.emplace(KEY, ID);
+    return ID;
+  }
+
+  IndicatorGraph::NodeId IndicatorGraph::field(BarField f) {
+    return intern(Kind::Field, static_cast<std::size_t>(f), 0, f);
+  }
+
+  IndicatorGraph::NodeId IndicatorGraph::sma(std::size_t period, NodeId input) {
+    return intern(Kind::Sma, period, input, Sma(period));
+  }
+
+  IndicatorGraph::NodeId IndicatorGraph::ema(std::size_t period, NodeId input) {
+    return intern(Kind::Ema, period, input, Ema(period));
+  }
+
+  IndicatorGraph::NodeId IndicatorGraph::rsi(std::size_t period, NodeId input) {
+    return intern(Kind::Rsi, period, input, Rsi(period));
+  }
+
+  IndicatorGraph::NodeId IndicatorGraph::atr(std::size_t period) {
+    return intern(Kind::Atr, period, 0, Atr(period));
+  }
+
+  void IndicatorGraph::reset() noexcept {
+    for (auto& node : nodes_) {
+      std::visit([](auto& s) {
+        if constexpr (!std::is_same_v<std::decay_t<decltype(s)>, BarField>) s.reset();
+      }, node.state_);
+    }
+  }
+
+  void IndicatorGraph::update(const domain::BarColumns& bars) {
+    const std::size_t N = bars.size();
+    if (N > capacity_ || values_.size() < nodes_.size() * capacity_) {
+      capacity_ = std::max(capacity_, N);
+      values_.assign(nodes_.size() * capacity_, std::numeric_limits<double>::quiet_NaN());
+    }
+
+    // Node-major: each indicator streams the whole block in a tight loop; its
+    // input column is complete because inputs precede their consumers.
+    for (std::size_t id = 0; id < nodes_.size(); ++id) {
+      Node& node  = nodes_[id];
+      double* out = values_.data() + id * capacity_;
+
+      switch (node.kind_) {
+        case Kind::Field:
+          columns_[id] = fieldColumn(bars, std::get<BarField>(node.state_));
+          continue;
+        case Kind::Sma: apply(std::get<Sma>(node.state_), columns_[node.input_], out); break;
+        case Kind::Ema: apply(std::get<Ema>(node.state_), columns_[node.input_], out); break;
+        case Kind::Rsi: apply(std::get<Rsi>(node.state_), columns_[node.input_], out); break;
+        case Kind::Atr: {
+          auto& atr = std::get<Atr>(node.state_);
+          for (std::size_t i = 0; i < N; ++i) out[i] = atr.update(bars.high_[i], bars.low_[i], bars.close_[i]);
+          break;
+        }
+      }
+      columns_[id] = std::span<const double>(out, N);
+    }
+  }
+
+} // namespace qga::strategy
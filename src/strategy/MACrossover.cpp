@@ -1,53 +1,63 @@
 #include "strategy/MACrossover.hpp"
-#include <limits>
-#include <cmath>
+#include <algorithm>
 
 namespace qga::strategy {
 
-  static double updateWindow(std::deque<double>& w, double& sum, int win, double px) {
-    w.push_back(px);
-    sum += px;
-    if ((int)w.size() > win) { sum -= w.front(); w.pop_front(); }
-    if ((int)w.size() == win) return sum / win;
-    return std::numeric_limits<double>::quiet_NaN();
-  }
-
   qga::strategy::MACrossover::MACrossover(int fast, int slow)
-    : fast_period_(fast), slow_period_(slow) {}
+    : fast_(static_cast<std::size_t>(std::max(fast, 0))),   // period <= 0: never ready
+      slow_(static_cast<std::size_t>(std::max(slow, 0))) {}
 
   void MACrossover::MACrossover::onStart() {
-    w_fast_.clear(); w_slow_.clear();
-    sum_fast_ = sum_slow_ = 0.0;
-    prev_fast_ = prev_slow_ = 0.0;
-    ready_ = false;
+    fast_.clear(); slow_.clear();
+    state_ = CrossState{};
   }
 
   qga::strategy::Signal MACrossover::onBar(const domain::Quote& q) {
-    const double CLOSE = q.close_;
-
-    const double SMA_F = updateWindow(w_fast_, sum_fast_, fast_period_, CLOSE);
-    const double SMA_S = updateWindow(w_slow_, sum_slow_, slow_period_, CLOSE);
-
-    if (!std::isfinite(SMA_F) || !std::isfinite(SMA_S)) return Signal::None;
-
-    if (!ready_) {
-      ready_ = true;
-      prev_fast_ = SMA_F;
-      prev_slow_ = SMA_S;
-      return Signal::None;
-    }
+    return step(q.close_);
+  }
 
-    const bool CROSS_UP   = (prev_fast_ <= prev_slow_) && (SMA_F >  SMA_S);
-    const bool CROSS_DOWN = (prev_fast_ >= prev_slow_) && (SMA_F <  SMA_S);
+  void MACrossover::onBars(const domain::BarColumns& bars, std::span<Signal> out) {
+    const auto CLOSE = bars.close_;
+    for (std::size_t i = 0; i < CLOSE.size(); ++i) out[i] = step(CLOSE[i]);
+  }
 
-    prev_fast_ = SMA_F;
-    prev_slow_ = SMA_S;
+  void MACrossover::subscribe(IndicatorGraph& graph) {
+    fast_id_ = graph.sma(fast_.window());
+    slow_id_ = graph.sma(slow_.window());
+  }
 
-    if (CROSS_UP)   return Signal::Buy;
-    if (CROSS_DOWN) return Signal::Sell;
-    return Signal::None;
+  void MACrossover::onBars(const IndicatorGraph& graph, const domain::BarColumns& bars,
+                           std::span<Signal> out) {
+    const auto FAST = graph.column(fast_id_);
+    const auto SLOW = graph.column(slow_id_);
+    for (std::size_t i = 0; i < bars.size(); ++i) out[i] = state_.update(FAST[i], SLOW[i]);
   }
 
   void MACrossover::onFinish() {}
 
+  void MACrossover::signals(const domain::BarColumns& cols, std::span<Signal> out) {
+    const auto CLOSE = cols.close_;
+    const std::size_t N = std::min(CLOSE.size(), out.size());
+    std::fill(out.begin(), out.end(), Signal::None);
+
+    // Same windows as step() without the ring buffers: the value leaving a
+    // window is read back from the close column and the sums get the same
+    // compensated updates, so every SMA is bit-identical to the streaming path.
+    const std::size_t FAST = fast_.window();
+    const std::size_t SLOW = slow_.window();
+    if (FAST == 0 || SLOW == 0) return;  // step() never fills these windows either
+    const std::size_t WARMUP = std::max(FAST, SLOW) - 1;
+
+    CompensatedSum<double> sum_fast, sum_slow;
+    CrossState state;
+    for (std::size_t i = 0; i < N; ++i) {
+      const double C = CLOSE[i];
+      if (i < FAST) sum_fast.add(C); else sum_fast.replace(C, CLOSE[i - FAST]);
+      if (i < SLOW) sum_slow.add(C); else sum_slow.replace(C, CLOSE[i - SLOW]);
+      if (i < WARMUP) continue;
+      out[i] = state.update(sum_fast.sum() / static_cast<double>(FAST),
+                            sum_slow.sum() / static_cast<double>(SLOW));
+    }
+  }
+
 } // namespace qga::strategy
@@ -19,6 +19,14 @@ namespace qga::tests::fixtures
         /// @brief Registers a file or directory to be deleted after the test finishes.
         void trackFile(const std::string& filepath) { filesToCleanUp.push_back(filepath); }
 
+        /// @brief Path of @p name in the system temp directory, deleted after the test.
+        std::string tempPath(const std::string& name)
+        {
+            auto path = (std::filesystem::temp_directory_path() / name).string();
+            trackFile(path);
+            return path;
+        }
+
         /// @brief Automatically called by GTest after the test body finishes (even if it fails).
         void TearDown() override
         {
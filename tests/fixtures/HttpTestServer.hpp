@@ -8,6 +8,18 @@ class TestHttpServer
 {
     pid_t pid_ = -1;
 
+    TestHttpServer(int port, const std::string& directory, const std::string& script)
+    {
+        pid_ = fork();
+        if (pid_ == 0)
+        {
+            execlp("python3", "python3", script.c_str(), std::to_string(port).c_str(),
+                   directory.c_str(), nullptr);
+            std::exit(1); // If exec fails
+        }
+        sleep(1); // allow server to start
+    }
+
   public:
     TestHttpServer(int port, const std::string& directory)
     {
@@ -21,6 +33,17 @@ class TestHttpServer
         sleep(1); // allow server to start
     }
 
+    /// Serves @p directory through fixtures/gzip_http_server.py (gzip when accepted).
+    static TestHttpServer gzip(int port, const std::string& directory, const std::string& fixtures_dir)
+    {
+        return TestHttpServer(port, directory, fixtures_dir + "/gzip_http_server.py");
+    }
+
+    TestHttpServer(TestHttpServer&& other) noexcept : pid_(other.pid_) { other.pid_ = -1; }
+    TestHttpServer(const TestHttpServer&) = delete;
+    TestHttpServer& operator=(const TestHttpServer&) = delete;
+    TestHttpServer& operator=(TestHttpServer&&) = delete;
+
     ~TestHttpServer()
     {
         if (pid_ > 0)
@@ -0,0 +1,55 @@
+"""Static file server that gzip-encodes responses when the client accepts it.
+
+Usage: python3 gzip_http_server.py <port> <directory>
+
+Stand-in for vendor endpoints that serve compressed CSV. Bodies are sent in
+small chunks so clients see rows split across network reads. Paths containing
+"flaky" answer 503 to their first request, to exercise client retries.
+"""
+import gzip
+import http.server
+import os
+import sys
+import threading
+
+_seen_flaky = set()
+_seen_lock = threading.Lock()
+
+class GzipHandler(http.server.SimpleHTTPRequestHandler):
+    protocol_version = "HTTP/1.1"  # keep-alive, so clients can reuse connections
+
+    def do_GET(self):
+        if "flaky" in self.path:
+            with _seen_lock:
+                first = self.path not in _seen_flaky
+                _seen_flaky.add(self.path)
+            if first:
+                self.send_error(503, "Try again")
+                return
+        path = self.translate_path(self.path)
+        if not os.path.isfile(path):
+            self.send_error(404, "File not found")
+            return
+        with open(path, "rb") as f:
+            body = f.read()
+        encoded = "gzip" in self.headers.get("Accept-Encoding", "")
+        if encoded:
+            body = gzip.compress(body)
+        self.send_response(200)
+        self.send_header("Content-Type", "text/csv")
+        if encoded:
+            self.send_header("Content-Encoding", "gzip")
+        self.send_header("Content-Length", str(len(body)))
+        self.end_headers()
+        for i in range(0, len(body), 4096):
+            self.wfile.write(body[i:i + 4096])
+            self.wfile.flush()
+
+    def log_message(self, *args):
+        pass
+
+
+if __name__ == "__main__":
+    port, directory = int(sys.argv[1]), sys.argv[2]
+    handler = lambda *a, **kw: GzipHandler(*a, directory=directory, **kw)
+    http.server.ThreadingHTTPServer(("", port), handler).serve_forever()
@@ -0,0 +1,48 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include "fixtures/HttpTestServer.hpp"
+#include "ingest/BarSources.hpp"
+
+using qga::domain::backtest::BarSeries;
+using qga::ingest::HttpBarSource;
+
+TEST(HttpBarSourceTest, StreamsLargeBodyInBoundedBatches)
+{
+    const auto dir = std::filesystem::temp_directory_path() / "qga_http_source";
+    std::filesystem::create_directories(dir);
+    {
+        std::ofstream out(dir / "bars.csv");
+        out << "timestamp,open,high,low,close,volume\n";
+        for (int i = 0; i < 50'000; ++i)
+            out << 1'700'000'000'000LL + i * 60'000LL << ",1,2,0.5," << i << ",10\n";
+    }
+
+    TestHttpServer server(8001, dir.string());
+
+    HttpBarSource src("http://localhost:8001/bars.csv");
+    BarSeries batch;
+    std::size_t total = 0;
+    std::size_t largest = 0;
+    std::int64_t last_ts = 0;
+    while (src.next(batch, 500))
+    {
+        largest = std::max(largest, batch.size());
+        ASSERT_GT(batch.front().ts_, last_ts);
+        last_ts = batch.end().ts_;
+        total += batch.size();
+    }
+
+    EXPECT_EQ(total, 50'000u);
+    EXPECT_LT(largest, 2'000u); // paused transfer: at most one network chunk past the target
+    EXPECT_EQ(src.stats().rows_bad_, 0u);
+
+    HttpBarSource missing("http://localhost:8001/nope.csv");
+    EXPECT_THROW(missing.next(batch, 500), std::runtime_error);
+
+    std::filesystem::remove_all(dir);
+}
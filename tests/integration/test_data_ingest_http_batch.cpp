@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "fixtures/HttpTestServer.hpp"
+#include "fixtures/MockLoggerCapture.hpp"
+#include "ingest/DataIngest.hpp"
+
+using namespace qga::ingest;
+using qga::tests::fixtures::MockLoggerCapture;
+
+TEST(DataIngestHttpBatchTest, FetchesUniverseConcurrentlyWithRetries)
+{
+    const auto dir = std::filesystem::temp_directory_path() / "qga_http_batch";
+    std::filesystem::create_directories(dir);
+
+    constexpr int SYMBOLS = 200;
+    std::vector<HttpSymbolRequest> requests;
+    for (int s = 0; s < SYMBOLS; ++s)
+    {
+        const std::string SYM = "SYM" + std::to_string(s);
+        std::ofstream out(dir / (SYM + ".csv"));
+        for (int i = 0; i < 100; ++i)
+            out << 1'700'000'000'000LL + i * 60'000LL << ",1,2,0.5," << s << ",10\n";
+        requests.push_back({SYM, "http://localhost:8005/" + SYM + ".csv"});
+    }
+    {
+        std::ofstream out(dir / "flaky.csv");
+        out << "1,1,1,1,42,1\n";
+    }
+    requests.push_back({"FLAKY", "http://localhost:8005/flaky.csv"});
+    requests.push_back({"GONE", "http://localhost:8005/gone.csv"});
+
+    auto server = TestHttpServer::gzip(8005, dir.string(), QGA_TEST_FIXTURES_DIR);
+
+    auto logger = std::make_shared<MockLoggerCapture>();
+    DataIngest ingest(logger);
+
+    std::map<std::string, HttpSymbolResult> results;
+    HttpBatchParams params;
+    params.max_concurrent_ = 8;
+    params.initial_backoff_ = std::chrono::milliseconds(10);
+
+    const auto LOADED = ingest.fromHttpUrls(
+        requests, [&](HttpSymbolResult&& r) { results.emplace(r.symbol_, std::move(r)); }, params);
+
+    EXPECT_EQ(LOADED, static_cast<std::size_t>(SYMBOLS + 1));
+    ASSERT_EQ(results.size(), requests.size());
+
+    ASSERT_TRUE(results["SYM123"].series_.has_value());
+    EXPECT_EQ(results["SYM123"].series_->size(), 100u);
+    EXPECT_DOUBLE_EQ(results["SYM123"].series_->at(0).close_, 123.0);
+
+    EXPECT_TRUE(results["FLAKY"].series_.has_value());
+    EXPECT_EQ(results["FLAKY"].attempts_, 2);
+
+    EXPECT_FALSE(results["GONE"].series_.has_value());
+    EXPECT_EQ(results["GONE"].error_, "HTTP 404");
+    EXPECT_EQ(results["GONE"].attempts_, 1); // 4xx is not retried
+
+    std::filesystem::remove_all(dir);
+}
@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "fixtures/HttpTestServer.hpp"
+#include "fixtures/MockLoggerCapture.hpp"
+#include "ingest/CurlHandlePool.hpp"
+#include "ingest/DataIngest.hpp"
+
+using namespace qga::ingest;
+using qga::tests::fixtures::MockLoggerCapture;
+
+namespace
+{
+    std::filesystem::path writeLargeCsv()
+    {
+        const auto dir = std::filesystem::temp_directory_path() / "qga_http_ingest";
+        std::filesystem::create_directories(dir);
+        std::ofstream out(dir / "large.csv");
+        out << "timestamp,open,high,low,close,volume\n";
+        for (int i = 0; i < 30'000; ++i)
+            out << 1'700'000'000'000LL + i * 60'000LL << ",100.25,101.5,99.75," << i << ".5,"
+                << 1000 + i << "\n";
+        return dir;
+    }
+} // namespace
+
+TEST(DataIngestHttpStreamTest, ParsesPlainBodyWhileDownloading)
+{
+    TestHttpServer server(8002, QGA_TEST_DATA_DIR);
+
+    auto logger = std::make_shared<MockLoggerCapture>();
+    DataIngest ingest(logger);
+    auto result = ingest.fromHttpUrl("http://localhost:8002/test_http.csv");
+
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(result->size(), 2u);
+    EXPECT_EQ(result->at(0).ts_, 1669900800000);
+    EXPECT_DOUBLE_EQ(result->at(1).volume_, 14500.00);
+}
+
+TEST(DataIngestHttpStreamTest, DecodesGzipAndStitchesSplitRows)
+{
+    const auto dir = writeLargeCsv();
+    auto server = TestHttpServer::gzip(8003, dir.string(), QGA_TEST_FIXTURES_DIR);
+
+    auto logger = std::make_shared<MockLoggerCapture>();
+    DataIngest ingest(logger);
+
+    // Twice: the second request reuses the pooled handle.
+    for (int round = 0; round < 2; ++round)
+    {
+        auto result = ingest.fromHttpUrl("http://localhost:8003/large.csv");
+        ASSERT_TRUE(result.has_value());
+        ASSERT_EQ(result->size(), 30'000u);
+        EXPECT_DOUBLE_EQ(result->at(12'345).close_, 12'345.5);
+        EXPECT_EQ(result->end().ts_, 1'700'000'000'000LL + 29'999 * 60'000LL);
+    }
+    EXPECT_GE(CurlHandlePool::shared().idle(), 1u);
+    EXPECT_EQ(logger->count(qga::LogLevel::Err), 0u);
+
+    std::filesystem::remove_all(dir);
+}
+
+TEST(DataIngestHttpStreamTest, HttpErrorStatusFails)
+{
+    TestHttpServer server(8004, QGA_TEST_DATA_DIR);
+
+    auto logger = std::make_shared<MockLoggerCapture>();
+    DataIngest ingest(logger);
+    EXPECT_FALSE(ingest.fromHttpUrl("http://localhost:8004/missing.csv").has_value());
+    EXPECT_TRUE(logger->contains(qga::LogLevel::Err, "HTTP 404"));
+}
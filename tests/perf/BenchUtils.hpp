@@ -0,0 +1,61 @@
+/**
+ * @file BenchUtils.hpp
+ * @brief Tiny timing helpers shared by the perf benchmarks (no external framework).
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+
+namespace qga::tests::perf
+{
+
+    /// @brief True if `--quick` was passed (small inputs, used by ctest smoke runs).
+    inline bool quickMode(int argc, char** argv)
+    {
+        for (int i = 1; i < argc; ++i)
+            if (std::strcmp(argv[i], "--quick") == 0)
+                return true;
+        return false;
+    }
+
+    /// @brief Returns the first positional numeric argument, or @p fallback.
+    inline std::size_t sizeArg(int argc, char** argv, std::size_t fallback)
+    {
+        for (int i = 1; i < argc; ++i)
+            if (argv[i][0] != '-')
+                return static_cast<std::size_t>(std::strtoull(argv[i], nullptr, 10));
+        return fallback;
+    }
+
+    /// @brief Keeps @p value alive so the optimizer cannot drop the computation.
+    template <typename T> inline void doNotOptimize(const T& value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static volatile const T* sink;
+        sink = &value;
+#endif
+    }
+
+    /// @brief Runs @p fn @p reps times and returns the best wall time in seconds.
+    template <typename Fn> double bestOf(int reps, Fn&& fn)
+    {
+        double best = std::numeric_limits<double>::max();
+        for (int r = 0; r < reps; ++r)
+        {
+            const auto t0 = std::chrono::steady_clock::now();
+            fn();
+            const auto t1 = std::chrono::steady_clock::now();
+            best = std::min(best, std::chrono::duration<double>(t1 - t0).count());
+        }
+        return best;
+    }
+
+} // namespace qga::tests::perf
@@ -0,0 +1,115 @@
+/**
+ * @file bench_bar_chunks.cpp
+ * @brief Storage size and full-history load time: row-per-bar quotes vs compressed bar chunks.
+ *
+ * The same one-minute bars (cent prices, whole volumes) are written once with
+ * saveQuotes (one row per bar) and once with saveBarSeries (one compressed
+ * BLOB per day) into separate databases. Sizes are measured after a WAL
+ * checkpoint; load time is the best of several full-history reads.
+ *
+ * Usage: bench_bar_chunks [bars] [--quick]
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "BenchUtils.hpp"
+#include "domain/Quote.hpp"
+#include "domain/backtest/BarSeries.hpp"
+#include "persistence/SQLiteStore.hpp"
+
+using qga::domain::Quote;
+using qga::domain::backtest::BarSeries;
+using qga::persistence::SQLiteStore;
+using namespace qga::tests::perf;
+
+namespace
+{
+    void removeDb(const std::string& path)
+    {
+        for (const char* suffix : {"", "-wal", "-shm", "-journal"})
+        {
+            std::error_code ec;
+            std::filesystem::remove(path + suffix, ec);
+        }
+    }
+
+    /// Random-walk minute bars with prices on a cent grid.
+    BarSeries minuteBars(std::size_t n)
+    {
+        BarSeries s;
+        s.reserve(n);
+        std::uint64_t state = 7;
+        std::int64_t cents = 10'000;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            cents += static_cast<std::int64_t>(state >> 59) - 16;
+            const std::int64_t SPREAD = static_cast<std::int64_t>((state >> 40) % 20);
+            auto px = [&](std::int64_t offset) { return static_cast<double>(cents + offset) / 100.0; };
+            s.add(Quote{1'700'000'000'000 + static_cast<std::int64_t>(i) * 60'000, px(0), px(SPREAD),
+                        px(-SPREAD), px(SPREAD / 2), static_cast<double>(100 + (state >> 32) % 5'000)});
+        }
+        return s;
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const bool QUICK = quickMode(argc, argv);
+    const std::size_t BARS = sizeArg(argc, argv, QUICK ? 5'000 : 500'000);
+    const int REPS = QUICK ? 1 : 5;
+    const auto TMP = std::filesystem::temp_directory_path();
+    const std::string ROWS_PATH = (TMP / "qga_bench_bar_rows.db").string();
+    const std::string CHUNKS_PATH = (TMP / "qga_bench_bar_chunks.db").string();
+
+    const BarSeries SERIES = minuteBars(BARS);
+    std::vector<Quote> quotes(SERIES.size());
+    for (std::size_t i = 0; i < SERIES.size(); ++i)
+        quotes[i] = SERIES[i];
+
+    removeDb(ROWS_PATH);
+    removeDb(CHUNKS_PATH);
+    {
+        SQLiteStore rows(ROWS_PATH);
+        rows.saveQuotes("SYM", quotes);
+        SQLiteStore chunks(CHUNKS_PATH);
+        chunks.saveBarSeries("SYM", "1m", SERIES);
+    }  // closing the last connection checkpoints the WAL into the main file
+
+    const auto ROWS_BYTES = std::filesystem::file_size(ROWS_PATH);
+    const auto CHUNKS_BYTES = std::filesystem::file_size(CHUNKS_PATH);
+
+    SQLiteStore rows(ROWS_PATH);
+    SQLiteStore chunks(CHUNKS_PATH);
+    std::size_t n_rows = 0, n_chunks = 0;
+    const double T_ROWS = bestOf(REPS, [&] { n_rows = rows.loadQuotes("SYM").size(); });
+    const double T_CHUNKS = bestOf(REPS, [&] { n_chunks = chunks.loadBarSeries("SYM", "1m").size(); });
+
+    std::printf("bars=%zu\n", BARS);
+    std::printf("%18s %14s %10s %12s\n", "layout", "bytes", "B/bar", "load ms");
+    std::printf("%18s %14ju %10.1f %12.2f\n", "quotes rows", static_cast<std::uintmax_t>(ROWS_BYTES),
+                static_cast<double>(ROWS_BYTES) / static_cast<double>(BARS), T_ROWS * 1e3);
+    std::printf("%18s %14ju %10.1f %12.2f\n", "bar chunks", static_cast<std::uintmax_t>(CHUNKS_BYTES),
+                static_cast<double>(CHUNKS_BYTES) / static_cast<double>(BARS), T_CHUNKS * 1e3);
+    std::printf("storage x%.1f smaller, load x%.1f faster\n",
+                static_cast<double>(ROWS_BYTES) / static_cast<double>(CHUNKS_BYTES), T_ROWS / T_CHUNKS);
+
+    const BarSeries LOADED = chunks.loadBarSeries("SYM", "1m");
+    bool ok = n_rows == BARS && n_chunks == BARS;
+    for (std::size_t i = 0; ok && i < BARS; ++i)
+        ok = LOADED[i].ts_ == SERIES[i].ts_ && LOADED[i].close_ == SERIES[i].close_ &&
+             LOADED[i].volume_ == SERIES[i].volume_;
+    removeDb(ROWS_PATH);
+    removeDb(CHUNKS_PATH);
+
+    if (!ok)
+    {
+        std::printf("MISMATCH: stored and loaded bars differ\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,116 @@
+/**
+ * @file bench_csv_parser.cpp
+ * @brief Throughput of the block-reading CsvBarParser vs. the legacy getline/stod path,
+ *        and scaling of the parallel chunked parse over thread counts.
+ *
+ * Usage: bench_csv_parser [rows] [--quick]
+ */
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "BenchUtils.hpp"
+#include "core/ThreadPool.hpp"
+#include "io/CsvBarParser.hpp"
+
+using qga::domain::Quote;
+using qga::domain::backtest::BarSeries;
+using namespace qga::tests::perf;
+
+namespace
+{
+    void writeSyntheticCsv(const std::string& path, std::size_t rows)
+    {
+        std::ofstream out(path);
+        out << "timestamp,open,high,low,close,volume\n";
+        std::int64_t ts = 1'700'000'000'000;
+        double px = 100.0;
+        char line[160];
+        for (std::size_t i = 0; i < rows; ++i, ts += 60'000)
+        {
+            px += (i % 7 < 3) ? 0.125 : -0.0625;
+            const int N = std::snprintf(line, sizeof(line), "%lld,%.4f,%.4f,%.4f,%.4f,%.2f\n",
+                                        static_cast<long long>(ts), px, px + 0.5, px - 0.5,
+                                        px + 0.25, 1000.0 + static_cast<double>(i % 97));
+            out.write(line, N);
+        }
+    }
+
+    /// The pre-parser ingest path: getline + stringstream + std::stod per field.
+    std::size_t legacyParse(const std::string& path)
+    {
+        BarSeries series;
+        std::ifstream file(path);
+        std::string line;
+        std::getline(file, line); // header
+        while (std::getline(file, line))
+        {
+            std::stringstream ss(line);
+            std::string ts, o, h, l, c, v;
+            std::getline(ss, ts, ',');
+            std::getline(ss, o, ',');
+            std::getline(ss, h, ',');
+            std::getline(ss, l, ',');
+            std::getline(ss, c, ',');
+            std::getline(ss, v, ',');
+            series.add(Quote{std::stoll(ts), std::stod(o), std::stod(h), std::stod(l),
+                             std::stod(c), std::stod(v)});
+        }
+        return series.size();
+    }
+
+    std::size_t blockParse(const std::string& path)
+    {
+        BarSeries series;
+        qga::io::parseCsvFile(path, series);
+        return series.size();
+    }
+
+    std::size_t parallelParse(const std::string& path, qga::core::ThreadPool& pool)
+    {
+        BarSeries series;
+        qga::io::parseCsvFileParallel(path, series, pool);
+        return series.size();
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const bool QUICK = quickMode(argc, argv);
+    const std::size_t ROWS = sizeArg(argc, argv, QUICK ? 20'000 : 2'000'000);
+    const int REPS = QUICK ? 1 : 3;
+
+    const auto path = (std::filesystem::temp_directory_path() / "qga_bench_csv_parser.csv").string();
+    writeSyntheticCsv(path, ROWS);
+    const double MB = static_cast<double>(std::filesystem::file_size(path)) / (1024.0 * 1024.0);
+
+    std::size_t legacy_rows = 0, block_rows = 0;
+    const double T_LEGACY = bestOf(REPS, [&] { legacy_rows = legacyParse(path); });
+    const double T_BLOCK = bestOf(REPS, [&] { block_rows = blockParse(path); });
+    doNotOptimize(legacy_rows);
+    doNotOptimize(block_rows);
+
+    std::printf("rows=%zu size=%.1f MiB\n", ROWS, MB);
+    std::printf("  legacy getline/stod : %8.3f s  %8.1f MiB/s\n", T_LEGACY, MB / T_LEGACY);
+    std::printf("  CsvBarParser        : %8.3f s  %8.1f MiB/s  (x%.1f)\n", T_BLOCK, MB / T_BLOCK,
+                T_LEGACY / T_BLOCK);
+
+    bool ok = legacy_rows == ROWS && block_rows == ROWS;
+    const unsigned HW = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned threads = 1; threads <= HW; threads *= 2)
+    {
+        qga::core::ThreadPool pool(static_cast<int>(threads));
+        std::size_t rows = 0;
+        const double T = bestOf(REPS, [&] { rows = parallelParse(path, pool); });
+        ok = ok && rows == ROWS;
+        std::printf("  parallel x%-2u        : %8.3f s  %8.1f MiB/s  (x%.1f vs block)\n", threads,
+                    T, MB / T, T_BLOCK / T);
+    }
+
+    std::filesystem::remove(path);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,93 @@
+/**
+ * @file bench_database_worker.cpp
+ * @brief Burst of small quote writes through DatabaseWorker: one commit per task vs coalesced batches.
+ *
+ * A producer enqueues many small saveQuotes tasks into a SQLiteStore-backed
+ * worker and waits for stop() to drain them. With max_batch_ = 1 every task
+ * commits its own transaction (the previous behaviour); the other rows let
+ * the worker coalesce queued writes into one write batch per run.
+ *
+ * Usage: bench_database_worker [tasks] [--quick]
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "BenchUtils.hpp"
+#include "domain/Quote.hpp"
+#include "persistence/DatabaseWorker.hpp"
+#include "persistence/SQLiteStore.hpp"
+
+using qga::domain::Quote;
+using qga::persistence::DatabaseWorker;
+using qga::persistence::DatabaseWorkerOptions;
+using qga::persistence::IDataStore;
+using qga::persistence::SQLiteStore;
+using namespace qga::tests::perf;
+
+namespace
+{
+    void removeDb(const std::string& path)
+    {
+        for (const char* suffix : {"", "-wal", "-shm", "-journal"})
+        {
+            std::error_code ec;
+            std::filesystem::remove(path + suffix, ec);
+        }
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const bool QUICK = quickMode(argc, argv);
+    const std::size_t TASKS = sizeArg(argc, argv, QUICK ? 200 : 5'000);
+    constexpr std::size_t QUOTES_PER_TASK = 10;
+    const std::string PATH = (std::filesystem::temp_directory_path() / "qga_bench_database_worker.db").string();
+
+    std::printf("tasks=%zu quotes/task=%zu\n", TASKS, QUOTES_PER_TASK);
+    std::printf("%10s %14s %8s\n", "max_batch", "tasks/s", "x");
+
+    bool ok = true;
+    double base = 0.0;
+    for (std::size_t max_batch : {1u, 16u, 256u})
+    {
+        std::size_t stored = 0;
+        const double T = bestOf(QUICK ? 1 : 3, [&] {
+            removeDb(PATH);
+            DatabaseWorkerOptions options;
+            options.max_batch_ = max_batch;
+            DatabaseWorker worker(std::make_unique<SQLiteStore>(PATH), nullptr, options);
+            for (std::size_t t = 0; t < TASKS; ++t)
+            {
+                std::vector<Quote> quotes(QUOTES_PER_TASK);
+                for (std::size_t i = 0; i < QUOTES_PER_TASK; ++i)
+                {
+                    const double PX = 100.0 + static_cast<double>(i) * 0.01;
+                    quotes[i] = Quote{static_cast<std::int64_t>(t * QUOTES_PER_TASK + i), PX, PX, PX, PX, 1.0};
+                }
+                worker.enqueue([q = std::move(quotes)](IDataStore& s) { s.saveQuotes("SYM", q); });
+            }
+            auto count = worker.submit([](IDataStore& s) { return s.loadQuotes("SYM").size(); });
+            worker.stop();
+            stored = count.get();
+        });
+        ok = ok && stored == TASKS * QUOTES_PER_TASK;
+
+        const double RATE = static_cast<double>(TASKS) / T;
+        if (max_batch == 1)
+            base = RATE;
+        std::printf("%10zu %14.1f %7.1fx\n", max_batch, RATE, RATE / base);
+    }
+    removeDb(PATH);
+
+    if (!ok)
+    {
+        std::printf("MISMATCH: not every queued write was stored\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,186 @@
+/**
+ * @file bench_engine.cpp
+ * @brief Bars/sec of the block-dispatched Engine::run loop vs. the whole-series Engine::runVectorized path,
+ *        with and without full equity/drawdown recording, onBar vs. native onBars dispatch, and
+ *        independent runs vs. Engine::runMany with indicators shared across strategies, and
+ *        the virtual path vs. the templated Engine::run<S> for plain and composite rules.
+ *
+ * Usage: bench_engine [bars] [--quick]
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+#include "BenchUtils.hpp"
+#include "domain/backtest/Engine.hpp"
+#include "strategy/BuyHold.hpp"
+#include "strategy/Combinators.hpp"
+#include "strategy/MACrossover.hpp"
+
+using qga::domain::Quote;
+using qga::domain::backtest::BacktestResult;
+using qga::domain::backtest::BarSeries;
+using qga::domain::backtest::Engine;
+using qga::domain::backtest::ExecParams;
+using qga::domain::backtest::RecordLevel;
+using namespace qga::tests::perf;
+
+namespace
+{
+    BarSeries syntheticSeries(std::size_t bars)
+    {
+        BarSeries s;
+        s.reserve(bars);
+        std::int64_t ts = 1'700'000'000'000;
+        for (std::size_t i = 0; i < bars; ++i, ts += 60'000)
+        {
+            const double PX = 100.0 + 10.0 * std::sin(static_cast<double>(i) / 50.0) +
+                              3.0 * std::sin(static_cast<double>(i) / 7.0);
+            s.add(Quote{ts, PX, PX + 0.5, PX - 0.5, PX, 1000.0});
+        }
+        return s;
+    }
+
+    /// MACrossover seen only through onBar(): the engine falls back to the per-bar adapter.
+    class PerBarCrossover : public qga::strategy::IStrategy
+    {
+      public:
+        PerBarCrossover(int fast, int slow) : inner_(fast, slow) {}
+        void onStart() override { inner_.onStart(); }
+        qga::strategy::Signal onBar(const Quote& q) override { return inner_.onBar(q); }
+
+      private:
+        qga::strategy::MACrossover inner_;
+    };
+
+    template <typename Strategy>
+    bool compare(const char* name, const Engine& engine, const BarSeries& series, int reps,
+                 Strategy bar_strat, Strategy vec_strat)
+    {
+        const Engine metrics(engine.initialEquity(), engine.execParams(), RecordLevel::Metrics);
+        const Engine full(engine.initialEquity(), engine.execParams(), RecordLevel::Full);
+        BacktestResult a, b, c, d, m;
+        // Through IStrategy&: the virtual, block-dispatched path.
+        auto& virt = static_cast<qga::strategy::IStrategy&>(bar_strat);
+        const double T_BAR = bestOf(reps, [&] { a = engine.run(series, virt); });
+        const double T_BAR_METRICS = bestOf(reps, [&] { m = metrics.run(series, virt); });
+        const double T_BAR_FULL = bestOf(reps, [&] { c = full.run(series, virt); });
+        const double T_VEC = bestOf(reps, [&] { b = engine.runVectorized(series, vec_strat); });
+        const double T_CURVE = bestOf(reps, [&] { d = full.runVectorized(series, vec_strat); });
+        doNotOptimize(a);
+        doNotOptimize(b);
+        doNotOptimize(c);
+        doNotOptimize(d);
+        doNotOptimize(m);
+
+        const double M = static_cast<double>(series.size()) / 1e6;
+        std::printf("%s\n", name);
+        std::printf("  run (onBars blocks)    : %8.4f s  %8.1f Mbars/s\n", T_BAR, M / T_BAR);
+        std::printf("  run + Metrics (online) : %8.4f s  %8.1f Mbars/s\n", T_BAR_METRICS,
+                    M / T_BAR_METRICS);
+        std::printf("  run + Full records     : %8.4f s  %8.1f Mbars/s\n", T_BAR_FULL,
+                    M / T_BAR_FULL);
+        std::printf("  runVectorized          : %8.4f s  %8.1f Mbars/s  (x%.1f)\n", T_VEC,
+                    M / T_VEC, T_BAR / T_VEC);
+        std::printf("  runVectorized + Full   : %8.4f s  %8.1f Mbars/s  (x%.1f vs run + Full)\n",
+                    T_CURVE, M / T_CURVE, T_BAR_FULL / T_CURVE);
+        return a.final_equity_ == b.final_equity_ && a.trades_executed_ == b.trades_executed_ &&
+               c.equity_curve_ == d.equity_curve_ && c.drawdown_ == d.drawdown_ &&
+               m.max_drawdown_ == c.max_drawdown_ && m.returns_.mean() == c.returns_.mean();
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const bool QUICK = quickMode(argc, argv);
+    const std::size_t BARS = sizeArg(argc, argv, QUICK ? 50'000 : 10'000'000);
+    const int REPS = QUICK ? 1 : 3;
+
+    const auto series = syntheticSeries(BARS);
+    const Engine engine(1'000'000.0, ExecParams{1.0, 1.0, 2.0});
+    std::printf("bars=%zu\n", BARS);
+
+    bool ok = compare("BuyHold", engine, series, REPS, qga::strategy::BuyHold{},
+                      qga::strategy::BuyHold{});
+    ok = compare("MACrossover(10,50)", engine, series, REPS, qga::strategy::MACrossover{10, 50},
+                 qga::strategy::MACrossover{10, 50}) && ok;
+
+    {
+        PerBarCrossover per_bar(10, 50);
+        qga::strategy::MACrossover batched(10, 50);
+        BacktestResult a, b;
+        const double T_BAR = bestOf(REPS, [&] { a = engine.run(series, per_bar); });
+        const double T_BLOCK = bestOf(REPS, [&] {
+            b = engine.run(series, static_cast<qga::strategy::IStrategy&>(batched));
+        });
+        const double M = static_cast<double>(series.size()) / 1e6;
+        std::printf("MACrossover(10,50) dispatch\n");
+        std::printf("  onBar adapter          : %8.4f s  %8.1f Mbars/s\n", T_BAR, M / T_BAR);
+        std::printf("  native onBars          : %8.4f s  %8.1f Mbars/s  (x%.1f)\n", T_BLOCK,
+                    M / T_BLOCK, T_BAR / T_BLOCK);
+        ok = ok && a.final_equity_ == b.final_equity_;
+    }
+
+    {
+        // 3 fast x 4 slow periods: 24 rolling windows when run one by one, 7 distinct SMAs shared.
+        std::vector<std::unique_ptr<qga::strategy::MACrossover>> owned;
+        std::vector<qga::strategy::IGraphStrategy*> strats;
+        for (int fast : {5, 10, 20})
+            for (int slow : {50, 100, 150, 200})
+            {
+                owned.push_back(std::make_unique<qga::strategy::MACrossover>(fast, slow));
+                strats.push_back(owned.back().get());
+            }
+
+        std::vector<BacktestResult> separate(owned.size()), shared;
+        const double T_SEP = bestOf(REPS, [&] {
+            for (std::size_t k = 0; k < owned.size(); ++k)
+                separate[k] = engine.run(series, *owned[k]);
+        });
+        const double T_SHARED = bestOf(REPS, [&] { shared = engine.runMany(series, strats); });
+        doNotOptimize(separate);
+        doNotOptimize(shared);
+
+        const double M = static_cast<double>(series.size() * owned.size()) / 1e6;
+        std::printf("%zu x MACrossover sharing indicators\n", owned.size());
+        std::printf("  independent runs       : %8.4f s  %8.1f Mbar-strategies/s\n", T_SEP, M / T_SEP);
+        std::printf("  runMany (shared graph) : %8.4f s  %8.1f Mbar-strategies/s  (x%.1f)\n", T_SHARED,
+                    M / T_SHARED, T_SEP / T_SHARED);
+        for (std::size_t k = 0; k < owned.size(); ++k)
+            ok = ok && separate[k].final_equity_ == shared[k].final_equity_;
+    }
+
+    {
+        using namespace qga::strategy;
+        const auto composite = [] {
+            return Filtered(And(MACrossover(10, 50), Not(MACrossover(50, 200))), VolumeFilter(500.0));
+        };
+        MACrossover plain_virt(10, 50), plain_static(10, 50);
+        VirtualStrategy comp_virt(composite());
+        auto comp_static = composite();
+
+        BacktestResult a, b, c, d;
+        const double T_PV = bestOf(REPS, [&] { a = engine.run(series, static_cast<IStrategy&>(plain_virt)); });
+        const double T_PS = bestOf(REPS, [&] { b = engine.run(series, plain_static); });
+        const double T_CV = bestOf(REPS, [&] { c = engine.run(series, static_cast<IStrategy&>(comp_virt)); });
+        const double T_CS = bestOf(REPS, [&] { d = engine.run(series, comp_static); });
+        doNotOptimize(a);
+        doNotOptimize(b);
+        doNotOptimize(c);
+        doNotOptimize(d);
+
+        const double M = static_cast<double>(series.size()) / 1e6;
+        std::printf("Static dispatch (Engine::run<S>)\n");
+        std::printf("  MACrossover virtual    : %8.4f s  %8.1f Mbars/s\n", T_PV, M / T_PV);
+        std::printf("  MACrossover static     : %8.4f s  %8.1f Mbars/s  (x%.1f)\n", T_PS, M / T_PS, T_PV / T_PS);
+        std::printf("  composite virtual      : %8.4f s  %8.1f Mbars/s\n", T_CV, M / T_CV);
+        std::printf("  composite static       : %8.4f s  %8.1f Mbars/s  (x%.1f)\n", T_CS, M / T_CS, T_CV / T_CS);
+        ok = ok && a.final_equity_ == b.final_equity_ && c.final_equity_ == d.final_equity_;
+    }
+
+    if (!ok)
+        std::printf("MISMATCH between engine paths\n");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,114 @@
+/**
+ * @file bench_indicators.cpp
+ * @brief Whole-series indicator kernels vs naive per-bar window loops, for every SIMD level.
+ *
+ * Usage: bench_indicators [bars] [--quick]
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <vector>
+
+#include "BenchUtils.hpp"
+#include "indicators/Indicators.hpp"
+
+namespace ind = qga::indicators;
+using namespace qga::tests::perf;
+
+namespace
+{
+    constexpr std::size_t PERIOD = 20;
+
+    // What a per-bar implementation typically does: recompute every window.
+    void naiveSma(const std::vector<double>& in, std::vector<double>& out)
+    {
+        for (std::size_t i = PERIOD - 1; i < in.size(); ++i)
+        {
+            double s = 0.0;
+            for (std::size_t j = i + 1 - PERIOD; j <= i; ++j)
+                s += in[j];
+            out[i] = s / PERIOD;
+        }
+    }
+
+    void naiveBollinger(const std::vector<double>& in, std::vector<double>& mid, std::vector<double>& up,
+                        std::vector<double>& lo)
+    {
+        for (std::size_t i = PERIOD - 1; i < in.size(); ++i)
+        {
+            double s = 0.0;
+            for (std::size_t j = i + 1 - PERIOD; j <= i; ++j)
+                s += in[j];
+            const double m = s / PERIOD;
+            double v = 0.0;
+            for (std::size_t j = i + 1 - PERIOD; j <= i; ++j)
+                v += (in[j] - m) * (in[j] - m);
+            const double w = 2.0 * std::sqrt(v / PERIOD);
+            mid[i] = m;
+            up[i] = m + w;
+            lo[i] = m - w;
+        }
+    }
+
+    void naiveMax(const std::vector<double>& in, std::vector<double>& out)
+    {
+        for (std::size_t i = PERIOD - 1; i < in.size(); ++i)
+            out[i] = *std::max_element(in.begin() + static_cast<std::ptrdiff_t>(i + 1 - PERIOD),
+                                       in.begin() + static_cast<std::ptrdiff_t>(i + 1));
+    }
+
+    void report(const char* name, const char* level, double t, double n)
+    {
+        std::printf("  %-10s %-7s : %8.2f ms  %8.1f Mbars/s\n", name, level, t * 1e3, n / t / 1e6);
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const bool QUICK = quickMode(argc, argv);
+    const std::size_t BARS = sizeArg(argc, argv, QUICK ? 100'000 : 10'000'000);
+    const int REPS = QUICK ? 1 : 5;
+    const double N = static_cast<double>(BARS);
+
+    std::vector<double> close(BARS), high(BARS), low(BARS);
+    double px = 100.0;
+    for (std::size_t i = 0; i < BARS; ++i)
+    {
+        px += std::sin(static_cast<double>(i) * 0.37) * 0.5;
+        close[i] = px;
+        high[i] = px + 0.4;
+        low[i] = px - 0.4;
+    }
+    std::vector<double> a(BARS), b(BARS), c(BARS);
+
+    std::printf("bars=%zu period=%zu detected=%s\n", BARS, PERIOD, ind::toString(ind::detectSimdLevel()));
+
+    report("sma", "naive", bestOf(REPS, [&] { naiveSma(close, a); }), N);
+    report("bollinger", "naive", bestOf(REPS, [&] { naiveBollinger(close, a, b, c); }), N);
+    report("rollMax", "naive", bestOf(REPS, [&] { naiveMax(close, a); }), N);
+    doNotOptimize(a);
+
+    std::vector<ind::SimdLevel> levels{ind::SimdLevel::Scalar};
+    if (ind::detectSimdLevel() >= ind::SimdLevel::AVX2)
+        levels.push_back(ind::SimdLevel::AVX2);
+    if (ind::detectSimdLevel() >= ind::SimdLevel::AVX512)
+        levels.push_back(ind::SimdLevel::AVX512);
+
+    for (auto level : levels)
+    {
+        ind::setSimdLevel(level);
+        const char* L = ind::toString(level);
+        report("sma", L, bestOf(REPS, [&] { ind::sma(close, PERIOD, a); }), N);
+        report("bollinger", L, bestOf(REPS, [&] { ind::bollinger(close, PERIOD, 2.0, a, b, c); }), N);
+        report("rsi", L, bestOf(REPS, [&] { ind::rsi(close, PERIOD, a); }), N);
+        report("atr", L, bestOf(REPS, [&] { ind::atr(high, low, close, PERIOD, a); }), N);
+        doNotOptimize(a);
+    }
+    report("ema", "-", bestOf(REPS, [&] { ind::ema(close, PERIOD, a); }), N);
+    report("rollMax", "-", bestOf(REPS, [&] { ind::rollingMax(close, PERIOD, a); }), N);
+    doNotOptimize(a);
+    ind::setSimdLevel(ind::detectSimdLevel());
+    return 0;
+}
@@ -0,0 +1,78 @@
+/**
+ * @file bench_portfolio_engine.cpp
+ * @brief Events/sec of the multi-instrument PortfolioEngine (k-way merge, one MACrossover per name).
+ *
+ * Usage: bench_portfolio_engine [bars_per_instrument] [--quick]
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "BenchUtils.hpp"
+#include "domain/backtest/PortfolioEngine.hpp"
+#include "strategy/MACrossover.hpp"
+
+using qga::domain::AssetClass;
+using qga::domain::Instrument;
+using qga::domain::Quote;
+using namespace qga::domain::backtest;
+using namespace qga::tests::perf;
+
+namespace
+{
+    BarSeries syntheticSeries(std::size_t bars, double phase)
+    {
+        BarSeries s;
+        s.reserve(bars);
+        std::int64_t ts = 1'700'000'000'000;
+        for (std::size_t i = 0; i < bars; ++i, ts += 60'000)
+        {
+            const double PX = 100.0 + 10.0 * std::sin(static_cast<double>(i) / 40.0 + phase);
+            s.add(Quote{ts, PX, PX, PX, PX, 1000.0});
+        }
+        return s;
+    }
+
+    PerInstrumentStrategy crossovers(std::size_t n)
+    {
+        std::vector<std::unique_ptr<qga::strategy::IStrategy>> per;
+        for (std::size_t i = 0; i < n; ++i)
+            per.push_back(std::make_unique<qga::strategy::MACrossover>(10, 30));
+        return PerInstrumentStrategy(std::move(per), 10.0);
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const bool QUICK = quickMode(argc, argv);
+    const std::size_t INSTRUMENTS = QUICK ? 20 : 500;
+    const std::size_t BARS = sizeArg(argc, argv, QUICK ? 2'000 : 20'000);
+    const int REPS = QUICK ? 1 : 3;
+
+    std::vector<BarSeries> series;
+    std::vector<InstrumentFeed> feeds;
+    series.reserve(INSTRUMENTS);
+    for (std::size_t i = 0; i < INSTRUMENTS; ++i)
+        series.push_back(syntheticSeries(BARS, static_cast<double>(i) * 0.1));
+    for (std::size_t i = 0; i < INSTRUMENTS; ++i)
+        feeds.push_back({Instrument{"S" + std::to_string(i), AssetClass::Equity, "XNAS"}, &series[i]});
+
+    CloseExecution exec(ExecParams{1.0, 1.0, 2.0});
+    const PortfolioEngine engine(10'000'000.0, exec);
+
+    BacktestResult r;
+    const double T = bestOf(REPS, [&] {
+        auto strat = crossovers(INSTRUMENTS);
+        r = engine.run(feeds, strat);
+    });
+    doNotOptimize(r);
+
+    const double EVENTS = static_cast<double>(INSTRUMENTS * BARS);
+    std::printf("instruments=%zu bars/instrument=%zu events=%.0f\n", INSTRUMENTS, BARS, EVENTS);
+    std::printf("  PortfolioEngine : %8.3f s  %8.2f Mevents/s  buys=%d\n", T, EVENTS / T / 1e6,
+                r.trades_executed_);
+    return r.trades_executed_ > 0 ? 0 : 1;
+}
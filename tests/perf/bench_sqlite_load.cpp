@@ -0,0 +1,182 @@
+/**
+ * @file bench_sqlite_load.cpp
+ * @brief Quote ingest into SQLite: previous row-by-row layout vs SQLiteStore saves and bulk loads.
+ *
+ * "row-by-row" replays the previous SQLiteStore::saveQuotes: TEXT symbol
+ * column bound per row, one single-row UPSERT per quote, rollback journal
+ * and a FULLMUTEX connection. The other rows go through SQLiteStore. All
+ * variants receive the same calls (chunks of CHUNK quotes, round-robin
+ * over SYMBOLS symbols). The last two rows repeat the bulk load with the
+ * quotes of every symbol in scrambled time order, where staging them and
+ * merging in key order (BulkLoadOptions::defer_index_) pays off.
+ *
+ * Usage: bench_sqlite_load [quotes] [--quick]
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <sqlite3.h>
+
+#include "BenchUtils.hpp"
+#include "domain/Quote.hpp"
+#include "persistence/SQLiteStore.hpp"
+#include "persistence/Statement.hpp"
+
+using qga::domain::Quote;
+using qga::persistence::BulkLoadOptions;
+using qga::persistence::SQLiteStore;
+using qga::persistence::Statement;
+using namespace qga::tests::perf;
+
+namespace
+{
+    constexpr std::size_t SYMBOLS = 8;
+    constexpr std::size_t CHUNK = 1'000;
+
+    struct Call
+    {
+        std::string symbol;
+        std::vector<Quote> quotes;
+    };
+
+    std::vector<Call> makeCalls(std::size_t total, bool scrambled)
+    {
+        std::vector<Call> calls;
+        std::vector<std::int64_t> next_ts(SYMBOLS, 0);
+        for (std::size_t done = 0, k = 0; done < total; ++k)
+        {
+            const std::size_t SYM = k % SYMBOLS;
+            Call c{"SYM" + std::to_string(SYM), {}};
+            const std::size_t N = std::min(CHUNK, total - done);
+            c.quotes.reserve(N);
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                const double PX = 100.0 + static_cast<double>((done + i) % 997) * 0.01;
+                // Multiplicative scrambling keeps the timestamps of a symbol distinct.
+                const std::int64_t TS = scrambled ? static_cast<std::int64_t>(
+                                                        (static_cast<std::uint64_t>(next_ts[SYM]) * 2654435761ULL) %
+                                                        1'000'000'000'039ULL)
+                                                  : next_ts[SYM];
+                c.quotes.push_back(Quote{TS, PX, PX + 0.5, PX - 0.5, PX, 1'000.0});
+                ++next_ts[SYM];
+            }
+            done += N;
+            calls.push_back(std::move(c));
+        }
+        return calls;
+    }
+
+    void removeDb(const std::string& path)
+    {
+        for (const char* suffix : {"", "-wal", "-shm", "-journal"})
+        {
+            std::error_code ec;
+            std::filesystem::remove(path + suffix, ec);
+        }
+    }
+
+    /// Previous layout and write path, for reference.
+    void rowByRow(const std::string& path, const std::vector<Call>& calls)
+    {
+        sqlite3* db = nullptr;
+        sqlite3_open_v2(path.c_str(), &db,
+                        SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_FULLMUTEX, nullptr);
+        Statement::execDdl(db, "CREATE TABLE IF NOT EXISTS quotes(symbol TEXT NOT NULL, ts INTEGER NOT NULL,"
+                               " open REAL NOT NULL, high REAL NOT NULL, low REAL NOT NULL,"
+                               " close REAL NOT NULL, volume REAL NOT NULL, PRIMARY KEY(symbol, ts));");
+        for (const auto& c : calls)
+        {
+            Statement::execDdl(db, "BEGIN IMMEDIATE;");
+            Statement ins{db, "INSERT INTO quotes (symbol, ts, open, high, low, close, volume) "
+                              "VALUES (?, ?, ?, ?, ?, ?, ?) "
+                              "ON CONFLICT(symbol, ts) DO UPDATE SET "
+                              "open = excluded.open, high = excluded.high, "
+                              "low = excluded.low, close = excluded.close, volume = excluded.volume;"};
+            for (const auto& q : c.quotes)
+            {
+                ins.bindText(1, c.symbol);
+                ins.bindInt64(2, q.ts_);
+                ins.bindDouble(3, q.open_);
+                ins.bindDouble(4, q.high_);
+                ins.bindDouble(5, q.low_);
+                ins.bindDouble(6, q.close_);
+                ins.bindDouble(7, q.volume_);
+                ins.stepDone();
+                ins.reset();
+            }
+            Statement::execDdl(db, "COMMIT;");
+        }
+        sqlite3_close(db);
+    }
+
+    std::size_t countRows(const std::string& path, const char* table)
+    {
+        sqlite3* db = nullptr;
+        sqlite3_open_v2(path.c_str(), &db, SQLITE_OPEN_READONLY, nullptr);
+        std::size_t n = 0;
+        {
+            Statement st{db, (std::string("SELECT COUNT(*) FROM ") + table + ";").c_str()};
+            if (st.stepRow())
+                n = static_cast<std::size_t>(st.getColumnInt64(0));
+        }
+        sqlite3_close(db);
+        return n;
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const bool QUICK = quickMode(argc, argv);
+    const std::size_t TOTAL = sizeArg(argc, argv, QUICK ? 20'000 : 2'000'000);
+    const auto calls = makeCalls(TOTAL, false);
+    const auto scrambled = makeCalls(TOTAL, true);
+    const std::string PATH = (std::filesystem::temp_directory_path() / "qga_bench_sqlite_load.db").string();
+
+    std::printf("quotes=%zu symbols=%zu chunk=%zu\n", TOTAL, SYMBOLS, CHUNK);
+    bool ok = true;
+    double t_base = 0.0;
+
+    auto report = [&](const char* name, double t, const char* table) {
+        const std::size_t ROWS = countRows(PATH, table);
+        ok = ok && ROWS == TOTAL;
+        if (t_base == 0.0)
+            t_base = t;
+        std::printf("  %-28s: %8.3f s  %8.2f Mquotes/s  (x%.1f)\n", name, t,
+                    static_cast<double>(TOTAL) / t / 1e6, t_base / t);
+        removeDb(PATH);
+    };
+
+    removeDb(PATH);
+    report("row-by-row (previous)", bestOf(1, [&] { rowByRow(PATH, calls); }), "quotes");
+
+    report("saveQuotes", bestOf(1, [&] {
+               SQLiteStore store(PATH);
+               for (const auto& c : calls)
+                   store.saveQuotes(c.symbol, c.quotes);
+           }),
+           "quotes");
+
+    auto bulk = [&](const std::vector<Call>& input, bool defer) {
+        return bestOf(1, [&] {
+            SQLiteStore store(PATH);
+            store.beginBulkLoad(BulkLoadOptions{256, defer});
+            for (const auto& c : input)
+                store.saveQuotes(c.symbol, c.quotes);
+            store.endBulkLoad();
+        });
+    };
+    report("bulk load", bulk(calls, false), "quotes");
+    report("scrambled: bulk load", bulk(scrambled, false), "quotes");
+    report("scrambled: deferred index", bulk(scrambled, true), "quotes");
+
+    if (!ok)
+    {
+        std::printf("MISMATCH: not every quote was stored\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,184 @@
+/**
+ * @file bench_sqlite_read.cpp
+ * @brief Concurrent loadQuotes: one shared connection vs per-thread read connections.
+ *
+ * "shared connection" replays the previous read path: every thread queries
+ * through one FULLMUTEX connection and prepares its SELECT on every call.
+ * The SQLiteStore rows give each thread its own read-only connection with
+ * cached statements. A fixed number of loads (round-robin over SYMBOLS
+ * symbols) is split over 1, 4 and 16 threads; scaling is bounded by the
+ * cores of the machine (printed first).
+ *
+ * The window section reads the last 1% of one symbol's history: full load
+ * plus filtering (previous) vs a QuoteQuery window, close-only projection,
+ * and a cursor streaming into a BarSeries batch.
+ *
+ * Usage: bench_sqlite_read [quotes per symbol] [--quick]
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sqlite3.h>
+
+#include "BenchUtils.hpp"
+#include "domain/Quote.hpp"
+#include "domain/backtest/BarSeries.hpp"
+#include "persistence/SQLiteStore.hpp"
+#include "persistence/Statement.hpp"
+
+using qga::domain::Quote;
+using qga::domain::backtest::BarSeries;
+using qga::persistence::QuoteField;
+using qga::persistence::QuoteQuery;
+using qga::persistence::SQLiteStore;
+using qga::persistence::Statement;
+using namespace qga::tests::perf;
+
+namespace
+{
+    constexpr std::size_t SYMBOLS = 16;
+
+    void removeDb(const std::string& path)
+    {
+        for (const char* suffix : {"", "-wal", "-shm", "-journal"})
+        {
+            std::error_code ec;
+            std::filesystem::remove(path + suffix, ec);
+        }
+    }
+
+    /// Previous read path: one connection for every thread, SELECT prepared per call.
+    std::size_t sharedLoad(sqlite3* db, const std::string& symbol)
+    {
+        Statement sel{db, "SELECT ts, open, high, low, close, volume FROM quotes "
+                          "WHERE symbol_id = (SELECT id FROM symbols WHERE name = ?) "
+                          "ORDER BY ts ASC;"};
+        sel.bindText(1, symbol);
+        std::vector<Quote> quotes;
+        while (sel.stepRow())
+            quotes.push_back(Quote{sel.getColumnInt64(0), sel.getColumnDouble(1), sel.getColumnDouble(2),
+                                   sel.getColumnDouble(3), sel.getColumnDouble(4), sel.getColumnDouble(5)});
+        return quotes.size();
+    }
+
+    /// Runs @p loads calls of @p load split over @p threads threads; returns the quotes read.
+    template <typename Load> std::size_t fanOut(std::size_t threads, std::size_t loads, Load&& load)
+    {
+        std::vector<std::size_t> read(threads, 0);
+        std::vector<std::thread> pool;
+        for (std::size_t t = 0; t < threads; ++t)
+            pool.emplace_back([&, t] {
+                for (std::size_t i = t; i < loads; i += threads)
+                    read[t] += load("SYM" + std::to_string(i % SYMBOLS));
+            });
+        for (auto& th : pool)
+            th.join();
+        std::size_t total = 0;
+        for (auto n : read)
+            total += n;
+        return total;
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const bool QUICK = quickMode(argc, argv);
+    const std::size_t PER_SYMBOL = sizeArg(argc, argv, QUICK ? 500 : 50'000);
+    const std::size_t LOADS = QUICK ? 32 : 256;
+    const std::string PATH = (std::filesystem::temp_directory_path() / "qga_bench_sqlite_read.db").string();
+
+    removeDb(PATH);
+    {
+        SQLiteStore store(PATH);
+        store.beginBulkLoad();
+        std::vector<Quote> quotes(PER_SYMBOL);
+        for (std::size_t s = 0; s < SYMBOLS; ++s)
+        {
+            for (std::size_t i = 0; i < PER_SYMBOL; ++i)
+            {
+                const double PX = 100.0 + static_cast<double>((s + i) % 997) * 0.01;
+                quotes[i] = Quote{static_cast<std::int64_t>(i), PX, PX + 0.5, PX - 0.5, PX, 1'000.0};
+            }
+            store.saveQuotes("SYM" + std::to_string(s), quotes);
+        }
+        store.endBulkLoad();
+    }
+
+    std::printf("cores=%u symbols=%zu quotes/symbol=%zu loads=%zu\n", std::thread::hardware_concurrency(),
+                SYMBOLS, PER_SYMBOL, LOADS);
+    std::printf("%8s %18s %18s %8s\n", "threads", "shared loads/s", "per-thread loads/s", "x");
+
+    bool ok = true;
+    sqlite3* shared = nullptr;
+    sqlite3_open_v2(PATH.c_str(), &shared, SQLITE_OPEN_READWRITE | SQLITE_OPEN_FULLMUTEX, nullptr);
+    SQLiteStore store(PATH);
+    for (std::size_t threads : {1u, 4u, 16u})
+    {
+        std::size_t n_shared = 0, n_store = 0;
+        const double T_SHARED = bestOf(QUICK ? 1 : 3, [&] {
+            n_shared = fanOut(threads, LOADS, [&](const std::string& s) { return sharedLoad(shared, s); });
+        });
+        const double T_STORE = bestOf(QUICK ? 1 : 3, [&] {
+            n_store = fanOut(threads, LOADS, [&](const std::string& s) { return store.loadQuotes(s).size(); });
+        });
+        ok = ok && n_shared == LOADS * PER_SYMBOL && n_store == n_shared;
+
+        const double L = static_cast<double>(LOADS);
+        std::printf("%8zu %18.1f %18.1f %7.1fx\n", threads, L / T_SHARED, L / T_STORE, T_SHARED / T_STORE);
+    }
+    sqlite3_close(shared);
+
+    const std::int64_t FROM = static_cast<std::int64_t>(PER_SYMBOL - PER_SYMBOL / 100);
+    const std::size_t WINDOW = PER_SYMBOL - static_cast<std::size_t>(FROM);
+    const int REPEATS = QUICK ? 10 : 200;
+    QuoteQuery window;
+    window.from_ts_ = FROM;
+    QuoteQuery closes = window;
+    closes.fields_ = QuoteField::Close;
+
+    auto timeWindow = [&](auto&& read) {
+        std::size_t n = 0;
+        const double T = bestOf(QUICK ? 1 : 3, [&] {
+            n = 0;
+            for (int r = 0; r < REPEATS; ++r)
+                n += read();
+        });
+        ok = ok && n == WINDOW * static_cast<std::size_t>(REPEATS);
+        return T / REPEATS * 1e6;
+    };
+    const double T_FULL = timeWindow([&] {
+        std::size_t n = 0;
+        for (const auto& q : store.loadQuotes("SYM0"))
+            n += q.ts_ >= FROM;
+        return n;
+    });
+    const double T_WINDOW = timeWindow([&] { return store.loadQuotes("SYM0", window).size(); });
+    const double T_CLOSES = timeWindow([&] { return store.loadQuotes("SYM0", closes).size(); });
+    BarSeries batch;
+    const double T_CURSOR = timeWindow([&] {
+        auto cursor = store.openQuotes("SYM0", window);
+        std::size_t n = 0;
+        while (cursor->next(batch, 4'096))
+            n += batch.size();
+        return n;
+    });
+
+    std::printf("\nwindow of %zu bars out of %zu\n", WINDOW, PER_SYMBOL);
+    std::printf("  full load + filter (previous) : %10.1f us\n", T_FULL);
+    std::printf("  loadQuotes(window)            : %10.1f us  (x%.1f)\n", T_WINDOW, T_FULL / T_WINDOW);
+    std::printf("  loadQuotes(window, close)     : %10.1f us  (x%.1f)\n", T_CLOSES, T_FULL / T_CLOSES);
+    std::printf("  openQuotes -> BarSeries       : %10.1f us  (x%.1f)\n", T_CURSOR, T_FULL / T_CURSOR);
+    removeDb(PATH);
+
+    if (!ok)
+    {
+        std::printf("MISMATCH: loads returned different row counts\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,140 @@
+/**
+ * @file bench_statistics.cpp
+ * @brief Per-call cost of Statistics::sharpeRatio on small vectors, with and without logging,
+ *        and summary statistics over a large return vector.
+ *
+ * The "logged" rows replay what every success path did before diagnostics
+ * were gated behind QGA_STATS_DIAGNOSTICS: format the value with
+ * std::to_string and hand it to a logger. An asynchronous file logger is
+ * used as the sink, which is cheaper than the console sink the library used,
+ * so those rows are a lower bound of the old cost. Configuring with
+ * -DQGA_STATS_DIAGNOSTICS=ON makes the library rows log for real.
+ *
+ * The summary section compares the sequential approach (accumulate, two-pass
+ * stddev, min/max scans, copy and sort for the median) with the one-pass
+ * multi-accumulator Statistics::summarize and the nth_element median.
+ *
+ * Usage: bench_statistics [calls] [--quick]
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "BenchUtils.hpp"
+#include "common/LogLevel.hpp"
+#include "core/Statistics.hpp"
+#include "utils/LoggerFactory.hpp"
+
+using qga::core::Statistics;
+using namespace qga::tests::perf;
+
+namespace
+{
+    std::vector<double> noisyReturns(std::size_t n, std::uint64_t seed)
+    {
+        std::vector<double> out(n);
+        std::uint64_t state = seed;
+        for (auto& r : out)
+        {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            r = (static_cast<double>(state >> 11) / 9007199254740992.0 - 0.5) * 0.02;
+        }
+        return out;
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const bool QUICK = quickMode(argc, argv);
+    const std::size_t CALLS = sizeArg(argc, argv, QUICK ? 2'000 : 200'000);
+    const int REPS = QUICK ? 1 : 3;
+
+    const auto LOG_PATH = std::filesystem::temp_directory_path() / "qga_bench_statistics.log";
+    constexpr std::size_t LOG_BACKUPS = 5;
+    auto logger = qga::utils::LoggerFactory::createAsyncRotatingLogger(
+        "bench_statistics", LOG_PATH.string(), qga::LogLevel::Info, 10 * 1024 * 1024, LOG_BACKUPS);
+
+    std::printf("calls=%zu\n", CALLS);
+    std::printf("%6s %14s %14s %10s\n", "n", "sharpe ns", "logged ns", "logged/x");
+
+    for (std::size_t n : {8u, 32u, 128u})
+    {
+        const auto R = noisyReturns(n, n);
+        double sink = 0.0;
+
+        const double T_PLAIN = bestOf(REPS, [&] {
+            for (std::size_t c = 0; c < CALLS; ++c)
+                sink += Statistics::sharpeRatio(R, 0.0, 252.0);
+        });
+
+        const double T_LOGGED = bestOf(REPS, [&] {
+            for (std::size_t c = 0; c < CALLS; ++c)
+            {
+                const double SHARPE = Statistics::sharpeRatio(R, 0.0, 252.0);
+                logger->log(qga::LogLevel::Info,
+                            "[Statistics] Sharpe Ratio calculated: " + std::to_string(SHARPE));
+                sink += SHARPE;
+            }
+        });
+        doNotOptimize(sink);
+
+        const double PER = 1e9 / static_cast<double>(CALLS);
+        std::printf("%6zu %14.1f %14.1f %9.1fx\n", n, T_PLAIN * PER, T_LOGGED * PER,
+                    T_LOGGED / T_PLAIN);
+    }
+
+    const std::size_t BIG = QUICK ? 100'000 : 20'000'000;
+    const auto BIG_R = noisyReturns(BIG, 1);
+    double seq_sd = 0.0, seq_median = 0.0;
+    const double T_SEQ_MOMENTS = bestOf(REPS, [&] {
+        const double MEAN = std::accumulate(BIG_R.begin(), BIG_R.end(), 0.0) / static_cast<double>(BIG);
+        double sumsq = 0.0;
+        for (double r : BIG_R)
+            sumsq += (r - MEAN) * (r - MEAN);
+        seq_sd = std::sqrt(sumsq / static_cast<double>(BIG - 1));
+        doNotOptimize(*std::min_element(BIG_R.begin(), BIG_R.end()));
+        doNotOptimize(*std::max_element(BIG_R.begin(), BIG_R.end()));
+    });
+    const double T_SEQ_MEDIAN = bestOf(REPS, [&] {
+        auto sorted = BIG_R;
+        std::sort(sorted.begin(), sorted.end());
+        seq_median = BIG % 2 == 0 ? (sorted[BIG / 2 - 1] + sorted[BIG / 2]) / 2.0 : sorted[BIG / 2];
+    });
+
+    Statistics::Summary summary;
+    double median = 0.0;
+    const double T_SUMMARIZE = bestOf(REPS, [&] { summary = *Statistics::summarize(BIG_R); });
+    const double T_MEDIAN = bestOf(REPS, [&] { median = *Statistics::calculateMedian(BIG_R); });
+
+    std::printf("\nsummary over n=%zu\n", BIG);
+    std::printf("  mean/stddev/min/max sequential : %8.4f s\n", T_SEQ_MOMENTS);
+    std::printf("  summarize (one pass)           : %8.4f s  (x%.1f)\n", T_SUMMARIZE,
+                T_SEQ_MOMENTS / T_SUMMARIZE);
+    std::printf("  median copy + sort             : %8.4f s\n", T_SEQ_MEDIAN);
+    std::printf("  calculateMedian (nth_element)  : %8.4f s  (x%.1f)\n", T_MEDIAN,
+                T_SEQ_MEDIAN / T_MEDIAN);
+
+    logger.reset();
+    // The rotating sink leaves numbered files next to the log (up to LOG_BACKUPS).
+    std::error_code ec;
+    std::filesystem::remove(LOG_PATH, ec);
+    for (std::size_t i = 1; i <= LOG_BACKUPS; ++i)
+    {
+        auto rotated = LOG_PATH;
+        rotated.replace_extension(std::to_string(i) + ".log");
+        std::filesystem::remove(rotated, ec);
+    }
+
+    if (median != seq_median || std::abs(summary.stddev - seq_sd) > 1e-9 * seq_sd)
+    {
+        std::printf("MISMATCH between sequential and library summary\n");
+        return 1;
+    }
+    return 0;
+}
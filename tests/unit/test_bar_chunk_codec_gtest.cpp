@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "domain/backtest/BarSeries.hpp"
+#include "persistence/BarChunkCodec.hpp"
+#include "test_helpers.hpp"
+
+using qga::domain::Quote;
+using qga::domain::backtest::BarSeries;
+using qga::persistence::QuoteField;
+using qga::persistence::decodeBarChunk;
+using qga::persistence::encodeBarChunk;
+
+namespace
+{
+    /// One-minute bars with a weekend-sized gap and decimal prices.
+    BarSeries minuteBars(std::size_t n)
+    {
+        BarSeries s;
+        std::uint64_t state = 11;
+        std::int64_t cents = 10'000;
+        std::int64_t ts = 1'700'000'000'000;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            cents += static_cast<std::int64_t>(state >> 58) - 32;  // +-32 cents
+            auto px = [&](std::int64_t offset) { return static_cast<double>(cents + offset) / 100.0; };
+            s.add(Quote{ts, px(0), px(5), px(-5), px(1), static_cast<double>(100 * (i % 7))});
+            ts += i == n / 2 ? 2 * 86'400'000 : 60'000;
+        }
+        return s;
+    }
+
+    void expectBitIdentical(const BarSeries& a, const BarSeries& b)
+    {
+        ASSERT_EQ(a.size(), b.size());
+        for (std::size_t i = 0; i < a.size(); ++i)
+        {
+            const Quote X = a[i], Y = b[i];
+            EXPECT_EQ(X.ts_, Y.ts_) << i;
+            for (auto [u, v] : {std::pair{X.open_, Y.open_}, {X.high_, Y.high_}, {X.low_, Y.low_},
+                                {X.close_, Y.close_}, {X.volume_, Y.volume_}})
+                EXPECT_EQ(std::bit_cast<std::uint64_t>(u), std::bit_cast<std::uint64_t>(v)) << i;
+        }
+    }
+} // namespace
+
+TEST(BarChunkCodecTest, RoundTripsRegularBarsCompactly)
+{
+    const auto BARS = minuteBars(1'440);
+    const auto BLOB = encodeBarChunk(BARS.columns());
+
+    BarSeries out;
+    EXPECT_EQ(decodeBarChunk(BLOB, out), BARS.size());
+    expectBitIdentical(out, BARS);
+
+    // 48 raw bytes per bar; cent prices and whole volumes take the decimal mode.
+    EXPECT_LT(BLOB.size(), BARS.size() * 48 / 5);
+}
+
+TEST(BarChunkCodecTest, RoundTripsExtremeValues)
+{
+    constexpr double INF = std::numeric_limits<double>::infinity();
+    constexpr std::int64_t MIN = std::numeric_limits<std::int64_t>::min();
+    constexpr std::int64_t MAX = std::numeric_limits<std::int64_t>::max() - 1;  // windows are half-open
+    BarSeries bars;
+    bars.add(Quote{MIN, 0.0, -0.0, INF, -INF, std::numeric_limits<double>::quiet_NaN()});
+    bars.add(Quote{-5, std::numeric_limits<double>::denorm_min(), 1e308, -1e-308, 1.0, 0.0});
+    bars.add(Quote{MAX, -1.5, 2.25, 3.0, 1.0, 1.0});
+    bars.add(Quote{0, 1.0, 1.0, 1.0, 1.0, 1.0});  // unsorted is allowed
+    bars.add(Quote{1, 123.456, 0.1, 0.2, 0.3, 4e9});
+    bars.add(Quote{2, 1.0 / 3.0, 0.1 + 0.2, 1e-9, 9007199254740993.0, 0.5});  // not short decimals
+
+    BarSeries out;
+    decodeBarChunk(encodeBarChunk(bars.columns()), out);
+    expectBitIdentical(out, bars);
+
+    // Exact at one decimal, but not at the eight the second bar needs:
+    // 150000000 * 1e8 passes 2^53 and 44640302.7 * 1e8 rounds off.
+    BarSeries mixed;
+    mixed.add(Quote{0, 44640302.7, 1.0, 1.0, 1.0, 150000000.0});
+    mixed.add(Quote{1, 0.12345678, 1.0, 1.0, 1.0, 0.12345678});
+    BarSeries mixed_out;
+    decodeBarChunk(encodeBarChunk(mixed.columns()), mixed_out);
+    expectBitIdentical(mixed_out, mixed);
+
+    BarSeries empty;
+    EXPECT_EQ(decodeBarChunk(encodeBarChunk(empty.columns()), out), 0u);
+}
+
+TEST(BarChunkCodecTest, DecodesWindowAndProjectionOntoExistingBars)
+{
+    const auto BARS = minuteBars(100);
+    const auto BLOB = encodeBarChunk(BARS.columns());
+    const std::int64_t FROM = BARS[10].ts_, TO = BARS[20].ts_;
+
+    BarSeries out;
+    out.add(testlib::bar(1.0, 0));
+    EXPECT_EQ(decodeBarChunk(BLOB, out, QuoteField::Close, FROM, TO), 10u);
+    ASSERT_EQ(out.size(), 11u);
+    EXPECT_EQ(out[0].close_, 1.0);
+    for (std::size_t i = 0; i < 10; ++i)
+    {
+        EXPECT_EQ(out[i + 1].ts_, BARS[10 + i].ts_);
+        EXPECT_EQ(out[i + 1].close_, BARS[10 + i].close_);
+        EXPECT_EQ(out[i + 1].open_, 0.0);
+        EXPECT_EQ(out[i + 1].volume_, 0.0);
+    }
+}
+
+TEST(BarChunkCodecTest, RejectsDamagedChunks)
+{
+    const auto BLOB = encodeBarChunk(minuteBars(50).columns());
+    BarSeries out;
+
+    auto bad_version = BLOB;
+    bad_version[0] = 99;
+    EXPECT_THROW(decodeBarChunk(bad_version, out), std::runtime_error);
+
+    for (std::size_t cut : {std::size_t{1}, std::size_t{5}, BLOB.size() / 2, BLOB.size() - 1})
+    {
+        const std::vector<std::uint8_t> TRUNCATED(BLOB.begin(), BLOB.begin() + static_cast<std::ptrdiff_t>(cut));
+        EXPECT_THROW(decodeBarChunk(TRUNCATED, out), std::runtime_error) << cut;
+    }
+    EXPECT_THROW(decodeBarChunk({}, out), std::runtime_error);
+}
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include "fixtures/BaseTestFixture.hpp"
+#include "io/BarFile.hpp"
+#include "test_helpers.hpp"
+
+using namespace qga::io;
+using namespace qga::tests::fixtures;
+
+class BarFileTest : public BaseTestFixture {};
+
+TEST_F(BarFileTest, RoundTripMapsColumnsWithoutCopy)
+{
+    auto series = testlib::makeSeries({10.0, 11.5, 9.25, 12.0, 13.0}, 1'700'000'000'000);
+    const auto path = tempPath("qga_bar_file_roundtrip.qgab");
+
+    writeBarFile(path, "AAPL", series);
+    auto contents = mapBarFile(path, /*verify_checksum=*/true);
+
+    EXPECT_EQ(contents.symbol_, "AAPL");
+    ASSERT_EQ(contents.series_.size(), series.size());
+    EXPECT_TRUE(contents.series_.isView());
+
+    for (std::size_t i = 0; i < series.size(); ++i)
+    {
+        EXPECT_EQ(contents.series_[i].ts_, series[i].ts_);
+        EXPECT_DOUBLE_EQ(contents.series_[i].close_, series[i].close_);
+        EXPECT_DOUBLE_EQ(contents.series_[i].volume_, series[i].volume_);
+    }
+
+    // Columns point into the mapping and keep the 64-byte alignment.
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(contents.series_.closes().data()) % 64, 0u);
+    EXPECT_THROW(contents.series_.add({}), std::logic_error);
+}
+
+TEST_F(BarFileTest, ViewOutlivesOriginalContents)
+{
+    const auto path = tempPath("qga_bar_file_keepalive.qgab");
+    writeBarFile(path, "MSFT", testlib::makeSeries({1.0, 2.0, 3.0}));
+
+    qga::domain::backtest::BarSeries copy;
+    {
+        auto contents = mapBarFile(path);
+        copy = contents.series_;
+    }
+    ASSERT_EQ(copy.size(), 3u);
+    EXPECT_DOUBLE_EQ(copy.end().close_, 3.0);
+}
+
+TEST_F(BarFileTest, DetectsCorruptionAndBadMagic)
+{
+    const auto path = tempPath("qga_bar_file_corrupt.qgab");
+    writeBarFile(path, "SPY", testlib::makeSeries({1.0, 2.0, 3.0}));
+
+    {
+        std::fstream f(path, std::ios::in | std::ios::out | std::ios::binary);
+        f.seekp(sizeof(BarFileHeader) + 4);
+        f.put('\x7f');
+    }
+    EXPECT_NO_THROW(mapBarFile(path));
+    EXPECT_THROW(mapBarFile(path, /*verify_checksum=*/true), std::runtime_error);
+
+    const auto junk = tempPath("qga_bar_file_junk.qgab");
+    {
+        std::ofstream f(junk, std::ios::binary);
+        f << std::string(128, 'x');
+    }
+    EXPECT_THROW(mapBarFile(junk), std::runtime_error);
+    EXPECT_THROW(mapBarFile(tempPath("qga_bar_file_missing.qgab")), std::runtime_error);
+}
+
+TEST_F(BarFileTest, RejectsBarCountBeyondFileSize)
+{
+    const auto path = tempPath("qga_bar_file_overflow.qgab");
+    writeBarFile(path, "SPY", testlib::makeSeries({1, 2, 3, 4, 5, 6, 7, 8}));
+
+    auto patchHeader = [&](std::uint64_t bar_count, std::uint64_t stride)
+    {
+        BarFileHeader h{};
+        std::fstream f(path, std::ios::in | std::ios::out | std::ios::binary);
+        f.read(reinterpret_cast<char*>(&h), sizeof(h));
+        h.bar_count_ = bar_count;
+        h.column_stride_ = stride;
+        f.seekp(0);
+        f.write(reinterpret_cast<const char*>(&h), sizeof(h));
+    };
+
+    // 2^61 * 8 wraps to 0, so stride 0 matched the unchecked columnStride().
+    patchHeader(std::uint64_t{1} << 61, 0);
+    EXPECT_THROW(mapBarFile(path), std::runtime_error);
+    EXPECT_THROW(BarFileReader{path}, std::runtime_error);
+
+    patchHeader(9, 128);  // one bar more than the file holds
+    EXPECT_THROW(mapBarFile(path), std::runtime_error);
+
+    patchHeader(8, 64);  // the original header is still accepted
+    EXPECT_EQ(mapBarFile(path).series_.size(), 8u);
+}
+
+TEST_F(BarFileTest, RejectsOverlongSymbol)
+{
+    const auto path = tempPath("qga_bar_file_symbol.qgab");
+    EXPECT_THROW(writeBarFile(path, std::string(24, 'A'), testlib::makeSeries({1.0})),
+                 std::invalid_argument);
+}
@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <stdexcept>
+
+#include "domain/backtest/BarSeries.hpp"
+#include "test_helpers.hpp"
+
+using qga::domain::Quote;
+using qga::domain::backtest::BarSeries;
+
+namespace
+{
+    bool isCacheLineAligned(const void* p)
+    {
+        return reinterpret_cast<std::uintptr_t>(p) % qga::CACHE_LINE_SIZE == 0;
+    }
+} // namespace
+
+TEST(BarSeriesTest, RowViewMatchesAddedQuote)
+{
+    BarSeries series;
+    series.add({1, 100.0, 110.0, 90.0, 105.0, 1234.5});
+    series.add({2, 101.0, 111.0, 91.0, 106.0, 2234.5});
+
+    ASSERT_EQ(series.size(), 2u);
+    const Quote q = series.at(1);
+    EXPECT_EQ(q.ts_, 2);
+    EXPECT_DOUBLE_EQ(q.open_, 101.0);
+    EXPECT_DOUBLE_EQ(q.high_, 111.0);
+    EXPECT_DOUBLE_EQ(q.low_, 91.0);
+    EXPECT_DOUBLE_EQ(q.close_, 106.0);
+    EXPECT_DOUBLE_EQ(q.volume_, 2234.5);
+
+    EXPECT_EQ(series[0].ts_, 1);
+    EXPECT_EQ(series.front().ts_, 1);
+    EXPECT_EQ(series.end().ts_, 2);
+}
+
+TEST(BarSeriesTest, ColumnsAreContiguousAndAligned)
+{
+    auto series = testlib::makeSeries({1.0, 2.0, 3.0, 4.0});
+
+    const auto closes = series.closes();
+    ASSERT_EQ(closes.size(), 4u);
+    EXPECT_DOUBLE_EQ(closes[2], 3.0);
+    EXPECT_EQ(series.timestamps()[3], 3 * 60'000);
+
+    EXPECT_TRUE(isCacheLineAligned(series.timestamps().data()));
+    EXPECT_TRUE(isCacheLineAligned(series.opens().data()));
+    EXPECT_TRUE(isCacheLineAligned(series.highs().data()));
+    EXPECT_TRUE(isCacheLineAligned(series.lows().data()));
+    EXPECT_TRUE(isCacheLineAligned(closes.data()));
+    EXPECT_TRUE(isCacheLineAligned(series.volumes().data()));
+}
+
+TEST(BarSeriesTest, CheckedAccessThrowsOutOfRange)
+{
+    BarSeries series;
+    EXPECT_THROW(series.at(0), std::out_of_range);
+    EXPECT_THROW(series.front(), std::out_of_range);
+    EXPECT_THROW(series.end(), std::out_of_range);
+
+    series.add({1, 1.0, 1.0, 1.0, 1.0, 0.0});
+    series.clear();
+    EXPECT_TRUE(series.empty());
+    EXPECT_TRUE(series.closes().empty());
+}
+
+TEST(BarSeriesTest, CopiesOwnTheirColumns)
+{
+    auto original = testlib::makeSeries({1.0, 2.0});
+    BarSeries copy = original;
+    original.add({3, 3.0, 3.0, 3.0, 3.0, 0.0});
+
+    ASSERT_EQ(copy.size(), 2u);
+    EXPECT_NE(copy.closes().data(), original.closes().data());
+
+    BarSeries moved = std::move(original);
+    EXPECT_EQ(moved.size(), 3u);
+    EXPECT_DOUBLE_EQ(moved.end().close_, 3.0);
+}
@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "domain/backtest/BarSource.hpp"
+#include "domain/backtest/Engine.hpp"
+#include "strategy/MACrossover.hpp"
+#include "test_helpers.hpp"
+
+using namespace qga::domain::backtest;
+
+namespace
+{
+    class FailingSource : public IBarSource
+    {
+      public:
+        bool next(BarSeries& batch, std::size_t) override
+        {
+            batch.clear();
+            if (calls_++ == 0)
+            {
+                batch.add(testlib::bar(1.0, 0));
+                return true;
+            }
+            throw std::runtime_error("disk on fire");
+        }
+
+      private:
+        int calls_ = 0;
+    };
+} // namespace
+
+TEST(BarSourceTest, SeriesSourceHandsOutConsecutiveBatches)
+{
+    SeriesBarSource src(testlib::makeSeries({1, 2, 3, 4, 5}));
+    BarSeries batch;
+
+    ASSERT_TRUE(src.next(batch, 2));
+    ASSERT_EQ(batch.size(), 2u);
+    EXPECT_DOUBLE_EQ(batch[1].close_, 2.0);
+
+    ASSERT_TRUE(src.next(batch, 2));
+    ASSERT_TRUE(src.next(batch, 2));
+    ASSERT_EQ(batch.size(), 1u);
+    EXPECT_DOUBLE_EQ(batch[0].close_, 5.0);
+
+    EXPECT_FALSE(src.next(batch, 2));
+    EXPECT_TRUE(batch.empty());
+}
+
+TEST(BarSourceTest, ReadAheadPreservesOrder)
+{
+    const auto series = testlib::wavySeries(10'000);
+    ReadAheadBarSource src(std::make_unique<SeriesBarSource>(series), /*batch_bars=*/333,
+                           /*depth=*/2);
+
+    BarSeries batch;
+    std::size_t seen = 0;
+    while (src.next(batch, 0))
+    {
+        for (std::size_t i = 0; i < batch.size(); ++i, ++seen)
+            ASSERT_EQ(batch[i].ts_, series[seen].ts_);
+    }
+    EXPECT_EQ(seen, series.size());
+    EXPECT_FALSE(src.next(batch, 0));
+}
+
+TEST(BarSourceTest, ReadAheadRethrowsInnerFailure)
+{
+    ReadAheadBarSource src(std::make_unique<FailingSource>());
+    BarSeries batch;
+    ASSERT_TRUE(src.next(batch, 0));
+    EXPECT_THROW(src.next(batch, 0), std::runtime_error);
+}
+
+TEST(BarSourceTest, EngineStreamMatchesMaterializedRun)
+{
+    const auto series = testlib::wavySeries(5'000);
+    Engine engine(10'000.0, ExecParams{1.0, 5.0, 2.0});
+
+    qga::strategy::MACrossover a(5, 20);
+    const auto expected = engine.run(series, a);
+
+    qga::strategy::MACrossover b(5, 20);
+    ReadAheadBarSource src(std::make_unique<SeriesBarSource>(series), 128);
+    const auto streamed = engine.run(src, b, 128);
+
+    EXPECT_GT(expected.trades_executed_, 0);
+    EXPECT_EQ(streamed.trades_executed_, expected.trades_executed_);
+    EXPECT_DOUBLE_EQ(streamed.final_equity_, expected.final_equity_);
+}
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "fixtures/BaseTestFixture.hpp"
+#include "ingest/BarSources.hpp"
+#include "io/BarFile.hpp"
+#include "persistence/SQLiteStore.hpp"
+#include "test_helpers.hpp"
+
+using qga::domain::backtest::BarSeries;
+using qga::domain::backtest::IBarSource;
+using namespace qga::ingest;
+using namespace qga::tests::fixtures;
+
+namespace
+{
+    BarSeries drain(IBarSource& src, std::size_t batch_bars, std::size_t& batches)
+    {
+        BarSeries all;
+        BarSeries batch;
+        batches = 0;
+        while (src.next(batch, batch_bars))
+        {
+            ++batches;
+            all.append(batch.columns());
+        }
+        return all;
+    }
+} // namespace
+
+class BarSourcesTest : public BaseTestFixture {};
+
+TEST_F(BarSourcesTest, CsvSourceStreamsWholeFileInBatches)
+{
+    const auto path = tempPath("qga_bar_source.csv");
+    {
+        std::ofstream out(path);
+        out << "timestamp,open,high,low,close,volume\n";
+        for (int i = 0; i < 20'000; ++i)
+            out << 1'700'000'000'000LL + i * 60'000LL << ",1,2,0.5," << i << ",10\n";
+        out << "broken\n";
+    }
+
+    CsvFileBarSource src(path);
+    std::size_t batches = 0;
+    const auto all = drain(src, 1'000, batches);
+
+    ASSERT_EQ(all.size(), 20'000u);
+    EXPECT_GT(batches, 5u); // one 64 KiB block may overshoot a batch
+    EXPECT_DOUBLE_EQ(all[19'999].close_, 19'999.0);
+    EXPECT_EQ(src.stats().rows_bad_, 1u);
+    EXPECT_TRUE(src.stats().header_skipped_);
+
+    EXPECT_THROW(CsvFileBarSource(path + ".missing"), std::runtime_error);
+}
+
+TEST_F(BarSourcesTest, BarFileSourceReadsColumnsInBatches)
+{
+    std::vector<double> closes;
+    for (int i = 0; i < 1'000; ++i)
+        closes.push_back(static_cast<double>(i));
+    const auto series = testlib::makeSeries(closes, 1'000);
+
+    const auto path = tempPath("qga_bar_source.qgab");
+    qga::io::writeBarFile(path, "QQQ", series);
+
+    BarFileBarSource src(path);
+    EXPECT_EQ(src.symbol(), "QQQ");
+
+    std::size_t batches = 0;
+    const auto all = drain(src, 128, batches);
+    ASSERT_EQ(all.size(), series.size());
+    EXPECT_EQ(batches, 8u);
+    for (std::size_t i = 0; i < series.size(); ++i)
+    {
+        ASSERT_EQ(all[i].ts_, series[i].ts_);
+        ASSERT_DOUBLE_EQ(all[i].close_, series[i].close_);
+    }
+}
+
+TEST_F(BarSourcesTest, SqliteSourceStepsCursorInTimeOrder)
+{
+    const auto path = tempPath("qga_bar_source.db");
+    {
+        qga::persistence::SQLiteStore store(path);
+        std::vector<qga::domain::Quote> quotes;
+        for (int i = 49; i >= 0; --i)
+            quotes.push_back(testlib::bar(static_cast<double>(i), i * 1'000LL));
+        store.saveQuotes("AAPL", quotes);
+        store.saveQuotes("MSFT", {testlib::bar(1.0, 5)});
+    }
+
+    SqliteBarSource src(path, "AAPL");
+    std::size_t batches = 0;
+    const auto all = drain(src, 16, batches);
+
+    ASSERT_EQ(all.size(), 50u);
+    EXPECT_EQ(batches, 4u);
+    for (std::size_t i = 0; i < all.size(); ++i)
+        ASSERT_EQ(all[i].ts_, static_cast<std::int64_t>(i) * 1'000);
+
+    EXPECT_THROW(SqliteBarSource(path + ".missing", "AAPL"), std::runtime_error);
+}
@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <string>
+
+#include "core/ThreadPool.hpp"
+#include "fixtures/BaseTestFixture.hpp"
+#include "io/CsvBarParser.hpp"
+
+using qga::domain::Quote;
+using qga::domain::backtest::BarSeries;
+using namespace qga::io;
+using namespace qga::tests::fixtures;
+
+TEST(CsvBarParserTest, ParsesEpochAndIsoTimestamps)
+{
+    std::int64_t ts = 0;
+    ASSERT_TRUE(CsvBarParser::parseTimestamp("1669900800000", ts));
+    EXPECT_EQ(ts, 1669900800000);
+
+    ASSERT_TRUE(CsvBarParser::parseTimestamp("2022-12-01T13:00:00", ts));
+    EXPECT_EQ(ts, 1669899600000); // UTC
+
+    ASSERT_TRUE(CsvBarParser::parseTimestamp("2024-01-01T00:00:00.250Z", ts));
+    EXPECT_EQ(ts, 1704067200250);
+
+    EXPECT_FALSE(CsvBarParser::parseTimestamp("2024-13-01T00:00:00", ts));
+    EXPECT_FALSE(CsvBarParser::parseTimestamp("2024-01-01T00:00:00+02", ts));
+    EXPECT_FALSE(CsvBarParser::parseTimestamp("12ab", ts));
+}
+
+TEST(CsvBarParserTest, ParseLineRejectsWithoutThrowing)
+{
+    Quote q;
+    EXPECT_EQ(CsvBarParser::parseLine("1,100.5,102.3,99,101.2,12345.67", q), CsvRowError::None);
+    EXPECT_DOUBLE_EQ(q.volume_, 12345.67);
+
+    EXPECT_EQ(CsvBarParser::parseLine("1,2,3", q), CsvRowError::FieldCount);
+    EXPECT_EQ(CsvBarParser::parseLine("1,2,3,4,5,6,7", q), CsvRowError::FieldCount);
+    EXPECT_EQ(CsvBarParser::parseLine("x,2,3,4,5,6", q), CsvRowError::BadTimestamp);
+    EXPECT_EQ(CsvBarParser::parseLine("1,2,3,4,5abc,6", q), CsvRowError::BadNumber);
+}
+
+TEST(CsvBarParserTest, StitchesRowsSplitAcrossChunks)
+{
+    const std::string csv = "timestamp,open,high,low,close,volume\r\n"
+                            "1,10,11,9,10.5,100\r\n"
+                            "2,10.5,12,10,11.5,200\r\n"
+                            "bad,row\n"
+                            "3,11.5,13,11,12.5,300";
+
+    // Feed byte by byte: the worst case for row stitching.
+    BarSeries series;
+    CsvBarParser parser(series);
+    for (char c : csv)
+        parser.feed(std::string_view(&c, 1));
+    parser.finish();
+
+    const auto& stats = parser.stats();
+    EXPECT_TRUE(stats.header_skipped_);
+    EXPECT_EQ(stats.rows_ok_, 3u);
+    EXPECT_EQ(stats.rows_bad_, 1u);
+    ASSERT_EQ(stats.issues_.size(), 1u);
+    EXPECT_EQ(stats.issues_[0].line_, 4u);
+    EXPECT_EQ(stats.issues_[0].error_, CsvRowError::FieldCount);
+
+    ASSERT_EQ(series.size(), 3u);
+    EXPECT_EQ(series[2].ts_, 3);
+    EXPECT_DOUBLE_EQ(series[1].close_, 11.5);
+}
+
+class CsvBarParserFileTest : public BaseTestFixture
+{
+};
+
+TEST_F(CsvBarParserFileTest, ParsesFileWithoutHeader)
+{
+    const auto path = tempPath("qga_csv_parser.csv");
+    {
+        std::ofstream out(path);
+        out << "1669900800000,100.5,102.3,99.0,101.2,12345.67\n"
+               "1669987200000,101.2,103.0,100.0,102.5,14500.00\n";
+    }
+
+    BarSeries series;
+    CsvParseStats stats;
+    ASSERT_TRUE(parseCsvFile(path, series, &stats));
+    EXPECT_FALSE(stats.header_skipped_);
+    ASSERT_EQ(series.size(), 2u);
+    EXPECT_EQ(series[0].ts_, 1669900800000);
+
+    EXPECT_FALSE(parseCsvFile(path + ".missing", series));
+}
+
+TEST_F(CsvBarParserFileTest, ParallelParseMatchesSerial)
+{
+    const auto path = tempPath("qga_csv_parallel.csv");
+    {
+        // ~5 MiB so the file is split into several chunks; sprinkle bad and blank lines.
+        std::ofstream out(path);
+        out << "timestamp,open,high,low,close,volume\n";
+        for (int i = 0; i < 100'000; ++i)
+        {
+            if (i % 9973 == 0)
+                out << "garbage,row\n";
+            if (i % 7919 == 0)
+                out << "\r\n";
+            out << 1'700'000'000'000LL + i * 60'000LL << ',' << 100 + i % 17 << ".25,"
+                << 101 + i % 17 << ".5," << 99 + i % 17 << ".75," << 100 + i % 13 << ".125,"
+                << 1000 + i << "\r\n";
+        }
+        out << "1800000000000,1,2,0.5,1.5,42"; // unterminated last row
+    }
+
+    BarSeries serial;
+    CsvParseStats serial_stats;
+    ASSERT_TRUE(parseCsvFile(path, serial, &serial_stats));
+
+    qga::core::ThreadPool pool(4);
+    BarSeries parallel;
+    CsvParseStats parallel_stats;
+    ASSERT_TRUE(parseCsvFileParallel(path, parallel, pool, &parallel_stats));
+
+    EXPECT_TRUE(parallel_stats.header_skipped_);
+    EXPECT_EQ(parallel_stats.rows_ok_, serial_stats.rows_ok_);
+    EXPECT_EQ(parallel_stats.rows_bad_, serial_stats.rows_bad_);
+    ASSERT_EQ(parallel_stats.issues_.size(), serial_stats.issues_.size());
+    for (std::size_t i = 0; i < serial_stats.issues_.size(); ++i)
+        EXPECT_EQ(parallel_stats.issues_[i].line_, serial_stats.issues_[i].line_);
+
+    ASSERT_EQ(parallel.size(), serial.size());
+    EXPECT_EQ(parallel.size(), 100'001u);
+    for (std::size_t i = 0; i < serial.size(); ++i)
+    {
+        ASSERT_EQ(parallel[i].ts_, serial[i].ts_) << "row " << i;
+        ASSERT_EQ(parallel[i].close_, serial[i].close_) << "row " << i;
+        ASSERT_EQ(parallel[i].volume_, serial[i].volume_) << "row " << i;
+    }
+
+    EXPECT_FALSE(parseCsvFileParallel(path + ".missing", parallel, pool));
+}
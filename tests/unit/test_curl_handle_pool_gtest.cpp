@@ -0,0 +1,46 @@
+#include <gtest/gtest.h>
+
+#include <utility>
+
+#include "ingest/CurlHandlePool.hpp"
+
+using qga::ingest::CurlHandlePool;
+
+TEST(CurlHandlePoolTest, ReturnedHandleIsReused)
+{
+    CurlHandlePool pool(2);
+    CURL* first = nullptr;
+    {
+        auto lease = pool.acquire();
+        ASSERT_NE(lease.get(), nullptr);
+        first = lease.get();
+        EXPECT_EQ(pool.idle(), 0u);
+    }
+    EXPECT_EQ(pool.idle(), 1u);
+
+    auto again = pool.acquire();
+    EXPECT_EQ(again.get(), first);
+}
+
+TEST(CurlHandlePoolTest, KeepsAtMostMaxIdleHandles)
+{
+    CurlHandlePool pool(1);
+    {
+        auto a = pool.acquire();
+        auto b = pool.acquire();
+        EXPECT_NE(a.get(), b.get());
+    }
+    EXPECT_EQ(pool.idle(), 1u);
+}
+
+TEST(CurlHandlePoolTest, MovedLeaseReturnsHandleOnce)
+{
+    CurlHandlePool pool(4);
+    {
+        auto a = pool.acquire();
+        auto b = std::move(a);
+        EXPECT_EQ(a.get(), nullptr);
+        EXPECT_NE(b.get(), nullptr);
+    }
+    EXPECT_EQ(pool.idle(), 1u);
+}
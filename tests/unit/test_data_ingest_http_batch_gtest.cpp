@@ -0,0 +1,45 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "fixtures/MockLoggerCapture.hpp"
+#include "ingest/DataIngest.hpp"
+
+using namespace qga::ingest;
+using qga::tests::fixtures::MockLoggerCapture;
+
+TEST(DataIngestHttpBatchTest, EmptyRequestListDoesNothing)
+{
+    DataIngest ingest(std::make_shared<MockLoggerCapture>());
+    int calls = 0;
+    EXPECT_EQ(ingest.fromHttpUrls({}, [&](HttpSymbolResult&&) { ++calls; }), 0u);
+    EXPECT_EQ(calls, 0);
+}
+
+TEST(DataIngestHttpBatchTest, TransportErrorsAreRetriedThenReported)
+{
+    auto logger = std::make_shared<MockLoggerCapture>();
+    DataIngest ingest(logger);
+
+    // Nothing listens on port 1: every attempt fails with "connection refused".
+    const std::vector<HttpSymbolRequest> requests{{"A", "http://127.0.0.1:1/a.csv"},
+                                                  {"B", "http://127.0.0.1:1/b.csv"}};
+    HttpBatchParams params;
+    params.max_retries_ = 2;
+    params.initial_backoff_ = std::chrono::milliseconds(1);
+
+    std::vector<HttpSymbolResult> results;
+    const auto LOADED = ingest.fromHttpUrls(
+        requests, [&](HttpSymbolResult&& r) { results.push_back(std::move(r)); }, params);
+
+    EXPECT_EQ(LOADED, 0u);
+    ASSERT_EQ(results.size(), 2u);
+    for (const auto& r : results)
+    {
+        EXPECT_FALSE(r.series_.has_value());
+        EXPECT_EQ(r.attempts_, 3);
+        EXPECT_FALSE(r.error_.empty());
+    }
+    EXPECT_EQ(logger->count(qga::LogLevel::Warn), 4u);
+}
@@ -0,0 +1,188 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "persistence/DatabaseWorker.hpp"
+
+using qga::domain::Quote;
+using qga::domain::backtest::BarSeries;
+using qga::domain::backtest::Portfolio;
+using qga::persistence::DatabaseWorker;
+using qga::persistence::DatabaseWorkerOptions;
+using qga::persistence::IDataStore;
+using qga::persistence::OverflowPolicy;
+using qga::persistence::QuoteQuery;
+
+namespace
+{
+    /// Records the saves and write batches it sees; shared with the test after the worker owns it.
+    struct StoreLog
+    {
+        std::mutex mtx_;
+        std::vector<std::string> events_;
+
+        void add(std::string e)
+        {
+            std::lock_guard lock(mtx_);
+            events_.push_back(std::move(e));
+        }
+    };
+
+    class RecordingStore : public IDataStore
+    {
+      public:
+        explicit RecordingStore(std::shared_ptr<StoreLog> log) : log_(std::move(log)) {}
+
+        void saveQuotes(const std::string& symbol, const std::vector<Quote>&) override { log_->add(symbol); }
+        std::vector<Quote> loadQuotes(const std::string&) override { return std::vector<Quote>(3); }
+        std::vector<Quote> loadQuotes(const std::string&, const QuoteQuery&) override { return {}; }
+        std::unique_ptr<qga::domain::backtest::IBarSource> openQuotes(const std::string&,
+                                                                      const QuoteQuery&) override
+        {
+            return nullptr;
+        }
+        void saveBarSeries(const std::string&, const std::string&, const BarSeries&) override {}
+        BarSeries loadBarSeries(const std::string&, const std::string&, const QuoteQuery&) override
+        {
+            return {};
+        }
+        void savePortfolio(const Portfolio&) override {}
+        Portfolio loadPortfolio(int) override { return Portfolio{}; }
+
+        void beginWriteBatch() override { log_->add("begin"); }
+        void commitWriteBatch() override { log_->add("commit"); }
+
+      private:
+        std::shared_ptr<StoreLog> log_;
+    };
+
+    /// Holds the worker inside a read task until release() is called.
+    struct Gate
+    {
+        std::promise<void> entered_, open_;
+        std::shared_future<void> opened_ = open_.get_future().share();
+
+        auto task()
+        {
+            return [this](IDataStore&) {
+                entered_.set_value();
+                opened_.wait();
+                return 0;
+            };
+        }
+        void release() { open_.set_value(); }
+    };
+} // namespace
+
+TEST(DatabaseWorkerTest, CoalescesQueuedWritesUntilARead)
+{
+    auto log = std::make_shared<StoreLog>();
+    DatabaseWorker worker(std::make_unique<RecordingStore>(log), nullptr, {.max_batch_ = 3});
+
+    Gate gate;
+    auto held = worker.submit(gate.task());
+    gate.entered_.get_future().wait();
+    for (const char* s : {"A", "B", "C", "D"})
+        worker.enqueue([s](IDataStore& store) { store.saveQuotes(s, {}); });
+    auto loaded = worker.submit([](IDataStore& store) { return store.loadQuotes("A").size(); });
+    worker.enqueue([](IDataStore& store) { store.saveQuotes("E", {}); });
+    gate.release();
+
+    EXPECT_EQ(held.get(), 0);
+    EXPECT_EQ(loaded.get(), 3u);
+    worker.stop();
+    const std::vector<std::string> EXPECTED = {"begin", "A", "B", "C", "commit", "D", "E"};
+    EXPECT_EQ(log->events_, EXPECTED);
+}
+
+TEST(DatabaseWorkerTest, FailedWriteDoesNotStopTheBatch)
+{
+    auto log = std::make_shared<StoreLog>();
+    DatabaseWorker worker(std::make_unique<RecordingStore>(log), nullptr);
+
+    Gate gate;
+    worker.submit(gate.task());
+    gate.entered_.get_future().wait();
+    worker.enqueue([](IDataStore& store) { store.saveQuotes("A", {}); });
+    worker.enqueue([](IDataStore&) { throw std::runtime_error("write failed"); });
+    worker.enqueue([](IDataStore& store) { store.saveQuotes("B", {}); });
+    gate.release();
+
+    worker.stop();
+    const std::vector<std::string> EXPECTED = {"begin", "A", "B", "commit"};
+    EXPECT_EQ(log->events_, EXPECTED);
+}
+
+TEST(DatabaseWorkerTest, SubmitPropagatesResultsAndExceptions)
+{
+    DatabaseWorker worker(std::make_unique<RecordingStore>(std::make_shared<StoreLog>()), nullptr);
+    auto ok = worker.submit([](IDataStore& store) { return store.loadQuotes("X").size(); });
+    auto bad = worker.submit([](IDataStore&) -> int { throw std::invalid_argument("bad read"); });
+    EXPECT_EQ(ok.get(), 3u);
+    EXPECT_THROW(bad.get(), std::invalid_argument);
+}
+
+TEST(DatabaseWorkerTest, DropPolicyRejectsWhenFull)
+{
+    DatabaseWorker worker(std::make_unique<RecordingStore>(std::make_shared<StoreLog>()), nullptr,
+                          {.capacity_ = 2, .overflow_ = OverflowPolicy::Drop});
+    Gate gate;
+    worker.submit(gate.task());
+    gate.entered_.get_future().wait();
+
+    EXPECT_TRUE(worker.enqueue([](IDataStore&) {}));
+    EXPECT_TRUE(worker.enqueue([](IDataStore&) {}));
+    EXPECT_FALSE(worker.enqueue([](IDataStore&) {}));
+    auto rejected = worker.submit([](IDataStore&) { return 1; });
+    EXPECT_THROW(rejected.get(), std::runtime_error);
+    EXPECT_EQ(worker.rejected(), 2u);
+    gate.release();
+}
+
+TEST(DatabaseWorkerTest, BlockPolicyWaitsForRoom)
+{
+    DatabaseWorker worker(std::make_unique<RecordingStore>(std::make_shared<StoreLog>()), nullptr,
+                          {.capacity_ = 1});
+    Gate gate;
+    worker.submit(gate.task());
+    gate.entered_.get_future().wait();
+    ASSERT_TRUE(worker.enqueue([](IDataStore&) {}));
+
+    std::atomic<bool> pushed{false};
+    std::thread producer([&] { pushed = worker.enqueue([](IDataStore&) {}); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_FALSE(pushed.load());
+    gate.release();
+    producer.join();
+    EXPECT_TRUE(pushed.load());
+    EXPECT_EQ(worker.rejected(), 0u);
+}
+
+TEST(DatabaseWorkerTest, StopRunsEveryAcceptedTask)
+{
+    std::atomic<int> done{0};
+    DatabaseWorker worker(std::make_unique<RecordingStore>(std::make_shared<StoreLog>()), nullptr);
+    for (int i = 0; i < 200; ++i)
+        worker.enqueue([&done](IDataStore&) { ++done; });
+    worker.stop();
+    EXPECT_EQ(done.load(), 200);
+
+    EXPECT_FALSE(worker.enqueue([&done](IDataStore&) { ++done; }));
+    worker.stop();  // idempotent
+    EXPECT_EQ(done.load(), 200);
+}
+
+TEST(DatabaseWorkerTest, RejectsZeroCapacity)
+{
+    EXPECT_THROW(DatabaseWorker(std::make_unique<RecordingStore>(std::make_shared<StoreLog>()), nullptr,
+                                {.capacity_ = 0}),
+                 std::invalid_argument);
+}
@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "domain/backtest/BarSource.hpp"
+#include "domain/backtest/Engine.hpp"
+#include "strategy/BuyHold.hpp"
+#include "strategy/MACrossover.hpp"
+#include "test_helpers.hpp"
+
+using namespace qga::domain::backtest;
+using qga::strategy::Signal;
+
+namespace
+{
+    /// Buys on the bars listed in `buys`, sells on the bars in `sells`.
+    class ScheduleStrategy : public qga::strategy::IStrategy
+    {
+      public:
+        ScheduleStrategy(std::vector<std::size_t> buys, std::vector<std::size_t> sells)
+            : buys_(std::move(buys)), sells_(std::move(sells))
+        {
+        }
+
+        void onStart() override { bar_ = 0; }
+        Signal onBar(const qga::domain::Quote&) override
+        {
+            const std::size_t I = bar_++;
+            for (auto b : buys_)
+                if (b == I)
+                    return Signal::Buy;
+            for (auto s : sells_)
+                if (s == I)
+                    return Signal::Sell;
+            return Signal::None;
+        }
+
+      private:
+        std::vector<std::size_t> buys_, sells_;
+        std::size_t bar_ = 0;
+    };
+
+    BarSeries zigzag()
+    {
+        return testlib::makeSeries({10.0, 12.0, 8.0, 9.0, 15.0, 11.0, 13.0, 7.0}, 1'000, 60'000);
+    }
+} // namespace
+
+TEST(EngineRecordsTest, SummaryLevelRecordsNothing)
+{
+    const Engine engine(100.0);
+    ScheduleStrategy strat({0, 4}, {2});
+    const auto r = engine.run(zigzag(), strat);
+
+    EXPECT_EQ(r.trades_executed_, 2);
+    EXPECT_TRUE(r.trades_.empty());
+    EXPECT_TRUE(r.equity_curve_.empty());
+    EXPECT_TRUE(r.drawdown_.empty());
+    EXPECT_EQ(r.max_drawdown_, 0.0);
+}
+
+TEST(EngineRecordsTest, TradesLevelRecordsRoundTripsIncludingLiquidation)
+{
+    const Engine engine(100.0, ExecParams{0.5, 0.0, 0.0}, RecordLevel::Trades);
+    ScheduleStrategy strat({0, 4}, {2});
+    const auto r = engine.run(zigzag(), strat);
+
+    ASSERT_EQ(r.trades_.size(), 2u);
+    const auto& first = r.trades_[0];
+    EXPECT_EQ(first.entry_ts_, 1'000);
+    EXPECT_EQ(first.exit_ts_, 1'000 + 2 * 60'000);
+    EXPECT_EQ(first.entry_price_, 10.0);
+    EXPECT_EQ(first.exit_price_, 8.0);
+    EXPECT_EQ(first.qty_, 1.0);
+    EXPECT_EQ(first.fee_, 1.0);
+    EXPECT_EQ(first.pnl_, -3.0);
+
+    // Second trade is still open at the end and closed by the liquidation.
+    const auto& second = r.trades_[1];
+    EXPECT_EQ(second.entry_price_, 15.0);
+    EXPECT_EQ(second.exit_price_, 7.0);
+    EXPECT_EQ(second.exit_ts_, 1'000 + 7 * 60'000);
+    EXPECT_EQ(second.pnl_, -9.0);
+
+    EXPECT_DOUBLE_EQ(r.final_equity_, 100.0 + first.pnl_ + second.pnl_);
+    EXPECT_TRUE(r.equity_curve_.empty());
+}
+
+TEST(EngineRecordsTest, FullLevelRecordsEquityAndDrawdownPerBar)
+{
+    const Engine engine(100.0, ExecParams{}, RecordLevel::Full);
+    ScheduleStrategy strat({0}, {4});
+    const auto r = engine.run(zigzag(), strat);
+
+    const std::vector<double> expected_equity{100.0, 102.0, 98.0, 99.0, 105.0, 105.0, 105.0, 105.0};
+    ASSERT_EQ(r.equity_curve_, expected_equity);
+    ASSERT_EQ(r.drawdown_.size(), expected_equity.size());
+    EXPECT_EQ(r.drawdown_[0], 0.0);
+    EXPECT_DOUBLE_EQ(r.drawdown_[2], 4.0 / 102.0);
+    EXPECT_EQ(r.drawdown_[4], 0.0);
+    EXPECT_DOUBLE_EQ(r.max_drawdown_, 4.0 / 102.0);
+    EXPECT_EQ(r.trades_.size(), 1u);
+}
+
+TEST(EngineRecordsTest, AllEnginePathsRecordTheSameSeries)
+{
+    std::vector<double> closes;
+    for (int i = 0; i < 3'000; ++i)
+        closes.push_back(100.0 + (i % 97) * 0.3 - (i % 41) * 0.5);
+    const auto series = testlib::makeSeries(closes);
+    const Engine engine(1'000.0, ExecParams{1.0, 5.0, 2.0}, RecordLevel::Full);
+
+    qga::strategy::MACrossover a(5, 20), b(5, 20), c(5, 20);
+    const auto batch = engine.run(series, a);
+    SeriesBarSource source(series);
+    const auto streamed = engine.run(source, b, 256);
+    const auto vectorized = engine.runVectorized(series, c);
+
+    ASSERT_GT(batch.trades_.size(), 3u);
+    for (const auto* other : {&streamed, &vectorized})
+    {
+        EXPECT_EQ(other->final_equity_, batch.final_equity_);
+        EXPECT_EQ(other->equity_curve_, batch.equity_curve_);
+        EXPECT_EQ(other->drawdown_, batch.drawdown_);
+        EXPECT_EQ(other->max_drawdown_, batch.max_drawdown_);
+        ASSERT_EQ(other->trades_.size(), batch.trades_.size());
+        for (std::size_t i = 0; i < batch.trades_.size(); ++i)
+        {
+            EXPECT_EQ(other->trades_[i].entry_ts_, batch.trades_[i].entry_ts_);
+            EXPECT_EQ(other->trades_[i].exit_ts_, batch.trades_[i].exit_ts_);
+            EXPECT_EQ(other->trades_[i].pnl_, batch.trades_[i].pnl_);
+        }
+    }
+}
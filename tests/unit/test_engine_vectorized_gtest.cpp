@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "domain/backtest/Engine.hpp"
+#include "strategy/BuyHold.hpp"
+#include "strategy/MACrossover.hpp"
+#include "test_helpers.hpp"
+
+using namespace qga::domain::backtest;
+using qga::strategy::Signal;
+
+namespace
+{
+    /// Deterministic noisy walk so crossovers happen often.
+    BarSeries walkSeries(std::size_t n, double start = 100.0)
+    {
+        std::vector<double> closes;
+        std::uint64_t state = 42;
+        double px = start;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            px += (static_cast<double>(state >> 11) / 9007199254740992.0 - 0.5) * 2.0;
+            closes.push_back(std::max(px, 1.0));
+        }
+        return testlib::makeSeries(closes);
+    }
+
+    /// Replays a fixed signal array; also usable through the streaming engine.
+    class ScriptedStrategy : public qga::strategy::IStrategy, public qga::strategy::IVectorStrategy
+    {
+      public:
+        explicit ScriptedStrategy(std::vector<Signal> script) : script_(std::move(script)) {}
+
+        void onStart() override { pos_ = 0; }
+        Signal onBar(const qga::domain::Quote&) override { return script_[pos_++]; }
+        void signals(const qga::domain::BarColumns&, std::span<Signal> out) override
+        {
+            std::copy(script_.begin(), script_.end(), out.begin());
+        }
+
+      private:
+        std::vector<Signal> script_;
+        std::size_t pos_ = 0;
+    };
+} // namespace
+
+TEST(EngineVectorizedTest, MACrossoverMatchesStreamingRunBitForBit)
+{
+    const auto series = walkSeries(20'000);
+    const Engine engine(10'000.0, ExecParams{1.0, 2.0, 3.0});
+
+    for (auto [fast, slow] : {std::pair{3, 5}, {5, 20}, {10, 50}, {20, 10}, {7, 7}})
+    {
+        qga::strategy::MACrossover bar_strat(fast, slow);
+        qga::strategy::MACrossover vec_strat(fast, slow);
+        const auto expected = engine.run(series, bar_strat);
+        const auto actual = engine.runVectorized(series, vec_strat);
+
+        EXPECT_EQ(actual.final_equity_, expected.final_equity_) << fast << "/" << slow;
+        EXPECT_EQ(actual.trades_executed_, expected.trades_executed_) << fast << "/" << slow;
+    }
+}
+
+TEST(EngineVectorizedTest, SignalsMatchOnBarDecisions)
+{
+    const auto series = walkSeries(5'000);
+    qga::strategy::MACrossover strat(4, 17);
+
+    std::vector<Signal> vec(series.size());
+    strat.signals(series.columns(), vec);
+
+    strat.onStart();
+    for (std::size_t i = 0; i < series.size(); ++i)
+        ASSERT_EQ(strat.onBar(series[i]), vec[i]) << "bar " << i;
+}
+
+TEST(EngineVectorizedTest, SignalsLeaveStreamingStateAlone)
+{
+    const auto series = walkSeries(2'000);
+    const auto other = walkSeries(300, 50.0);
+    qga::strategy::MACrossover reference(5, 20), interrupted(5, 20);
+    reference.onStart();
+    interrupted.onStart();
+
+    std::vector<Signal> scratch(other.size());
+    for (std::size_t i = 0; i < series.size(); ++i)
+    {
+        if (i == series.size() / 2)
+            interrupted.signals(other.columns(), scratch);
+        ASSERT_EQ(interrupted.onBar(series[i]), reference.onBar(series[i])) << "bar " << i;
+    }
+}
+
+TEST(EngineVectorizedTest, BuyHoldEquityCurveMarksEveryBar)
+{
+    const auto series = testlib::makeSeries({10.0, 11.0, 9.0, 12.0});
+    const Engine engine(100.0, ExecParams{0.5, 0.0, 0.0}, RecordLevel::Full);
+    qga::strategy::BuyHold strat;
+
+    const auto r = engine.runVectorized(series, strat);
+    const auto& curve = r.equity_curve_;
+
+    ASSERT_EQ(curve.size(), 4u);
+    const double CASH = 100.0 - (10.0 + 0.5);
+    EXPECT_EQ(curve[0], CASH + 10.0);
+    EXPECT_EQ(curve[2], CASH + 9.0);
+    EXPECT_EQ(curve[3], CASH + 12.0);
+    EXPECT_EQ(r.trades_executed_, 1);
+    EXPECT_EQ(r.final_equity_, CASH + 12.0 - 0.5);
+
+    qga::strategy::BuyHold bar_strat;
+    EXPECT_EQ(engine.run(series, bar_strat).final_equity_, r.final_equity_);
+}
+
+TEST(EngineVectorizedTest, RedundantAndUnaffordableSignalsAreIgnored)
+{
+    const auto series = testlib::makeSeries({50.0, 200.0, 40.0, 45.0, 60.0, 30.0, 35.0});
+    const Engine engine(100.0, ExecParams{}, RecordLevel::Full);
+    const std::vector<Signal> script{Signal::Sell, Signal::Buy, Signal::Buy, Signal::Buy,
+                                     Signal::Sell, Signal::Sell, Signal::Buy};
+
+    ScriptedStrategy bar_strat(script), vec_strat(script);
+    const auto expected = engine.run(series, bar_strat);
+    const auto actual = engine.runVectorized(series, vec_strat);
+    const auto& curve = actual.equity_curve_;
+
+    EXPECT_EQ(actual.final_equity_, expected.final_equity_);
+    EXPECT_EQ(actual.trades_executed_, 2);
+    // Bar 1 (price 200) is unaffordable; the position opens at bar 2 and closes at bar 4.
+    EXPECT_EQ(curve[1], 100.0);
+    EXPECT_EQ(curve[3], 60.0 + 45.0);
+    EXPECT_EQ(curve[5], 120.0);
+}
+
+TEST(EngineVectorizedTest, EmptySeriesKeepsInitialEquity)
+{
+    const Engine engine(1'000.0, ExecParams{}, RecordLevel::Full);
+    qga::strategy::BuyHold strat;
+
+    const auto r = engine.runVectorized(BarSeries{}, strat);
+    EXPECT_EQ(r.final_equity_, 1'000.0);
+    EXPECT_EQ(r.trades_executed_, 0);
+    EXPECT_TRUE(r.equity_curve_.empty());
+}
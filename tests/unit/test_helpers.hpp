@@ -1,4 +1,6 @@
 #pragma once
+#include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <vector>
 #include "domain/Quote.hpp"
@@ -22,4 +24,35 @@ inline qga::domain::backtest::BarSeries makeSeries(const std::vector<double>& cl
     return s;
 }
 
+/// Shape of the close prices generated by wavySeries().
+struct Wave {
+    double base_ = 100.0;          ///< Level the wave oscillates around.
+    double amplitude_ = 10.0;      ///< Amplitude of the slow wave.
+    double period_ = 15.0;         ///< Bars per radian of the slow wave.
+    double phase_ = 0.0;           ///< Phase of the slow wave (radians).
+    double ripple_ = 0.0;          ///< Amplitude of the fast wave.
+    double ripple_period_ = 3.0;   ///< Bars per radian of the fast wave.
+    double drift_ = 0.0;           ///< Added per bar.
+    double volume_ = 0.0;          ///< Volume of every bar ...
+    double spike_volume_ = 0.0;    ///< ... except every spike_every_-th bar (from bar 0).
+    std::size_t spike_every_ = 0;  ///< 0 = no volume spikes.
+    std::int64_t ts0_ = 0;
+    std::int64_t step_ms_ = 60'000;
+};
+
+/// Flat bars (open = high = low = close) whose closes follow @p wave.
+inline qga::domain::backtest::BarSeries wavySeries(std::size_t n, const Wave& wave = {}) {
+    qga::domain::backtest::BarSeries s;
+    for (std::size_t i = 0; i < n; ++i) {
+        const double X = static_cast<double>(i);
+        double close = wave.base_ + wave.amplitude_ * std::sin(X / wave.period_ + wave.phase_);
+        if (wave.ripple_ != 0.0) close += wave.ripple_ * std::sin(X / wave.ripple_period_);
+        if (wave.drift_ != 0.0) close += wave.drift_ * X;
+        const bool SPIKE = wave.spike_every_ > 0 && i % wave.spike_every_ == 0;
+        s.add(bar(close, wave.ts0_ + static_cast<std::int64_t>(i) * wave.step_ms_,
+                  SPIKE ? wave.spike_volume_ : wave.volume_));
+    }
+    return s;
+}
+
 } // namespace testlib
@@ -0,0 +1,178 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "domain/backtest/Engine.hpp"
+#include "indicators/Indicators.hpp"
+#include "strategy/IndicatorGraph.hpp"
+#include "strategy/MACrossover.hpp"
+#include "strategy/StreamingIndicators.hpp"
+#include "test_helpers.hpp"
+
+using namespace qga::domain::backtest;
+using namespace qga::strategy;
+
+namespace
+{
+    std::vector<double> wavyCloses(std::size_t n)
+    {
+        std::vector<double> closes;
+        for (std::size_t i = 0; i < n; ++i)
+            closes.push_back(100.0 + 10.0 * std::sin(static_cast<double>(i) / 20.0) +
+                             3.0 * std::sin(static_cast<double>(i) / 3.0) + 0.01 * static_cast<double>(i));
+        return closes;
+    }
+
+    template <typename Ind>
+    std::vector<double> stream(Ind ind, const std::vector<double>& in)
+    {
+        std::vector<double> out;
+        for (double x : in)
+            out.push_back(ind.update(x));
+        return out;
+    }
+
+    void expectSame(const std::vector<double>& got, const std::vector<double>& want, double tol)
+    {
+        ASSERT_EQ(got.size(), want.size());
+        for (std::size_t i = 0; i < got.size(); ++i)
+        {
+            if (std::isnan(want[i]))
+                EXPECT_TRUE(std::isnan(got[i])) << "i=" << i;
+            else
+                EXPECT_NEAR(got[i], want[i], tol) << "i=" << i;
+        }
+    }
+} // namespace
+
+TEST(StreamingIndicatorsTest, MatchTheWholeSeriesKernels)
+{
+    const auto in = wavyCloses(3'000);
+    std::vector<double> want(in.size());
+
+    qga::indicators::sma(in, 20, want);
+    expectSame(stream(Sma(20), in), want, 1e-9);
+
+    qga::indicators::ema(in, 12, want);
+    expectSame(stream(Ema(12), in), want, 1e-12);
+
+    qga::indicators::rsi(in, 14, want);
+    expectSame(stream(Rsi(14), in), want, 1e-9);
+
+    std::vector<double> high(in.size()), low(in.size());
+    for (std::size_t i = 0; i < in.size(); ++i)
+    {
+        high[i] = in[i] + 0.6;
+        low[i] = in[i] - 0.4;
+    }
+    qga::indicators::atr(high, low, in, 14, want);
+    Atr atr(14);
+    std::vector<double> got;
+    for (std::size_t i = 0; i < in.size(); ++i)
+        got.push_back(atr.update(high[i], low[i], in[i]));
+    expectSame(got, want, 1e-12);
+}
+
+TEST(StreamingIndicatorsTest, ResetStartsOver)
+{
+    Ema ema(3);
+    for (double x : {1.0, 2.0, 3.0, 10.0})
+        ema.update(x);
+    ema.reset();
+    EXPECT_TRUE(std::isnan(ema.value()));
+    ema.update(4.0);
+    ema.update(5.0);
+    EXPECT_DOUBLE_EQ(ema.update(6.0), 5.0);
+
+    Sma never(0);
+    EXPECT_TRUE(std::isnan(never.update(1.0)));
+}
+
+TEST(IndicatorGraphTest, DeduplicatesIdenticalRequests)
+{
+    IndicatorGraph g;
+    const auto a = g.sma(20);
+    const auto b = g.sma(20);
+    const auto c = g.sma(50);
+    const auto d = g.sma(20, g.field(BarField::High));
+    const auto e = g.ema(9, g.rsi(14));
+    const auto f = g.ema(9, g.rsi(14));
+
+    EXPECT_EQ(a, b);
+    EXPECT_NE(a, c);
+    EXPECT_NE(a, d);
+    EXPECT_EQ(e, f);
+    EXPECT_EQ(g.atr(14), g.atr(14));
+
+    // close, sma20, sma50, high, sma20(high), rsi14, ema9(rsi14), atr14
+    EXPECT_EQ(g.size(), 8u);
+    EXPECT_GT(g.requests(), g.size());
+    EXPECT_THROW(g.sma(5, 1000), std::out_of_range);
+}
+
+TEST(IndicatorGraphTest, ColumnsContinueAcrossBlocks)
+{
+    const auto closes = wavyCloses(2'500);
+    const auto series = testlib::makeSeries(closes);
+
+    IndicatorGraph g;
+    const auto rsi = g.rsi(14);
+    const auto chained = g.ema(5, rsi);
+    const auto close = g.field(BarField::Close);
+
+    std::vector<double> got_rsi, got_chain;
+    const auto cols = series.columns();
+    for (std::size_t b = 0; b < cols.size(); b += 700)
+    {
+        const auto block = cols.slice(b, std::min<std::size_t>(700, cols.size() - b));
+        g.update(block);
+        ASSERT_EQ(g.column(close).data(), block.close_.data());  // bar columns are views
+        for (double v : g.column(rsi))
+            got_rsi.push_back(v);
+        for (double v : g.column(chained))
+            got_chain.push_back(v);
+    }
+
+    const auto want_rsi = stream(Rsi(14), closes);
+    expectSame(got_rsi, want_rsi, 0.0);
+    // Chained nodes see their input's warm-up NaNs, exactly as a stand-alone chain would.
+    expectSame(got_chain, stream(Ema(5), want_rsi), 0.0);
+}
+
+TEST(EngineRunManyTest, MatchesStandaloneRunsExactly)
+{
+    const auto series = testlib::makeSeries(wavyCloses(5'000));
+    const Engine engine(10'000.0, ExecParams{0.5, 1.0, 1.0}, RecordLevel::Full);
+
+    const std::vector<std::pair<int, int>> params{{5, 20}, {5, 30}, {10, 30}, {5, 20}, {3, 60}};
+    std::vector<std::unique_ptr<MACrossover>> shared;
+    std::vector<IGraphStrategy*> strats;
+    for (auto [fast, slow] : params)
+    {
+        shared.push_back(std::make_unique<MACrossover>(fast, slow));
+        strats.push_back(shared.back().get());
+    }
+
+    const auto results = engine.runMany(series, strats);
+    ASSERT_EQ(results.size(), params.size());
+
+    for (std::size_t k = 0; k < params.size(); ++k)
+    {
+        MACrossover alone(params[k].first, params[k].second);
+        const auto want = engine.run(series, alone);
+        EXPECT_EQ(results[k].final_equity_, want.final_equity_) << "k=" << k;
+        EXPECT_EQ(results[k].trades_executed_, want.trades_executed_) << "k=" << k;
+        EXPECT_EQ(results[k].equity_curve_, want.equity_curve_) << "k=" << k;
+        EXPECT_EQ(results[k].trades_.size(), want.trades_.size()) << "k=" << k;
+        EXPECT_EQ(results[k].max_drawdown_, want.max_drawdown_) << "k=" << k;
+    }
+    EXPECT_GT(results[0].trades_executed_, 0);
+}
+
+TEST(EngineRunManyTest, NoStrategiesYieldsNoResults)
+{
+    const auto series = testlib::makeSeries(wavyCloses(100));
+    EXPECT_TRUE(Engine().runMany(series, {}).empty());
+}
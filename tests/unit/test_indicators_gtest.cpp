@@ -0,0 +1,301 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "indicators/Indicators.hpp"
+
+namespace ind = qga::indicators;
+
+namespace
+{
+    // Random walk around a price-like level; long enough to cross several
+    // internal blocks and to exercise the vector tails.
+    std::vector<double> walk(std::size_t n, unsigned seed = 7)
+    {
+        std::mt19937 rng(seed);
+        std::normal_distribution<double> step(0.0, 1.0);
+        std::vector<double> v(n);
+        double x = 1000.0;
+        for (auto& e : v)
+        {
+            x += step(rng);
+            e = x;
+        }
+        return v;
+    }
+
+    std::vector<ind::SimdLevel> levels()
+    {
+        std::vector<ind::SimdLevel> out{ind::SimdLevel::Scalar};
+        if (ind::detectSimdLevel() >= ind::SimdLevel::AVX2)
+            out.push_back(ind::SimdLevel::AVX2);
+        if (ind::detectSimdLevel() >= ind::SimdLevel::AVX512)
+            out.push_back(ind::SimdLevel::AVX512);
+        return out;
+    }
+
+    // Restores the detected level when a test ends.
+    struct LevelGuard
+    {
+        ~LevelGuard() { ind::setSimdLevel(ind::detectSimdLevel()); }
+    };
+
+    void expectSeriesNear(const std::vector<double>& got, const std::vector<double>& want, double tol)
+    {
+        ASSERT_EQ(got.size(), want.size());
+        for (std::size_t i = 0; i < got.size(); ++i)
+        {
+            if (std::isnan(want[i]))
+                EXPECT_TRUE(std::isnan(got[i])) << "i=" << i;
+            else
+                EXPECT_NEAR(got[i], want[i], tol) << "i=" << i;
+        }
+    }
+
+    std::vector<double> naiveSma(const std::vector<double>& in, std::size_t p)
+    {
+        std::vector<double> out(in.size(), NAN);
+        for (std::size_t i = p - 1; i < in.size(); ++i)
+        {
+            double s = 0.0;
+            for (std::size_t j = i + 1 - p; j <= i; ++j)
+                s += in[j];
+            out[i] = s / static_cast<double>(p);
+        }
+        return out;
+    }
+
+    std::vector<double> naiveSd(const std::vector<double>& in, std::size_t p)
+    {
+        const auto mean = naiveSma(in, p);
+        std::vector<double> out(in.size(), NAN);
+        for (std::size_t i = p - 1; i < in.size(); ++i)
+        {
+            double s = 0.0;
+            for (std::size_t j = i + 1 - p; j <= i; ++j)
+                s += (in[j] - mean[i]) * (in[j] - mean[i]);
+            out[i] = std::sqrt(s / static_cast<double>(p));
+        }
+        return out;
+    }
+} // namespace
+
+TEST(IndicatorsTest, SetSimdLevelIsCappedAtTheDetectedLevel)
+{
+    LevelGuard guard;
+    EXPECT_EQ(ind::setSimdLevel(ind::SimdLevel::AVX512), ind::detectSimdLevel());
+    EXPECT_EQ(ind::setSimdLevel(ind::SimdLevel::Scalar), ind::SimdLevel::Scalar);
+    EXPECT_EQ(ind::simdLevel(), ind::SimdLevel::Scalar);
+    EXPECT_STREQ(ind::toString(ind::SimdLevel::AVX2), "avx2");
+}
+
+TEST(IndicatorsTest, SmaMatchesNaiveWindowsOnEveryLevel)
+{
+    LevelGuard guard;
+    const auto in = walk(10007);
+    for (std::size_t p : {1u, 3u, 20u, 200u, 5000u})
+    {
+        const auto want = naiveSma(in, p);
+        for (auto level : levels())
+        {
+            SCOPED_TRACE(ind::toString(level));
+            ind::setSimdLevel(level);
+            std::vector<double> out(in.size());
+            ind::sma(in, p, out);
+            expectSeriesNear(out, want, 1e-9);
+        }
+    }
+}
+
+TEST(IndicatorsTest, EmaIsSeededWithTheSmaOfTheFirstWindow)
+{
+    const std::vector<double> in{1, 2, 3, 4, 5, 6};
+    std::vector<double> out(in.size());
+    ind::ema(in, 3, out);
+
+    EXPECT_TRUE(std::isnan(out[0]));
+    EXPECT_TRUE(std::isnan(out[1]));
+    EXPECT_DOUBLE_EQ(out[2], 2.0);
+    EXPECT_DOUBLE_EQ(out[3], 3.0);  // 2 + 0.5 * (4 - 2)
+    EXPECT_DOUBLE_EQ(out[4], 4.0);
+    EXPECT_DOUBLE_EQ(out[5], 5.0);
+}
+
+TEST(IndicatorsTest, RsiFollowsWilderSmoothing)
+{
+    LevelGuard guard;
+    const auto in = walk(3001, 11);
+    const std::size_t p = 14;
+
+    std::vector<double> want(in.size(), NAN);
+    double g = 0.0, l = 0.0;
+    for (std::size_t j = 1; j <= p; ++j)
+    {
+        const double d = in[j] - in[j - 1];
+        g += std::max(d, 0.0);
+        l += std::max(-d, 0.0);
+    }
+    g /= p;
+    l /= p;
+    want[p] = 100.0 - 100.0 / (1.0 + g / l);
+    for (std::size_t j = p + 1; j < in.size(); ++j)
+    {
+        const double d = in[j] - in[j - 1];
+        g = (g * (p - 1) + std::max(d, 0.0)) / p;
+        l = (l * (p - 1) + std::max(-d, 0.0)) / p;
+        want[j] = 100.0 - 100.0 / (1.0 + g / l);
+    }
+
+    for (auto level : levels())
+    {
+        SCOPED_TRACE(ind::toString(level));
+        ind::setSimdLevel(level);
+        std::vector<double> out(in.size());
+        ind::rsi(in, p, out);
+        expectSeriesNear(out, want, 1e-9);
+    }
+}
+
+TEST(IndicatorsTest, RsiHandlesWindowsWithoutLosses)
+{
+    std::vector<double> out(5);
+    ind::rsi(std::vector<double>{1, 2, 3, 4, 5}, 2, out);
+    EXPECT_EQ(out[2], 100.0);
+    EXPECT_EQ(out[4], 100.0);
+
+    ind::rsi(std::vector<double>{7, 7, 7, 7, 7}, 2, out);
+    EXPECT_EQ(out[3], 50.0);
+}
+
+TEST(IndicatorsTest, AtrUsesTrueRangeAndWilderSmoothing)
+{
+    LevelGuard guard;
+    const auto close = walk(2503, 3);
+    std::vector<double> high(close.size()), low(close.size());
+    for (std::size_t i = 0; i < close.size(); ++i)
+    {
+        // Gaps against the previous close make the |h - c'| / |l - c'| terms win.
+        const double gap = (i % 5 == 0) ? 3.0 : 0.0;
+        high[i] = close[i] + 0.5 + gap;
+        low[i] = close[i] - 0.7 + gap;
+    }
+    const std::size_t p = 14;
+
+    std::vector<double> tr(close.size());
+    tr[0] = high[0] - low[0];
+    for (std::size_t i = 1; i < close.size(); ++i)
+        tr[i] = std::max({high[i] - low[i], std::abs(high[i] - close[i - 1]), std::abs(low[i] - close[i - 1])});
+    std::vector<double> want(close.size(), NAN);
+    double a = 0.0;
+    for (std::size_t i = 0; i < p; ++i)
+        a += tr[i];
+    a /= p;
+    want[p - 1] = a;
+    for (std::size_t i = p; i < close.size(); ++i)
+    {
+        a = (a * (p - 1) + tr[i]) / p;
+        want[i] = a;
+    }
+
+    for (auto level : levels())
+    {
+        SCOPED_TRACE(ind::toString(level));
+        ind::setSimdLevel(level);
+        std::vector<double> out(close.size());
+        ind::atr(high, low, close, p, out);
+        expectSeriesNear(out, want, 1e-9);
+    }
+}
+
+TEST(IndicatorsTest, BollingerBandsMatchTwoPassStandardDeviation)
+{
+    LevelGuard guard;
+    const auto in = walk(9001, 5);
+    const std::size_t p = 20;
+    const auto mean = naiveSma(in, p);
+    const auto sd = naiveSd(in, p);
+
+    for (auto level : levels())
+    {
+        SCOPED_TRACE(ind::toString(level));
+        ind::setSimdLevel(level);
+        std::vector<double> mid(in.size()), up(in.size()), lo(in.size());
+        ind::bollinger(in, p, 2.0, mid, up, lo);
+        expectSeriesNear(mid, mean, 1e-9);
+        for (std::size_t i = p - 1; i < in.size(); ++i)
+        {
+            EXPECT_NEAR(up[i] - mid[i], 2.0 * sd[i], 1e-6) << "i=" << i;
+            EXPECT_NEAR(mid[i] - lo[i], 2.0 * sd[i], 1e-6) << "i=" << i;
+        }
+        EXPECT_TRUE(std::isnan(up[p - 2]));
+        EXPECT_TRUE(std::isnan(lo[p - 2]));
+    }
+}
+
+TEST(IndicatorsTest, ConstantSeriesHasZeroWidthBands)
+{
+    const std::vector<double> in(100, 123.25);
+    std::vector<double> mid(in.size()), up(in.size()), lo(in.size());
+    ind::bollinger(in, 10, 2.0, mid, up, lo);
+    EXPECT_EQ(mid[50], 123.25);
+    EXPECT_EQ(up[50], 123.25);
+    EXPECT_EQ(lo[50], 123.25);
+}
+
+TEST(IndicatorsTest, RollingMinMaxMatchNaiveWindows)
+{
+    auto in = walk(5000, 9);
+    for (std::size_t i = 0; i < in.size(); i += 37)
+        in[i] = in[i > 0 ? i - 1 : 0];  // ties
+    for (std::size_t p : {1u, 2u, 17u, 500u})
+    {
+        std::vector<double> lo(in.size()), hi(in.size());
+        ind::rollingMin(in, p, lo);
+        ind::rollingMax(in, p, hi);
+        for (std::size_t i = 0; i < in.size(); ++i)
+        {
+            if (i + 1 < p)
+            {
+                EXPECT_TRUE(std::isnan(lo[i]));
+                EXPECT_TRUE(std::isnan(hi[i]));
+                continue;
+            }
+            const auto first = in.begin() + static_cast<std::ptrdiff_t>(i + 1 - p);
+            const auto last = in.begin() + static_cast<std::ptrdiff_t>(i + 1);
+            ASSERT_EQ(lo[i], *std::min_element(first, last)) << "p=" << p << " i=" << i;
+            ASSERT_EQ(hi[i], *std::max_element(first, last)) << "p=" << p << " i=" << i;
+        }
+    }
+}
+
+TEST(IndicatorsTest, ShortInputsAreAllWarmup)
+{
+    const std::vector<double> in{1.0, 2.0};
+    std::vector<double> out(in.size(), 0.0);
+    ind::sma(in, 5, out);
+    EXPECT_TRUE(std::isnan(out[0]) && std::isnan(out[1]));
+    ind::rsi(in, 2, out);
+    EXPECT_TRUE(std::isnan(out[0]) && std::isnan(out[1]));
+    ind::atr(in, in, in, 3, out);
+    EXPECT_TRUE(std::isnan(out[0]) && std::isnan(out[1]));
+
+    std::vector<double> empty;
+    EXPECT_NO_THROW(ind::sma(empty, 3, empty));
+    EXPECT_NO_THROW(ind::rollingMax(empty, 3, empty));
+}
+
+TEST(IndicatorsTest, RejectsZeroPeriodAndSizeMismatch)
+{
+    const std::vector<double> in(10, 1.0);
+    std::vector<double> out(10), shorter(9);
+    EXPECT_THROW(ind::sma(in, 0, out), std::invalid_argument);
+    EXPECT_THROW(ind::ema(in, 3, shorter), std::invalid_argument);
+    EXPECT_THROW(ind::rollingMin(in, 0, out), std::invalid_argument);
+    EXPECT_THROW(ind::atr(in, shorter, in, 3, out), std::invalid_argument);
+    EXPECT_THROW(ind::bollinger(in, 3, 2.0, out, out, shorter), std::invalid_argument);
+}
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+#include "domain/InstrumentRegistry.hpp"
+#include "domain/backtest/Portfolio.hpp"
+
+using namespace qga::domain;
+using namespace qga::domain::backtest;
+
+namespace
+{
+    Instrument make(const std::string& symbol, const std::string& mic = "XNAS")
+    {
+        return Instrument{symbol, AssetClass::Equity, mic};
+    }
+} // namespace
+
+TEST(InstrumentRegistryTest, InternsDenseIdsBySymbolAndVenue)
+{
+    InstrumentRegistry reg;
+    EXPECT_EQ(reg.intern(make("AAPL")), 0u);
+    EXPECT_EQ(reg.intern(make("MSFT")), 1u);
+    EXPECT_EQ(reg.intern(make("AAPL", "XLON")), 2u);
+    // Same symbol and venue, different trading params: same identity.
+    EXPECT_EQ(reg.intern(Instrument{"AAPL", AssetClass::Equity, "XNAS", Currency::USD, 0.05}), 0u);
+
+    EXPECT_EQ(reg.size(), 3u);
+    EXPECT_EQ(reg.get(1).symbol(), "MSFT");
+    EXPECT_EQ(reg.find(make("MSFT")), 1u);
+    EXPECT_FALSE(reg.find(make("TSLA")).has_value());
+    EXPECT_THROW(reg.get(3), std::out_of_range);
+}
+
+TEST(InstrumentRegistryTest, CopiesAndMovesKeepLookupsValid)
+{
+    InstrumentRegistry reg;
+    for (int i = 0; i < 100; ++i)
+        reg.intern(make("A_LONG_SYMBOL_NAME_" + std::to_string(i)));
+
+    InstrumentRegistry copy = reg;
+    reg = InstrumentRegistry{};  // old storage gone
+    EXPECT_EQ(copy.find(make("A_LONG_SYMBOL_NAME_42")), 42u);
+
+    InstrumentRegistry moved = std::move(copy);
+    EXPECT_EQ(moved.find(make("A_LONG_SYMBOL_NAME_99")), 99u);
+    EXPECT_EQ(moved.intern(make("NEW")), 100u);
+}
+
+TEST(PortfolioFlatTest, TracksRealizedPnlAndTotalValueIncrementally)
+{
+    Portfolio pf{1'000.0};
+    const auto AAPL = make("AAPL");
+    const auto MSFT = make("MSFT");
+    const InstrumentId A = pf.idFor(AAPL);
+    const InstrumentId M = pf.idFor(MSFT);
+
+    pf.applyTrade(A, Trade{Order{AAPL, Side::Buy, 2.0}, 100.0, 2.0, {}, 0.0, 1.0});
+    pf.applyTrade(Trade{Order{MSFT, Side::Buy, 1.0}, 50.0, 1.0});  // lookup path
+    EXPECT_DOUBLE_EQ(pf.cash(), 1'000.0 - 200.0 - 1.0 - 50.0);
+    EXPECT_DOUBLE_EQ(pf.totalValue(), pf.cash() + 200.0 + 50.0);
+
+    pf.applyTrade(A, Trade{Order{AAPL, Side::Sell, 1.0}, 110.0, 1.0});
+    pf.applyTrade(M, Trade{Order{MSFT, Side::Sell, 1.0}, 45.0, 1.0});
+    EXPECT_DOUBLE_EQ(pf.realizedPnl(), 10.0 - 5.0);
+    EXPECT_DOUBLE_EQ(pf.totalValue(), pf.cash() + 100.0);
+    EXPECT_DOUBLE_EQ(pf.position(A).qty(), 1.0);
+    EXPECT_DOUBLE_EQ(pf.navFor(AAPL, 120.0), pf.cash() + 120.0);
+    EXPECT_DOUBLE_EQ(pf.navFor(make("TSLA"), 1.0), pf.cash());
+
+    EXPECT_THROW(pf.applyTrade(7, Trade{Order{AAPL, Side::Buy, 1.0}, 1.0, 1.0}), std::out_of_range);
+    EXPECT_EQ(pf.registry().size(), 2u);
+}
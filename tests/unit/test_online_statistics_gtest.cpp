@@ -0,0 +1,246 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "core/OnlineStatistics.hpp"
+#include "core/Statistics.hpp"
+#include "domain/backtest/Engine.hpp"
+#include "strategy/MACrossover.hpp"
+#include "test_helpers.hpp"
+
+using namespace qga::core;
+using namespace qga::domain::backtest;
+
+namespace
+{
+    /// Deterministic noisy walk, strictly positive.
+    std::vector<double> walk(std::size_t n, double start = 100.0)
+    {
+        std::vector<double> out;
+        std::uint64_t state = 7;
+        double px = start;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            px += (static_cast<double>(state >> 11) / 9007199254740992.0 - 0.5) * 2.0;
+            px = std::max(px, 1.0);
+            out.push_back(px);
+        }
+        return out;
+    }
+
+    std::vector<double> returnsOf(const std::vector<double>& v)
+    {
+        std::vector<double> out;
+        for (std::size_t i = 1; i < v.size(); ++i)
+            out.push_back(v[i] / v[i - 1] - 1.0);
+        return out;
+    }
+} // namespace
+
+TEST(OnlineStatisticsTest, RunningMomentsMatchTwoPassComputation)
+{
+    const auto R = returnsOf(walk(1'000));
+    RunningMoments m;
+    for (double x : R)
+        m.push(x);
+
+    const double MEAN = std::accumulate(R.begin(), R.end(), 0.0) / static_cast<double>(R.size());
+    double sumsq = 0.0;
+    for (double x : R)
+        sumsq += (x - MEAN) * (x - MEAN);
+
+    EXPECT_EQ(m.count(), R.size());
+    EXPECT_NEAR(m.mean(), MEAN, 1e-15);
+    EXPECT_NEAR(m.variance(), sumsq / static_cast<double>(R.size() - 1), 1e-15);
+
+    RunningMoments one;
+    one.push(3.0);
+    EXPECT_EQ(one.variance(), 0.0);
+}
+
+TEST(OnlineStatisticsTest, ChunkMergesMatchSinglePass)
+{
+    const auto V = walk(999);
+    const auto R = returnsOf(V);
+
+    RunningMoments m_all;
+    DownsideDeviation d_all;
+    DrawdownTracker dd_all;
+    HitCounter h_all;
+    for (double x : R)
+    {
+        m_all.push(x);
+        d_all.push(x);
+        h_all.push(x);
+    }
+    for (double x : V)
+        dd_all.push(x);
+
+    // Uneven chunks, merged left to right (the drawdown merge is order-sensitive).
+    const std::vector<std::size_t> CUTS{0, 1, 17, 400, 401, 998};
+    RunningMoments m;
+    DownsideDeviation d;
+    DrawdownTracker dd;
+    HitCounter h;
+    for (std::size_t c = 0; c < CUTS.size(); ++c)
+    {
+        const bool LAST = c + 1 == CUTS.size();
+        const std::size_t B = CUTS[c];
+        const std::size_t E = LAST ? R.size() : CUTS[c + 1];
+        RunningMoments mc;
+        DownsideDeviation dc;
+        HitCounter hc;
+        DrawdownTracker ddc;
+        for (std::size_t i = B; i < E; ++i)
+        {
+            mc.push(R[i]);
+            dc.push(R[i]);
+            hc.push(R[i]);
+        }
+        for (std::size_t i = B; i < (LAST ? V.size() : E); ++i)
+            ddc.push(V[i]);
+        m.merge(mc);
+        d.merge(dc);
+        h.merge(hc);
+        dd.merge(ddc);
+    }
+
+    EXPECT_EQ(m.count(), m_all.count());
+    EXPECT_NEAR(m.mean(), m_all.mean(), 1e-15);
+    EXPECT_NEAR(m.variance(), m_all.variance(), 1e-15);
+    EXPECT_EQ(d.count(), d_all.count());
+    EXPECT_NEAR(d.value(), d_all.value(), 1e-15);
+    EXPECT_EQ(h.wins(), h_all.wins());
+    EXPECT_EQ(h.count(), h_all.count());
+    EXPECT_EQ(dd.count(), dd_all.count());
+    EXPECT_EQ(dd.peak(), dd_all.peak());
+    EXPECT_EQ(dd.maxDrawdown(), dd_all.maxDrawdown());
+}
+
+TEST(OnlineStatisticsTest, DrawdownMergeSpansChunkBoundary)
+{
+    // The worst drawdown runs from the peak of the first chunk to the trough of the second.
+    DrawdownTracker a, b;
+    for (double x : {100.0, 120.0, 110.0})
+        a.push(x);
+    for (double x : {115.0, 60.0, 130.0})
+        b.push(x);
+    EXPECT_NEAR(b.maxDrawdown(), (115.0 - 60.0) / 115.0, 1e-15);
+
+    a.merge(b);
+    EXPECT_NEAR(a.maxDrawdown(), 0.5, 1e-15);
+    EXPECT_EQ(a.peak(), 130.0);
+    EXPECT_EQ(a.count(), 6u);
+}
+
+TEST(OnlineStatisticsTest, RatiosMatchBatchStatistics)
+{
+    const auto R = returnsOf(walk(500));
+    const double RF_ANNUAL = 0.02, PERIODS = 252.0;
+
+    RunningMoments m;
+    DownsideDeviation d(RF_ANNUAL / PERIODS);
+    HitCounter h;
+    for (double x : R)
+    {
+        m.push(x);
+        d.push(x);
+        h.push(x);
+    }
+
+    EXPECT_NEAR(sharpeRatio(m, RF_ANNUAL, PERIODS), Statistics::sharpeRatio(R, RF_ANNUAL, PERIODS), 1e-12);
+    EXPECT_NEAR(sortinoRatio(m, d), Statistics::sortinoRatio(R, RF_ANNUAL, PERIODS), 1e-12);
+    EXPECT_DOUBLE_EQ(h.ratio(), Statistics::hitRatio(R));
+
+    const auto V = walk(500);
+    DrawdownTracker dd;
+    for (double x : V)
+        dd.push(x);
+    EXPECT_DOUBLE_EQ(dd.maxDrawdown(), Statistics::maxDrawdown(V));
+
+    EXPECT_EQ(sharpeRatio(RunningMoments{}), 0.0);
+    EXPECT_EQ(sharpeRatio(m, 0.0, 0.0), 0.0);
+    EXPECT_EQ(sortinoRatio(m, DownsideDeviation(-1.0)), 0.0);  // no downside
+    EXPECT_THROW(d.merge(DownsideDeviation(0.0)), std::invalid_argument);
+}
+
+TEST(OnlineStatisticsTest, EngineMetricsLevelMatchesFullCurve)
+{
+    const auto SERIES = testlib::makeSeries(walk(5'000));
+    const ExecParams EXEC{1.0, 2.0, 3.0};
+
+    qga::strategy::MACrossover full_strat(5, 30);
+    const auto FULL = Engine(10'000.0, EXEC, RecordLevel::Full).run(SERIES, full_strat);
+    ASSERT_EQ(FULL.equity_curve_.size(), SERIES.size());
+
+    // Reference metrics from the stored curve, including the initial equity.
+    std::vector<double> curve{10'000.0};
+    curve.insert(curve.end(), FULL.equity_curve_.begin(), FULL.equity_curve_.end());
+    const auto R = returnsOf(curve);
+    const double MEAN = std::accumulate(R.begin(), R.end(), 0.0) / static_cast<double>(R.size());
+    std::vector<double> pnl;
+    for (const auto& t : FULL.trades_)
+        pnl.push_back(t.pnl_);
+    ASSERT_FALSE(pnl.empty());
+
+    const Engine metrics(10'000.0, EXEC, RecordLevel::Metrics);
+    qga::strategy::MACrossover a(5, 30), b(5, 30), c(5, 30);
+    const std::vector<BacktestResult> RESULTS{
+        metrics.run(SERIES, static_cast<qga::strategy::IStrategy&>(a)),
+        metrics.run(SERIES, b),  // static dispatch
+        metrics.runVectorized(SERIES, c),
+    };
+
+    for (const auto& r : RESULTS)
+    {
+        EXPECT_TRUE(r.trades_.empty());
+        EXPECT_TRUE(r.equity_curve_.empty());
+        EXPECT_EQ(r.final_equity_, FULL.final_equity_);
+        EXPECT_EQ(r.max_drawdown_, FULL.max_drawdown_);
+        EXPECT_EQ(r.max_drawdown_, *std::max_element(FULL.drawdown_.begin(), FULL.drawdown_.end()));
+        EXPECT_EQ(r.returns_.count(), R.size());
+        EXPECT_NEAR(r.returns_.mean(), MEAN, 1e-15);
+        EXPECT_NEAR(sharpeRatio(r.returns_), Statistics::sharpeRatio(R, 0.0, 1.0), 1e-12);
+        EXPECT_NEAR(sortinoRatio(r.returns_, r.downside_), Statistics::sortinoRatio(R, 0.0, 1.0), 1e-12);
+        EXPECT_EQ(r.hits_.count(), pnl.size());
+        EXPECT_DOUBLE_EQ(r.hits_.ratio(), Statistics::hitRatio(pnl));
+
+        // All paths fold the same bars in the same order.
+        EXPECT_EQ(r.returns_.mean(), FULL.returns_.mean());
+        EXPECT_EQ(r.returns_.variance(), FULL.returns_.variance());
+        EXPECT_EQ(r.downside_.value(), FULL.downside_.value());
+    }
+}
+
+TEST(OnlineStatisticsTest, ReturnsSkipNonPositiveBase)
+{
+    // Zero initial equity: no return is defined until the equity turns positive.
+    BacktestResult r;
+    detail::CurveRecorder from_zero(0.0);
+    for (double e : {0.0, 100.0, 110.0})
+        from_zero.mark(e, r);
+    EXPECT_EQ(r.returns_.count(), 1u);
+    EXPECT_NEAR(r.returns_.mean(), 0.1, 1e-15);
+
+    // A wiped-out account records the -100% bar, then nothing until it recovers.
+    BacktestResult wiped;
+    detail::CurveRecorder rec(100.0);
+    for (double e : {50.0, 0.0, 0.0, -5.0, 20.0})
+        rec.mark(e, wiped);
+    EXPECT_EQ(wiped.returns_.count(), 2u);
+    EXPECT_TRUE(std::isfinite(wiped.returns_.mean()));
+    EXPECT_TRUE(std::isfinite(sharpeRatio(wiped.returns_)));
+    EXPECT_TRUE(std::isfinite(sortinoRatio(wiped.returns_, wiped.downside_)));
+    EXPECT_EQ(wiped.max_drawdown_, 1.05);
+
+    qga::strategy::MACrossover strat(5, 30);
+    const auto BROKE = Engine(0.0, ExecParams{}, RecordLevel::Metrics).run(testlib::makeSeries(walk(200)), strat);
+    EXPECT_EQ(BROKE.returns_.count(), 0u);
+    EXPECT_EQ(sharpeRatio(BROKE.returns_), 0.0);
+}
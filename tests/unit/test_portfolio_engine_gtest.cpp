@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "domain/backtest/Engine.hpp"
+#include "domain/backtest/PortfolioEngine.hpp"
+#include "strategy/MACrossover.hpp"
+#include "test_helpers.hpp"
+
+using namespace qga::domain;
+using namespace qga::domain::backtest;
+
+namespace
+{
+    Instrument equity(const std::string& symbol)
+    {
+        return Instrument{symbol, AssetClass::Equity, "XNAS"};
+    }
+
+    /// Records the event order and optionally fires scripted orders.
+    class RecordingStrategy : public IPortfolioStrategy
+    {
+      public:
+        std::vector<std::pair<std::size_t, std::int64_t>> events_;
+        std::vector<std::pair<std::size_t, OrderRequest>> script_;  ///< (event number, order)
+        std::vector<Trade> fills_;
+
+        void onBar(std::size_t instrument, const Quote& q, std::vector<OrderRequest>& orders) override
+        {
+            for (const auto& [at, order] : script_)
+                if (at == events_.size())
+                    orders.push_back(order);
+            events_.emplace_back(instrument, q.ts_);
+        }
+        void onFill(std::size_t, const Trade& t) override { fills_.push_back(t); }
+    };
+} // namespace
+
+TEST(PortfolioEngineTest, MergesFeedsByTimestampWithStableTies)
+{
+    const auto a = testlib::makeSeries({1, 2, 3}, 0, 20);       // 0, 20, 40
+    const auto b = testlib::makeSeries({1, 2, 3}, 10, 10);      // 10, 20, 30
+    const auto c = testlib::makeSeries({1}, 20, 1);             // 20
+    const std::vector<InstrumentFeed> feeds{{equity("A"), &a}, {equity("B"), &b}, {equity("C"), &c}};
+
+    CloseExecution exec;
+    RecordingStrategy strat;
+    PortfolioEngine(1'000.0, exec).run(feeds, strat);
+
+    const std::vector<std::pair<std::size_t, std::int64_t>> expected{
+        {0, 0}, {1, 10}, {0, 20}, {1, 20}, {2, 20}, {1, 30}, {0, 40}};
+    EXPECT_EQ(strat.events_, expected);
+}
+
+TEST(PortfolioEngineTest, SingleInstrumentMatchesEngine)
+{
+    const auto bars = testlib::wavySeries(2'000, {.base_ = 50.0, .amplitude_ = 5.0, .period_ = 9.0});
+    const ExecParams params{1.0, 3.0, 2.0};
+    const std::vector<InstrumentFeed> feeds{{equity("AAPL"), &bars}};
+
+    std::vector<std::unique_ptr<qga::strategy::IStrategy>> per;
+    per.push_back(std::make_unique<qga::strategy::MACrossover>(5, 20));
+    PerInstrumentStrategy strat(std::move(per));
+
+    CloseExecution exec(params);
+    Portfolio pf;
+    const auto r = PortfolioEngine(10'000.0, exec).run(feeds, strat, &pf);
+
+    qga::strategy::MACrossover single(5, 20);
+    const auto expected = Engine(10'000.0, params).run(bars, single);
+
+    ASSERT_GT(expected.trades_executed_, 5);
+    EXPECT_EQ(r.trades_executed_, expected.trades_executed_);
+    EXPECT_NEAR(r.final_equity_, expected.final_equity_, 1e-9);
+    EXPECT_EQ(pf.cash(), r.final_equity_);
+    EXPECT_EQ(pf.getOrCreate(equity("AAPL")).qty(), 0.0);
+}
+
+TEST(PortfolioEngineTest, SharesCashAcrossInstrumentsAndRejectsUnaffordableBuys)
+{
+    const auto a = testlib::makeSeries({60, 70, 80}, 0);
+    const auto b = testlib::makeSeries({50, 40, 30}, 0);
+    const std::vector<InstrumentFeed> feeds{{equity("A"), &a}, {equity("B"), &b}};
+
+    CloseExecution exec(ExecParams{1.0, 0.0, 0.0});
+    RecordingStrategy strat;
+    strat.script_ = {
+        {0, {0, Side::Buy, 1.0}},   // A @ 60 + 1 fee -> cash 39
+        {1, {1, Side::Buy, 1.0}},   // B @ 50: rejected (needs 51)
+        {3, {0, Side::Buy, 1.0}},   // B's bar buys more A at its latest bar (70): rejected
+        {5, {1, Side::Buy, 1.0}},   // B @ 30 + 1 -> cash 8
+    };
+    const auto r = PortfolioEngine(100.0, exec, RecordLevel::Full).run(feeds, strat);
+
+    ASSERT_EQ(strat.fills_.size(), 4u);  // two buys plus two liquidations
+    EXPECT_EQ(strat.fills_[0].price(), 60.0);
+    EXPECT_EQ(strat.fills_[1].price(), 30.0);
+    EXPECT_EQ(r.trades_executed_, 2);
+    // Liquidation: A @ 80 - 1, B @ 30 - 1.
+    EXPECT_DOUBLE_EQ(r.final_equity_, 8.0 + 79.0 + 29.0);
+
+    // One equity point per distinct timestamp, marked after all instruments traded.
+    ASSERT_EQ(r.equity_curve_.size(), 3u);
+    EXPECT_DOUBLE_EQ(r.equity_curve_[0], 39.0 + 60.0);
+    EXPECT_DOUBLE_EQ(r.equity_curve_[1], 39.0 + 70.0);
+    EXPECT_DOUBLE_EQ(r.equity_curve_[2], 8.0 + 80.0 + 30.0);
+    EXPECT_DOUBLE_EQ(r.max_drawdown_, 1.0 / 100.0);
+}
+
+TEST(PortfolioEngineTest, RejectsInvalidInput)
+{
+    const auto a = testlib::makeSeries({1, 2});
+    CloseExecution exec;
+    RecordingStrategy strat;
+
+    const std::vector<InstrumentFeed> missing{{equity("A"), nullptr}};
+    EXPECT_THROW(PortfolioEngine(100.0, exec).run(missing, strat), std::invalid_argument);
+
+    const std::vector<InstrumentFeed> feeds{{equity("A"), &a}};
+    strat.script_ = {{0, {7, Side::Buy, 1.0}}};
+    EXPECT_THROW(PortfolioEngine(100.0, exec).run(feeds, strat), std::out_of_range);
+}
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "strategy/RollingWindow.hpp"
+
+using qga::strategy::RingBuffer;
+using qga::strategy::RollingSum;
+
+TEST(RingBufferTest, KeepsTheLastCapacityElementsOldestFirst)
+{
+    RingBuffer<int> ring(3);
+    int evicted = -1;
+    EXPECT_FALSE(ring.push(1, evicted));
+    EXPECT_FALSE(ring.push(2, evicted));
+    EXPECT_FALSE(ring.full());
+    EXPECT_FALSE(ring.push(3, evicted));
+    EXPECT_TRUE(ring.full());
+
+    EXPECT_TRUE(ring.push(4, evicted));
+    EXPECT_EQ(evicted, 1);
+    EXPECT_TRUE(ring.push(5, evicted));
+    EXPECT_EQ(evicted, 2);
+
+    ASSERT_EQ(ring.size(), 3u);
+    EXPECT_EQ(ring[0], 3);
+    EXPECT_EQ(ring[1], 4);
+    EXPECT_EQ(ring[2], 5);
+    EXPECT_EQ(ring.front(), 3);
+    EXPECT_EQ(ring.back(), 5);
+
+    ring.clear();
+    EXPECT_TRUE(ring.empty());
+    EXPECT_EQ(ring.capacity(), 3u);
+    ring.push(9);
+    EXPECT_EQ(ring.front(), 9);
+    EXPECT_EQ(ring.back(), 9);
+}
+
+TEST(RingBufferTest, ZeroCapacityDropsEverything)
+{
+    RingBuffer<double> ring;
+    double evicted = 0.0;
+    EXPECT_TRUE(ring.push(1.5, evicted));
+    EXPECT_EQ(evicted, 1.5);
+    EXPECT_TRUE(ring.empty());
+    EXPECT_TRUE(ring.full());
+}
+
+TEST(RollingSumTest, SumsTheLastWindowValues)
+{
+    RollingSum<double> sum(4);
+    for (int i = 1; i <= 3; ++i)
+        sum.push(i);
+    EXPECT_FALSE(sum.full());
+    EXPECT_TRUE(std::isnan(sum.mean()));
+    EXPECT_EQ(sum.sum(), 6.0);
+
+    for (int i = 4; i <= 10; ++i)
+        sum.push(i);
+    EXPECT_TRUE(sum.full());
+    EXPECT_EQ(sum.sum(), 7.0 + 8.0 + 9.0 + 10.0);
+    EXPECT_EQ(sum.mean(), 8.5);
+
+    RollingSum<double> never(0);
+    never.push(1.0);
+    EXPECT_FALSE(never.full());
+    EXPECT_TRUE(std::isnan(never.mean()));
+}
+
+TEST(RollingSumTest, CompensationBoundsDriftOverLongStreams)
+{
+    // Large level plus small noise: a plain add/subtract running sum drifts.
+    constexpr std::size_t WINDOW = 50;
+    RollingSum<double> compensated(WINDOW);
+    RingBuffer<double> window(WINDOW);
+    double naive = 0.0;
+    std::uint64_t state = 7;
+
+    double worst_naive = 0.0, worst_compensated = 0.0;
+    for (std::size_t i = 0; i < 2'000'000; ++i)
+    {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        const double X = 1e6 + static_cast<double>(state >> 40) * 1e-7;
+
+        double evicted = 0.0;
+        naive += X;
+        if (window.push(X, evicted))
+            naive -= evicted;
+        compensated.push(X);
+
+        if (i % 100'000 == 99'999)
+        {
+            long double exact = 0.0L;
+            for (std::size_t k = 0; k < window.size(); ++k)
+                exact += window[k];
+            worst_naive = std::max(worst_naive, std::abs(naive - static_cast<double>(exact)));
+            worst_compensated =
+                std::max(worst_compensated, std::abs(compensated.sum() - static_cast<double>(exact)));
+        }
+    }
+    EXPECT_LT(worst_compensated, 1e-8);
+    EXPECT_GT(worst_naive, worst_compensated);
+}
@@ -0,0 +1,420 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <sqlite3.h>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "fixtures/BaseTestFixture.hpp"
+#include "persistence/SQLiteStore.hpp"
+#include "persistence/Statement.hpp"
+#include "persistence/StatementCache.hpp"
+#include "test_helpers.hpp"
+
+using qga::domain::Quote;
+using qga::domain::backtest::BarSeries;
+using qga::persistence::BulkLoadOptions;
+using qga::persistence::QuoteField;
+using qga::persistence::QuoteQuery;
+using qga::persistence::SQLiteStore;
+using qga::persistence::Statement;
+using qga::persistence::StatementCache;
+using namespace qga::tests::fixtures;
+
+namespace
+{
+    std::vector<Quote> ramp(int n, std::int64_t ts0, double px0)
+    {
+        std::vector<Quote> out;
+        for (int i = 0; i < n; ++i)
+            out.push_back(testlib::bar(px0 + i, ts0 + i * 1'000LL, 10.0 + i));
+        return out;
+    }
+
+    void expectSame(const std::vector<Quote>& a, const std::vector<Quote>& b)
+    {
+        ASSERT_EQ(a.size(), b.size());
+        for (std::size_t i = 0; i < a.size(); ++i)
+        {
+            EXPECT_EQ(a[i].ts_, b[i].ts_) << i;
+            EXPECT_EQ(a[i].close_, b[i].close_) << i;
+            EXPECT_EQ(a[i].volume_, b[i].volume_) << i;
+        }
+    }
+} // namespace
+
+class SQLiteStoreTest : public BaseTestFixture
+{
+  protected:
+    std::string tempDb(const std::string& name)
+    {
+        auto p = tempPath(name);
+        std::filesystem::remove(p);
+        trackFile(p + "-wal");
+        trackFile(p + "-shm");
+        return p;
+    }
+};
+
+TEST_F(SQLiteStoreTest, SaveQuotesUpsertsAcrossMultiRowBatches)
+{
+    SQLiteStore store(tempDb("qga_store_upsert.db"));
+
+    // 300 rows: two full multi-row statements plus a remainder.
+    auto quotes = ramp(300, 0, 100.0);
+    store.saveQuotes("AAPL", quotes);
+    store.saveQuotes("MSFT", ramp(5, 0, 1.0));
+
+    // Overwrite one existing bar and append one.
+    store.saveQuotes("AAPL", {testlib::bar(-1.0, 150'000, 7.0), testlib::bar(2.0, 300'000, 1.0)});
+    quotes[150] = testlib::bar(-1.0, 150'000, 7.0);
+    quotes.push_back(testlib::bar(2.0, 300'000, 1.0));
+
+    expectSame(store.loadQuotes("AAPL"), quotes);
+    EXPECT_EQ(store.loadQuotes("MSFT").size(), 5u);
+    EXPECT_TRUE(store.loadQuotes("NONE").empty());
+}
+
+TEST_F(SQLiteStoreTest, BulkLoadMatchesRegularSaves)
+{
+    for (const bool DEFER : {false, true})
+    {
+        SQLiteStore store(tempDb(DEFER ? "qga_store_bulk_deferred.db" : "qga_store_bulk.db"));
+        store.beginBulkLoad(BulkLoadOptions{64, DEFER});
+        EXPECT_TRUE(store.inBulkLoad());
+        EXPECT_THROW(store.beginBulkLoad(), std::logic_error);
+
+        // Out of order across calls, with a duplicate timestamp: the later quote wins.
+        store.saveQuotes("AAPL", ramp(200, 200'000, 300.0));
+        store.saveQuotes("AAPL", ramp(200, 0, 100.0));
+        store.saveQuotes("AAPL", {testlib::bar(42.0, 5'000, 1.0)});
+        store.saveQuotes("MSFT", ramp(3, 0, 1.0));
+        store.endBulkLoad();
+        EXPECT_FALSE(store.inBulkLoad());
+        EXPECT_THROW(store.endBulkLoad(), std::logic_error);
+
+        auto expected = ramp(200, 0, 100.0);
+        const auto TAIL = ramp(200, 200'000, 300.0);
+        expected.insert(expected.end(), TAIL.begin(), TAIL.end());
+        expected[5] = testlib::bar(42.0, 5'000, 1.0);
+        expectSame(store.loadQuotes("AAPL"), expected);
+        EXPECT_EQ(store.loadQuotes("MSFT").size(), 3u);
+    }
+}
+
+TEST_F(SQLiteStoreTest, UnfinishedBulkLoadIsRolledBack)
+{
+    const auto path = tempDb("qga_store_bulk_abort.db");
+    {
+        SQLiteStore store(path);
+        store.saveQuotes("AAPL", ramp(3, 0, 1.0));
+        store.beginBulkLoad();
+        store.saveQuotes("AAPL", ramp(10, 100'000, 1.0));
+        store.saveQuotes("NEW", ramp(10, 0, 1.0));
+    }
+
+    SQLiteStore store(path);
+    EXPECT_EQ(store.loadQuotes("AAPL").size(), 3u);
+    EXPECT_TRUE(store.loadQuotes("NEW").empty());
+    store.saveQuotes("NEW", ramp(2, 0, 1.0));  // the symbol id cache did not keep the rolled-back row
+    EXPECT_EQ(store.loadQuotes("NEW").size(), 2u);
+}
+
+TEST_F(SQLiteStoreTest, WriteBatchKeepsCallsAroundAFailedOne)
+{
+    const auto path = tempDb("qga_store_write_batch.db");
+    SQLiteStore store(path);
+    store.saveBarSeries("BAD", "1m", testlib::makeSeries({1.0, 2.0}));
+    {
+        sqlite3* raw = nullptr;
+        ASSERT_EQ(sqlite3_open(path.c_str(), &raw), SQLITE_OK);
+        Statement::execDdl(raw, "UPDATE bar_chunks SET data = x'01';");  // merging into it must fail
+        sqlite3_close(raw);
+    }
+
+    store.beginWriteBatch();
+    EXPECT_THROW(store.beginBulkLoad(), std::logic_error);
+    store.saveQuotes("NEW", ramp(3, 0, 1.0));
+    EXPECT_THROW(store.saveBarSeries("BAD", "1m", testlib::makeSeries({3.0})), std::runtime_error);
+    store.saveQuotes("AAPL", ramp(2, 0, 1.0));
+    EXPECT_TRUE(store.loadQuotes("NEW").empty());  // not visible before the commit
+    store.commitWriteBatch();
+
+    EXPECT_EQ(store.loadQuotes("NEW").size(), 3u);
+    EXPECT_EQ(store.loadQuotes("AAPL").size(), 2u);
+    EXPECT_THROW(store.commitWriteBatch(), std::logic_error);
+
+    store.beginWriteBatch();
+    store.saveQuotes("GONE", ramp(3, 0, 1.0));
+    store.rollbackWriteBatch();
+    EXPECT_TRUE(store.loadQuotes("GONE").empty());
+    store.saveQuotes("GONE", ramp(1, 0, 1.0));
+    EXPECT_EQ(store.loadQuotes("GONE").size(), 1u);
+}
+
+TEST_F(SQLiteStoreTest, MigratesTextKeyedQuotesTable)
+{
+    const auto path = tempDb("qga_store_legacy.db");
+    {
+        sqlite3* db = nullptr;
+        ASSERT_EQ(sqlite3_open(path.c_str(), &db), SQLITE_OK);
+        Statement::execDdl(db,
+                           "CREATE TABLE quotes(symbol TEXT NOT NULL, ts INTEGER NOT NULL,"
+                           " open REAL NOT NULL, high REAL NOT NULL, low REAL NOT NULL,"
+                           " close REAL NOT NULL, volume REAL NOT NULL, PRIMARY KEY(symbol, ts));"
+                           "INSERT INTO quotes VALUES ('AAPL', 2000, 1, 1, 1, 2, 5),"
+                           " ('AAPL', 1000, 1, 1, 1, 1, 5), ('MSFT', 1000, 3, 3, 3, 3, 5);");
+        sqlite3_close(db);
+    }
+
+    SQLiteStore store(path);
+    const auto AAPL = store.loadQuotes("AAPL");
+    ASSERT_EQ(AAPL.size(), 2u);
+    EXPECT_EQ(AAPL[0].ts_, 1000);
+    EXPECT_EQ(AAPL[1].close_, 2.0);
+    EXPECT_EQ(store.loadQuotes("MSFT").size(), 1u);
+
+    store.saveQuotes("MSFT", {testlib::bar(4.0, 2000)});
+    EXPECT_EQ(store.loadQuotes("MSFT").size(), 2u);
+}
+
+TEST_F(SQLiteStoreTest, StatementCachePreparesEachSqlOnce)
+{
+    sqlite3* db = nullptr;
+    ASSERT_EQ(sqlite3_open(":memory:", &db), SQLITE_OK);
+    {
+        StatementCache cache(db);
+        const std::string SQL = "SELECT ?1 * 2;";
+        Statement* first = nullptr;
+        for (int i = 0; i < 3; ++i)
+        {
+            // Stopping mid-result is fine: the lease resets the statement.
+            auto st = cache.acquire(SQL);
+            if (!first)
+                first = &*st;
+            EXPECT_EQ(&*st, first);
+            st->bindInt(1, i);
+            ASSERT_TRUE(st->stepRow());
+            EXPECT_EQ(st->getColumnInt(0), 2 * i);
+        }
+        EXPECT_EQ(cache.size(), 1u);
+
+        EXPECT_THROW(cache.acquire("SELECT FROM;"), std::runtime_error);
+        EXPECT_EQ(cache.size(), 1u);
+        cache.erase(SQL);
+        EXPECT_EQ(cache.size(), 0u);
+    }
+    EXPECT_EQ(sqlite3_close(db), SQLITE_OK);  // every statement was finalized
+}
+
+TEST_F(SQLiteStoreTest, ParallelLoadsUseTheirOwnConnections)
+{
+    constexpr int SYMBOLS = 4, THREADS = 16, LOADS = 20;
+    SQLiteStore store(tempDb("qga_store_parallel.db"));
+    for (int s = 0; s < SYMBOLS; ++s)
+        store.saveQuotes("S" + std::to_string(s), ramp(500 + s, 0, 10.0 * s));
+
+    std::vector<int> failures(THREADS, 0);
+    std::vector<std::thread> pool;
+    for (int t = 0; t < THREADS; ++t)
+    {
+        pool.emplace_back([&, t] {
+            for (int i = 0; i < LOADS; ++i)
+            {
+                const int S = (t + i) % SYMBOLS;
+                const auto Q = store.loadQuotes("S" + std::to_string(S));
+                if (Q.size() != static_cast<std::size_t>(500 + S) || Q.back().close_ != 10.0 * S + 499 + S)
+                    ++failures[t];
+            }
+        });
+    }
+    // A writer next to the readers, which see committed data only.
+    store.saveQuotes("NEW", ramp(7, 0, 1.0));
+    for (auto& th : pool)
+        th.join();
+
+    for (int t = 0; t < THREADS; ++t)
+        EXPECT_EQ(failures[t], 0) << "thread " << t;
+    EXPECT_EQ(store.loadQuotes("NEW").size(), 7u);
+}
+
+TEST_F(SQLiteStoreTest, InMemoryStoreReadsThroughItsConnection)
+{
+    // Each connection to ":memory:" would see a database of its own.
+    SQLiteStore store(":memory:");
+    store.saveQuotes("AAPL", ramp(10, 0, 1.0));
+
+    std::size_t loaded = 0;
+    std::thread reader([&] { loaded = store.loadQuotes("AAPL").size(); });
+    reader.join();
+    EXPECT_EQ(loaded, 10u);
+}
+
+TEST_F(SQLiteStoreTest, QuoteQueriesSelectWindowLimitAndColumns)
+{
+    SQLiteStore store(tempDb("qga_store_query.db"));
+    const auto ALL = ramp(1'000, 0, 100.0);  // ts = 0, 1000, ..., 999000
+    store.saveQuotes("AAPL", ALL);
+    store.saveQuotes("MSFT", ramp(10, 0, 1.0));
+
+    auto window = [](std::int64_t from, std::int64_t to, std::size_t limit = 0, bool last = false) {
+        QuoteQuery q;
+        q.from_ts_ = from;
+        q.to_ts_ = to;
+        q.limit_ = limit;
+        q.last_ = last;
+        return q;
+    };
+    auto slice = [&](std::size_t first, std::size_t n) {
+        return std::vector<Quote>(ALL.begin() + first, ALL.begin() + first + n);
+    };
+
+    expectSame(store.loadQuotes("AAPL", window(10'000, 20'000)), slice(10, 10));  // [from, to)
+    expectSame(store.loadQuotes("AAPL", window(10'500, 20'001)), slice(11, 10));
+    expectSame(store.loadQuotes("AAPL", window(0, 1'000'000, 5)), slice(0, 5));
+    expectSame(store.loadQuotes("AAPL", window(0, 500'000, 5, true)), slice(495, 5));
+    expectSame(store.loadQuotes("AAPL", window(0, 3'000, 5, true)), slice(0, 3));  // fewer than the limit
+    EXPECT_TRUE(store.loadQuotes("AAPL", window(20'000, 10'000)).empty());
+    EXPECT_TRUE(store.loadQuotes("NONE", window(0, 10'000)).empty());
+    EXPECT_EQ(store.loadQuotes("MSFT", QuoteQuery{}).size(), 10u);
+
+    QuoteQuery closes;
+    closes.fields_ = QuoteField::Close | QuoteField::Volume;
+    const auto C = store.loadQuotes("AAPL", closes);
+    ASSERT_EQ(C.size(), ALL.size());
+    EXPECT_EQ(C[7].ts_, ALL[7].ts_);
+    EXPECT_EQ(C[7].close_, ALL[7].close_);
+    EXPECT_EQ(C[7].volume_, ALL[7].volume_);
+    EXPECT_EQ(C[7].open_, 0.0);
+    EXPECT_EQ(C[7].high_, 0.0);
+}
+
+TEST_F(SQLiteStoreTest, QuoteCursorStreamsWindowIntoBatches)
+{
+    for (const char* path : {"qga_store_cursor.db", ":memory:"})
+    {
+        SQLiteStore store(path[0] == ':' ? std::string(path) : tempDb(path));
+        const auto ALL = ramp(1'000, 0, 100.0);
+        store.saveQuotes("AAPL", ALL);
+
+        QuoteQuery q;
+        q.from_ts_ = 100'000;
+        q.limit_ = 250;
+        q.last_ = true;
+        auto cursor = store.openQuotes("AAPL", q);
+
+        BarSeries batch;
+        std::vector<Quote> streamed;
+        std::size_t batches = 0;
+        while (cursor->next(batch, 64))
+        {
+            EXPECT_LE(batch.size(), 64u);
+            for (std::size_t i = 0; i < batch.size(); ++i)
+                streamed.push_back(batch[i]);
+            ++batches;
+        }
+        EXPECT_TRUE(batch.empty());
+        EXPECT_FALSE(cursor->next(batch, 64));
+        EXPECT_EQ(batches, 4u);
+        expectSame(streamed, std::vector<Quote>(ALL.end() - 250, ALL.end()));
+
+        // Whole history, batch size dividing it exactly.
+        auto all = store.openQuotes("AAPL");
+        std::size_t n = 0;
+        while (all->next(batch, 500))
+            n += batch.size();
+        EXPECT_EQ(n, ALL.size());
+        EXPECT_FALSE(store.openQuotes("NONE")->next(batch, 10));
+    }
+}
+
+TEST_F(SQLiteStoreTest, BarSeriesRoundTripsAcrossDailyChunks)
+{
+    const auto path = tempDb("qga_store_bars.db");
+    constexpr std::int64_t DAY = 86'400'000;
+    BarSeries bars;
+    for (std::size_t i = 0; i < 3 * 1'440; ++i)
+        bars.add(testlib::bar(100.0 + static_cast<double>(i % 50) * 0.25, static_cast<std::int64_t>(i) * 60'000,
+                              static_cast<double>(i)));
+
+    {
+        SQLiteStore store(path);
+        store.saveBarSeries("AAPL", "1m", bars);
+        store.saveBarSeries("AAPL", "1h", testlib::makeSeries({1.0, 2.0, 3.0}));
+    }
+
+    SQLiteStore store(path);
+    const auto LOADED = store.loadBarSeries("AAPL", "1m");
+    ASSERT_EQ(LOADED.size(), bars.size());
+    for (std::size_t i = 0; i < bars.size(); i += 97)
+    {
+        EXPECT_EQ(LOADED[i].ts_, bars[i].ts_) << i;
+        EXPECT_EQ(LOADED[i].close_, bars[i].close_) << i;
+        EXPECT_EQ(LOADED[i].volume_, bars[i].volume_) << i;
+    }
+    EXPECT_EQ(store.loadBarSeries("AAPL", "1h").size(), 3u);
+    EXPECT_TRUE(store.loadBarSeries("AAPL", "5m").empty());
+    EXPECT_TRUE(store.loadBarSeries("NONE", "1m").empty());
+
+    // One chunk per UTC day.
+    sqlite3* db = nullptr;
+    ASSERT_EQ(sqlite3_open(path.c_str(), &db), SQLITE_OK);
+    {
+        Statement st{db, "SELECT COUNT(*), SUM(bar_count), SUM(length(data)) FROM bar_chunks WHERE timeframe = '1m';"};
+        ASSERT_TRUE(st.stepRow());
+        EXPECT_EQ(st.getColumnInt64(0), 3);
+        EXPECT_EQ(st.getColumnInt64(1), static_cast<sqlite3_int64>(bars.size()));
+        EXPECT_LT(st.getColumnInt64(2), static_cast<sqlite3_int64>(bars.size() * 48 / 3));
+    }
+    sqlite3_close(db);
+
+    // Window across a chunk boundary, close-only, and the latest bars.
+    QuoteQuery window;
+    window.from_ts_ = DAY - 5 * 60'000;
+    window.to_ts_ = DAY + 5 * 60'000;
+    window.fields_ = QuoteField::Close;
+    const auto W = store.loadBarSeries("AAPL", "1m", window);
+    ASSERT_EQ(W.size(), 10u);
+    EXPECT_EQ(W.front().ts_, window.from_ts_);
+    EXPECT_EQ(W.end().close_, bars[1'444].close_);
+    EXPECT_EQ(W.front().open_, 0.0);
+
+    QuoteQuery tail;
+    tail.limit_ = 1'500;
+    tail.last_ = true;
+    const auto T = store.loadBarSeries("AAPL", "1m", tail);
+    ASSERT_EQ(T.size(), 1'500u);
+    EXPECT_EQ(T.front().ts_, bars[bars.size() - 1'500].ts_);
+    EXPECT_EQ(T.end().ts_, bars.end().ts_);
+
+    QuoteQuery head;
+    head.limit_ = 3;
+    EXPECT_EQ(store.loadBarSeries("AAPL", "1m", head).end().ts_, 120'000);
+}
+
+TEST_F(SQLiteStoreTest, SaveBarSeriesMergesIntoStoredChunks)
+{
+    SQLiteStore store(tempDb("qga_store_bars_merge.db"));
+    store.saveBarSeries("AAPL", "1d", testlib::makeSeries({1.0, 2.0, 3.0, 4.0}));  // one bar per minute
+
+    BarSeries update;
+    update.add(testlib::bar(20.0, 60'000));
+    update.add(testlib::bar(35.0, 210'000));
+    store.saveBarSeries("AAPL", "1d", update);
+
+    const auto BARS = store.loadBarSeries("AAPL", "1d");
+    ASSERT_EQ(BARS.size(), 5u);
+    EXPECT_EQ(BARS[1].close_, 20.0);
+    EXPECT_EQ(BARS[3].ts_, 180'000);
+    EXPECT_EQ(BARS[4].close_, 35.0);
+
+    BarSeries unsorted;
+    unsorted.add(testlib::bar(1.0, 120'000));
+    unsorted.add(testlib::bar(1.0, 120'000));
+    EXPECT_THROW(store.saveBarSeries("AAPL", "1d", unsorted), std::invalid_argument);
+    EXPECT_THROW(store.saveBarSeries("AAPL", "1y", update), std::invalid_argument);
+    EXPECT_THROW(store.loadBarSeries("AAPL", "m"), std::invalid_argument);
+    EXPECT_EQ(store.loadBarSeries("AAPL", "1d").size(), 5u);
+}
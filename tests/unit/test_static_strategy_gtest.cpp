@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <vector>
+
+#include "domain/backtest/Engine.hpp"
+#include "strategy/BuyHold.hpp"
+#include "strategy/Combinators.hpp"
+#include "strategy/MACrossover.hpp"
+#include "test_helpers.hpp"
+
+using namespace qga::domain::backtest;
+using namespace qga::strategy;
+
+namespace
+{
+    constexpr testlib::Wave WAVE{.period_ = 30.0, .ripple_ = 2.0, .ripple_period_ = 4.0,
+                                 .volume_ = 100.0, .spike_volume_ = 5'000.0, .spike_every_ = 3};
+
+    /// Static strategy replaying a fixed script.
+    class Script
+    {
+      public:
+        explicit Script(std::vector<Signal> s) : script_(std::move(s)) {}
+        void onStart() { pos_ = 0; }
+        Signal signalAt(const qga::domain::BarColumns&, std::size_t) { return script_[pos_++]; }
+
+      private:
+        std::vector<Signal> script_;
+        std::size_t pos_ = 0;
+    };
+
+    template <StaticStrategy S>
+    std::vector<Signal> replay(S s, std::size_t n)
+    {
+        const auto series = testlib::makeSeries(std::vector<double>(n, 1.0));
+        std::vector<Signal> out;
+        s.onStart();
+        for (std::size_t i = 0; i < n; ++i)
+            out.push_back(s.signalAt(series.columns(), i));
+        return out;
+    }
+
+    void expectSameResult(const BacktestResult& a, const BacktestResult& b)
+    {
+        EXPECT_EQ(a.final_equity_, b.final_equity_);
+        EXPECT_EQ(a.trades_executed_, b.trades_executed_);
+        EXPECT_EQ(a.equity_curve_, b.equity_curve_);
+        EXPECT_EQ(a.drawdown_, b.drawdown_);
+        EXPECT_EQ(a.trades_.size(), b.trades_.size());
+    }
+
+    constexpr Signal N = Signal::None;
+    constexpr Signal B = Signal::Buy;
+    constexpr Signal S = Signal::Sell;
+} // namespace
+
+TEST(StaticStrategyTest, TemplatedRunMatchesVirtualRunBitForBit)
+{
+    const auto series = testlib::wavySeries(5'000, WAVE);
+    for (auto level : {RecordLevel::Summary, RecordLevel::Full})
+    {
+        const Engine engine(10'000.0, ExecParams{0.5, 1.0, 2.0}, level);
+
+        MACrossover stat(5, 30), virt(5, 30);
+        const auto a = engine.run(series, stat);  // static overload
+        const auto b = engine.run(series, static_cast<IStrategy&>(virt));
+        expectSameResult(a, b);
+        EXPECT_GT(a.trades_executed_, 0);
+
+        BuyHold bh_stat, bh_virt;
+        expectSameResult(engine.run(series, bh_stat), engine.run(series, static_cast<IStrategy&>(bh_virt)));
+    }
+}
+
+TEST(StaticStrategyTest, CombinatorSignalSemantics)
+{
+    const Script a({B, B, S, S, N, B});
+    const Script b({B, S, S, N, N, N});
+
+    EXPECT_EQ(replay(And(a, b), 6), (std::vector<Signal>{B, N, S, N, N, N}));
+    EXPECT_EQ(replay(Or(a, b), 6), (std::vector<Signal>{B, N, S, S, N, B}));
+    EXPECT_EQ(replay(Not(a), 6), (std::vector<Signal>{S, S, B, B, N, S}));
+}
+
+TEST(StaticStrategyTest, FilterGatesEntriesOnly)
+{
+    // Volume 5000 on bars 0, 3, 6, ...; 100 elsewhere.
+    const auto series = testlib::wavySeries(6, WAVE);
+    Filtered rule(Script({B, B, S, B, S, S}), VolumeFilter(1'000.0));
+    rule.onStart();
+    std::vector<Signal> out;
+    for (std::size_t i = 0; i < series.size(); ++i)
+        out.push_back(rule.signalAt(series.columns(), i));
+    EXPECT_EQ(out, (std::vector<Signal>{B, N, S, B, S, S}));
+}
+
+TEST(StaticStrategyTest, CompositeRunsTheSameThroughBothEnginePaths)
+{
+    const auto series = testlib::wavySeries(5'000, WAVE);
+    const Engine engine(10'000.0, ExecParams{0.5, 1.0, 2.0}, RecordLevel::Full);
+
+    auto rule = Filtered(Or(MACrossover(5, 30), Not(MACrossover(10, 60))), VolumeFilter(1'000.0));
+    VirtualStrategy virt(rule);
+
+    const auto a = engine.run(series, rule);
+    const auto b = engine.run(series, static_cast<IStrategy&>(virt));
+    expectSameResult(a, b);
+    EXPECT_GT(a.trades_executed_, 0);
+
+    // The wrapper's onBar path agrees with its block path.
+    virt.onStart();
+    VirtualStrategy again(rule);
+    again.onStart();
+    std::vector<Signal> block(series.size());
+    again.onBars(series.columns(), block);
+    for (std::size_t i = 0; i < series.size(); ++i)
+        ASSERT_EQ(virt.onBar(series[i]), block[i]) << "i=" << i;
+}
@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <vector>
+
+#include "core/Statistics.hpp"
+
+using qga::core::Statistics;
+
+namespace
+{
+    /// Deterministic values in [lo, hi), converted to T.
+    template <typename T> std::vector<T> sample(std::size_t n, double lo, double hi)
+    {
+        std::vector<T> out;
+        std::uint64_t state = n + 1;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            const double U = static_cast<double>(state >> 11) / 9007199254740992.0;
+            out.push_back(static_cast<T>(lo + U * (hi - lo)));
+        }
+        return out;
+    }
+
+    double twoPassStdDev(const std::vector<double>& v)
+    {
+        const double MEAN = std::accumulate(v.begin(), v.end(), 0.0) / static_cast<double>(v.size());
+        double sumsq = 0.0;
+        for (double x : v)
+            sumsq += (x - MEAN) * (x - MEAN);
+        return std::sqrt(sumsq / static_cast<double>(v.size() - 1));
+    }
+
+    double sortedMedian(std::vector<double> v)
+    {
+        std::sort(v.begin(), v.end());
+        const std::size_t N = v.size();
+        return N % 2 == 0 ? (v[N / 2 - 1] + v[N / 2]) / 2.0 : v[N / 2];
+    }
+
+    template <typename T> void checkAgainstReference(std::size_t n, double lo, double hi)
+    {
+        const auto V = sample<T>(n, lo, hi);
+        const std::vector<double> D(V.begin(), V.end());
+        const double SCALE = std::max(std::abs(lo), std::abs(hi));
+        const std::span<const T> S(V);
+
+        const double MEAN = std::accumulate(D.begin(), D.end(), 0.0) / static_cast<double>(n);
+        EXPECT_NEAR(*Statistics::calculateMean(S), MEAN, 1e-12 * SCALE) << n;
+        EXPECT_EQ(*Statistics::calculateMin(S), *std::min_element(V.begin(), V.end())) << n;
+        EXPECT_EQ(*Statistics::calculateMax(S), *std::max_element(V.begin(), V.end())) << n;
+        EXPECT_EQ(*Statistics::calculateMedian(S), sortedMedian(D)) << n;
+
+        const auto SUMMARY = Statistics::summarize(S);
+        ASSERT_TRUE(SUMMARY.has_value());
+        EXPECT_EQ(SUMMARY->count, n);
+        EXPECT_NEAR(SUMMARY->mean, MEAN, 1e-12 * SCALE) << n;
+        EXPECT_EQ(SUMMARY->min, static_cast<double>(*std::min_element(V.begin(), V.end())));
+        EXPECT_EQ(SUMMARY->max, static_cast<double>(*std::max_element(V.begin(), V.end())));
+        if (n >= 2)
+        {
+            const double SD = twoPassStdDev(D);
+            EXPECT_NEAR(*Statistics::calculateStdDev(S), SD, 1e-9 * SD) << n;
+            EXPECT_NEAR(SUMMARY->stddev, SD, 1e-9 * SD) << n;
+        }
+    }
+
+    /// True if the basic statistics accept a vector and a span of T.
+    template <typename T>
+    constexpr bool ACCEPTED = requires(const std::vector<T>& v, std::span<const T> s) {
+        Statistics::calculateMean(v);
+        Statistics::calculateMedian(v);
+        Statistics::summarize(s);
+    };
+
+    // Only the types instantiated in Statistics.cpp compile; anything else
+    // used to pass the old is_arithmetic constraint and fail at link time.
+    static_assert(ACCEPTED<int> && ACCEPTED<std::int64_t> && ACCEPTED<float> && ACCEPTED<double>);
+    static_assert(!ACCEPTED<unsigned> && !ACCEPTED<std::size_t> && !ACCEPTED<short> && !ACCEPTED<long double>);
+    static_assert(!ACCEPTED<bool> && !ACCEPTED<char>);
+} // namespace
+
+TEST(StatisticsBasicTest, MatchesReferenceForEveryInstantiatedType)
+{
+    // Sizes around the accumulator width exercise the tail handling.
+    for (std::size_t n : {1u, 2u, 7u, 8u, 9u, 16u, 1'001u})
+    {
+        checkAgainstReference<int>(n, -1'000.0, 1'000.0);
+        checkAgainstReference<std::int64_t>(n, -5e12, 5e12);
+        checkAgainstReference<float>(n, -1.0, 1.0);
+        checkAgainstReference<double>(n, -0.05, 0.05);
+    }
+}
+
+TEST(StatisticsBasicTest, OnePassStdDevStaysAccurateFarFromZero)
+{
+    // Naive sum-of-squares would lose every digit here; the shifted sums do not.
+    std::vector<double> v = sample<double>(10'000, 1e9, 1e9 + 1.0);
+    const double SD = twoPassStdDev(v);
+    EXPECT_NEAR(*Statistics::calculateStdDev(v), SD, 1e-6 * SD);
+}
+
+TEST(StatisticsBasicTest, EmptyAndSingleInputs)
+{
+    const std::vector<double> EMPTY;
+    EXPECT_FALSE(Statistics::calculateMean(EMPTY).has_value());
+    EXPECT_FALSE(Statistics::calculateMin(EMPTY).has_value());
+    EXPECT_FALSE(Statistics::calculateMax(EMPTY).has_value());
+    EXPECT_FALSE(Statistics::calculateMedian(EMPTY).has_value());
+    EXPECT_FALSE(Statistics::summarize(EMPTY).has_value());
+
+    const std::vector<int> ONE{42};
+    EXPECT_FALSE(Statistics::calculateStdDev(ONE).has_value());
+    EXPECT_EQ(Statistics::summarize(ONE)->stddev, 0.0);
+    EXPECT_EQ(*Statistics::calculateMedian(ONE), 42.0);
+}
+
+TEST(StatisticsBasicTest, IntegerMedianDoesNotOverflow)
+{
+    const std::vector<int> V{2'000'000'000, 2'100'000'000};
+    EXPECT_EQ(*Statistics::calculateMedian(V), 2'050'000'000.0);
+}
@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "domain/backtest/Engine.hpp"
+#include "strategy/BuyHold.hpp"
+#include "strategy/MACrossover.hpp"
+#include "test_helpers.hpp"
+
+using namespace qga::domain::backtest;
+using qga::strategy::Signal;
+
+namespace
+{
+    constexpr testlib::Wave WAVE{.period_ = 11.0, .ripple_ = 3.0, .ripple_period_ = 3.0};
+
+    /// Only implements onBar(): exercises the default onBars() adapter.
+    class EveryThirdBar : public qga::strategy::IStrategy
+    {
+      public:
+        Signal onBar(const qga::domain::Quote& q) override
+        {
+            return (n_++ % 3 == 0) ? (q.close_ > 100.0 ? Signal::Sell : Signal::Buy) : Signal::None;
+        }
+
+      private:
+        std::size_t n_ = 0;
+    };
+
+    /// Counts how the engine dispatches.
+    class CountingStrategy : public qga::strategy::IStrategy
+    {
+      public:
+        std::size_t bar_calls_ = 0;
+        std::vector<std::size_t> block_sizes_;
+
+        Signal onBar(const qga::domain::Quote&) override
+        {
+            ++bar_calls_;
+            return Signal::None;
+        }
+        void onBars(const qga::domain::BarColumns& bars, std::span<Signal> out) override
+        {
+            block_sizes_.push_back(bars.size());
+            std::fill(out.begin(), out.end(), Signal::None);
+        }
+    };
+
+    /// Feeds @p series to onBars() in blocks of @p block bars.
+    std::vector<Signal> inBlocks(qga::strategy::IStrategy& strat, const BarSeries& series, std::size_t block)
+    {
+        std::vector<Signal> out(series.size());
+        strat.onStart();
+        for (std::size_t b = 0; b < series.size(); b += block)
+        {
+            const std::size_t LEN = std::min(block, series.size() - b);
+            strat.onBars(series.columns().slice(b, LEN), std::span(out).subspan(b, LEN));
+        }
+        return out;
+    }
+
+    std::vector<Signal> barByBar(qga::strategy::IStrategy& strat, const BarSeries& series)
+    {
+        std::vector<Signal> out;
+        strat.onStart();
+        for (std::size_t i = 0; i < series.size(); ++i)
+            out.push_back(strat.onBar(series[i]));
+        return out;
+    }
+} // namespace
+
+TEST(StrategyOnBarsTest, MACrossoverBlocksMatchOnBarAcrossBlockBoundaries)
+{
+    const auto series = testlib::wavySeries(3'000, WAVE);
+    qga::strategy::MACrossover strat(5, 21);
+    const auto expected = barByBar(strat, series);
+
+    for (std::size_t block : {1u, 7u, 1024u, 5000u})
+        EXPECT_EQ(inBlocks(strat, series, block), expected) << "block " << block;
+}
+
+TEST(StrategyOnBarsTest, BuyHoldBuysOnlyOnceAcrossBlocks)
+{
+    const auto series = testlib::wavySeries(50, WAVE);
+    qga::strategy::BuyHold strat;
+    const auto out = inBlocks(strat, series, 8);
+
+    EXPECT_EQ(out[0], Signal::Buy);
+    EXPECT_EQ(std::count(out.begin(), out.end(), Signal::Buy), 1);
+}
+
+TEST(StrategyOnBarsTest, DefaultAdapterLoopsOnBar)
+{
+    const auto series = testlib::wavySeries(100, WAVE);
+    EveryThirdBar a, b;
+    EXPECT_EQ(inBlocks(a, series, 13), barByBar(b, series));
+
+    const Engine engine(1'000.0, ExecParams{1.0, 0.0, 1.0});
+    EveryThirdBar c;
+    const auto r = engine.run(series, c);
+    EXPECT_GT(r.trades_executed_, 0);
+}
+
+TEST(StrategyOnBarsTest, EngineDispatchesInBlocks)
+{
+    const auto series = testlib::wavySeries(2'500, WAVE);
+    CountingStrategy strat;
+    Engine{}.run(series, strat);
+
+    EXPECT_EQ(strat.bar_calls_, 0u);
+    EXPECT_EQ(strat.block_sizes_, (std::vector<std::size_t>{1024, 1024, 452}));
+}
@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <vector>
+
+#include "domain/backtest/SweepRunner.hpp"
+#include "strategy/MACrossover.hpp"
+#include "test_helpers.hpp"
+
+using namespace qga::domain::backtest;
+
+namespace
+{
+    constexpr testlib::Wave WAVE{.period_ = 20.0, .drift_ = 0.01};
+} // namespace
+
+TEST(ParamGridTest, EnumeratesCartesianProductLastRangeFastest)
+{
+    ParamGrid grid;
+    grid.add({"fast", 1, 3}).add({"slow", 10, 20, 5});
+
+    ASSERT_EQ(grid.size(), 9u);
+    EXPECT_EQ(grid.point(0), (ParamPoint{1, 10}));
+    EXPECT_EQ(grid.point(1), (ParamPoint{1, 15}));
+    EXPECT_EQ(grid.point(3), (ParamPoint{2, 10}));
+    EXPECT_EQ(grid.point(8), (ParamPoint{3, 20}));
+    EXPECT_THROW(grid.point(9), std::out_of_range);
+
+    EXPECT_THROW(grid.add({"bad", 1, 2, 0}), std::invalid_argument);
+    EXPECT_THROW(grid.add({"bad", 5, 1}), std::invalid_argument);
+    EXPECT_EQ(ParamGrid{}.size(), 0u);
+}
+
+TEST(SweepRunnerTest, RanksResultsAndMatchesSequentialRuns)
+{
+    const auto series = testlib::wavySeries(2'000, WAVE);
+    const Engine engine(10'000.0, ExecParams{0.5, 1.0, 1.0});
+
+    ParamGrid grid;
+    grid.add({"fast", 2, 12, 2}).add({"slow", 8, 40, 4});
+
+    SweepRunner runner(engine, 4);
+    const auto table = runner.run(series, grid, maCrossoverFactory());
+
+    // fast >= slow combinations are skipped.
+    std::size_t valid = 0;
+    for (std::size_t i = 0; i < grid.size(); ++i)
+        valid += grid.point(i)[0] < grid.point(i)[1];
+    ASSERT_EQ(table.size(), valid);
+
+    for (std::size_t i = 1; i < table.size(); ++i)
+        EXPECT_GE(table[i - 1].result_.final_equity_, table[i].result_.final_equity_);
+
+    for (const auto& row : {table.front(), table.back()})
+    {
+        qga::strategy::MACrossover strat(row.params_[0], row.params_[1]);
+        const auto expected = engine.run(series, strat);
+        EXPECT_DOUBLE_EQ(row.result_.final_equity_, expected.final_equity_);
+        EXPECT_EQ(row.result_.trades_executed_, expected.trades_executed_);
+    }
+}
+
+TEST(SweepRunnerTest, PropagatesFactoryErrors)
+{
+    const auto series = testlib::wavySeries(100, WAVE);
+    ParamGrid grid;
+    grid.add({"only", 1, 3});
+
+    SweepRunner runner(Engine{}, 2);
+    EXPECT_THROW(runner.run(series, grid, maCrossoverFactory()), std::invalid_argument);
+}
+
+TEST(SweepRunnerTest, SharedIndicatorSweepMatchesIndependentRuns)
+{
+    const auto series = testlib::wavySeries(3'000, WAVE);
+    const Engine engine(10'000.0, ExecParams{0.5, 1.0, 1.0});
+
+    ParamGrid grid;
+    grid.add({"fast", 2, 12, 2}).add({"slow", 8, 40, 4});
+
+    SweepRunner runner(engine, 3);
+    const auto independent = runner.run(series, grid, maCrossoverFactory());
+    const auto shared = runner.runShared(series, grid, maCrossoverGraphFactory());
+
+    ASSERT_EQ(shared.size(), independent.size());
+    for (std::size_t i = 0; i < shared.size(); ++i)
+    {
+        EXPECT_EQ(shared[i].params_, independent[i].params_) << "row " << i;
+        EXPECT_EQ(shared[i].result_.final_equity_, independent[i].result_.final_equity_) << "row " << i;
+        EXPECT_EQ(shared[i].result_.trades_executed_, independent[i].result_.trades_executed_) << "row " << i;
+    }
+    EXPECT_THROW(runner.runShared(series, ParamGrid{}.add({"only", 1, 3}), maCrossoverGraphFactory()),
+                 std::invalid_argument);
+}
@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <stdexcept>
+#include <vector>
+
+#include "core/ThreadPool.hpp"
+
+using qga::core::ThreadPool;
+
+TEST(ThreadPoolTest, RunsAllTasksAndReturnsResults)
+{
+    ThreadPool pool(4);
+    EXPECT_EQ(pool.size(), 4u);
+
+    std::vector<std::future<int>> results;
+    for (int i = 0; i < 100; ++i)
+        results.push_back(pool.submit([i] { return i * i; }));
+
+    for (int i = 0; i < 100; ++i)
+        EXPECT_EQ(results[i].get(), i * i);
+}
+
+TEST(ThreadPoolTest, PropagatesExceptionsThroughFuture)
+{
+    ThreadPool pool(2);
+    auto f = pool.submit([]() -> int { throw std::runtime_error("boom"); });
+    EXPECT_THROW(f.get(), std::runtime_error);
+}
+
+TEST(ThreadPoolTest, DestructorDrainsQueuedTasks)
+{
+    std::atomic<int> done{0};
+    {
+        ThreadPool pool(1);
+        for (int i = 0; i < 50; ++i)
+            pool.submit([&done] { ++done; });
+    }
+    EXPECT_EQ(done.load(), 50);
+}
+
+TEST(ThreadPoolTest, NonPositiveSizeUsesHardwareConcurrency)
+{
+    ThreadPool pool(0);
+    EXPECT_GE(pool.size(), 1u);
+}
+
+TEST(ThreadPoolTest, IdleWorkersStealQueuedTasks)
+{
+    ThreadPool pool(4);
+
+    // One task fans out many children onto its own queue; the other workers
+    // can only get at them by stealing.
+    std::atomic<int> done{0};
+    std::vector<std::future<void>> children;
+    std::mutex children_mtx;
+    pool.submit([&] {
+            std::lock_guard lock(children_mtx);
+            for (int i = 0; i < 200; ++i)
+                children.push_back(pool.submit([&done] {
+                    std::this_thread::sleep_for(std::chrono::microseconds(200));
+                    ++done;
+                }));
+        })
+        .get();
+
+    std::lock_guard lock(children_mtx);
+    for (auto& f : children)
+        f.get();
+    EXPECT_EQ(done.load(), 200);
+}